@@ -46,6 +46,9 @@
 %ignore ForwardTranslatorInitializer;
 %ignore openstudio::energyplus::detail::ForwardTranslatorInitializer;
 
+// std::ostream does not map to the target languages, use translateModelToFile
+%ignore openstudio::energyplus::ForwardTranslator::translateModelToStream;
+
 %include <energyplus/ErrorFile.hpp>
 %include <energyplus/ForwardTranslator.hpp>
 %include <energyplus/ReverseTranslator.hpp>
@@ -57,6 +57,7 @@
 #include "../utilities/idf/WorkspaceObjectOrder.hpp"
 #include "../utilities/core/Logger.hpp"
 #include "../utilities/core/Assert.hpp"
+#include "../utilities/core/Filesystem.hpp"
 #include "../utilities/core/FilesystemHelpers.hpp"
 #include "../utilities/geometry/BoundingBox.hpp"
 #include "../utilities/time/Time.hpp"
@@ -77,9 +78,13 @@
 #include "../utilities/idd/IddEnums.hpp"
 
 #include "../utilities/core/Deprecated.hpp"
+#include "../utilities/core/ParallelFor.hpp"
+
+#include <boost/algorithm/string/case_conv.hpp>
 
 #include <algorithm>
 #include <iterator>
+#include <map>
 #include <sstream>
 #include <thread>
 
@@ -110,6 +115,7 @@ namespace energyplus {
 
     // When m_forwardTranslatorOptions.excludeSpaceTranslation() is false, could we skip the (expensive) clone since we aren't combining spaces?
     // No, we are still doing stuff like removing orphan loads, spaces not part of a thermal zone, etc
+    // The clone shares the field text of each object with model until translateModelPrivate changes that object
     auto modelCopy = model.clone(true).cast<Model>();
 
     m_progressBar = progressBar;
@@ -121,6 +127,33 @@ namespace energyplus {
     return translateModelPrivate(modelCopy, true);
   }
 
+  bool ForwardTranslator::translateModelToStream(const Model& model, std::ostream& os, ProgressBar* progressBar) {
+    auto modelCopy = model.clone(true).cast<Model>();
+
+    m_progressBar = progressBar;
+    if (m_progressBar) {
+      m_progressBar->setMinimum(0);
+      m_progressBar->setMaximum(model.numObjects());
+    }
+
+    translateModelToIdfObjects(modelCopy, true);
+
+    if (!printIdfObjects(os)) {
+      // names the Workspace would change to resolve conflicts, and change the fields pointing to them as well
+      idfObjectsToWorkspace().toIdfFile().print(os);
+    }
+    return os.good();
+  }
+
+  bool ForwardTranslator::translateModelToFile(const Model& model, const openstudio::path& p, ProgressBar* progressBar) {
+    openstudio::filesystem::ofstream outFile(p, std::ios_base::binary);
+    if (!outFile) {
+      LOG(Error, "Cannot open file '" << toString(p) << "' for writing.");
+      return false;
+    }
+    return translateModelToStream(model, outFile, progressBar);
+  }
+
   Workspace ForwardTranslator::translateModelObject(ModelObject& modelObject) {
     Model modelCopy;
     modelObject.clone(modelCopy);
@@ -131,7 +164,7 @@ namespace energyplus {
   }
 
   std::vector<LogMessage> ForwardTranslator::warnings() const {
-    std::vector<LogMessage> allMessages = m_logSink.logMessages();
+    std::vector<LogMessage> allMessages = logMessages();
     std::vector<LogMessage> result;
     std::copy_if(allMessages.cbegin(), allMessages.cend(), std::back_inserter(result),
                  [](const auto& logMessage) { return logMessage.logLevel() == Warn; });
@@ -139,7 +172,7 @@ namespace energyplus {
   }
 
   std::vector<LogMessage> ForwardTranslator::errors() const {
-    std::vector<LogMessage> allMessages = m_logSink.logMessages();
+    std::vector<LogMessage> allMessages = logMessages();
     std::vector<LogMessage> result;
     std::copy_if(allMessages.cbegin(), allMessages.cend(), std::back_inserter(result),
                  [](const auto& logMessage) { return logMessage.logLevel() > Warn; });
@@ -174,6 +207,14 @@ namespace energyplus {
     m_forwardTranslatorOptions.setExcludeSpaceTranslation(excludeSpaceTranslation);
   }
 
+  unsigned ForwardTranslator::numThreads() const {
+    return m_numThreads;
+  }
+
+  void ForwardTranslator::setNumThreads(unsigned numThreads) {
+    m_numThreads = numThreads;
+  }
+
   // Figure out which object
   // * If the load is assigned to a space,
   //     * m_forwardTranslatorOptions.excludeSpaceTranslation() = true: translate and return the IdfObject for the Zone
@@ -207,6 +248,11 @@ namespace energyplus {
   };
 
   Workspace ForwardTranslator::translateModelPrivate(model::Model& model, bool fullModelTranslation) {
+    translateModelToIdfObjects(model, fullModelTranslation);
+    return idfObjectsToWorkspace();
+  }
+
+  void ForwardTranslator::translateModelToIdfObjects(model::Model& model, bool fullModelTranslation) {
     reset();
 
     // translate Version first
@@ -535,6 +581,9 @@ namespace energyplus {
       }
     }
 
+    // the model is not changed from here on, except for new objects, so curves and tables can be translated ahead of the serial pass
+    translateLeafObjectsParallel(model);
+
     translateConstructions(model);
     translateSchedules(model);
 
@@ -611,7 +660,9 @@ namespace energyplus {
       // add output requests
       this->createStandardOutputRequests(model);
     }
+  }
 
+  Workspace ForwardTranslator::idfObjectsToWorkspace() const {
     Workspace workspace(StrictnessLevel::Minimal, IddFileType::EnergyPlus);
     OptionalWorkspaceObject vo = workspace.versionObject();
     OS_ASSERT(vo);
@@ -625,6 +676,73 @@ namespace energyplus {
     return workspace;
   }
 
+  bool ForwardTranslator::printIdfObjects(std::ostream& os) const {
+    // names by reference list, as Workspace::getObjectByNameAndReference finds them
+    std::map<std::string, std::map<std::string, std::string>> namesByReference;
+    for (const IdfObject& idfObject : m_idfObjects) {
+      if (!idfObject.iddObject().hasNameField()) {
+        continue;
+      }
+      std::string name = idfObject.nameString();
+      if (name.empty()) {
+        continue;
+      }
+      std::string key = boost::to_upper_copy(name);
+      for (const std::string& reference : idfObject.iddObject().references()) {
+        if (!namesByReference[reference].emplace(key, name).second) {
+          // two objects of a same reference list have the same name, adding them to a Workspace renames one of them
+          return false;
+        }
+      }
+    }
+
+    // the Workspace finds the objects pointed to by name, regardless of case, and prints their name. Names that do not match
+    // any object are dropped.
+    auto printObject = [&os, &namesByReference](const IdfObject& idfObject) {
+      boost::optional<IdfObject> resolvedObject;
+      for (unsigned index : idfObject.objectListFields()) {
+        std::string targetName = idfObject.getString(index).get();
+        if (targetName.empty()) {
+          continue;
+        }
+        std::string resolvedName;
+        std::string key = boost::to_upper_copy(targetName);
+        for (const std::string& objectList : idfObject.iddObject().objectLists(index)) {
+          auto referenceIt = namesByReference.find(objectList);
+          if (referenceIt == namesByReference.end()) {
+            continue;
+          }
+          auto nameIt = referenceIt->second.find(key);
+          if (nameIt != referenceIt->second.end()) {
+            resolvedName = nameIt->second;
+            break;
+          }
+        }
+        if (resolvedName != targetName) {
+          if (!resolvedObject) {
+            resolvedObject = idfObject.clone();
+          }
+          resolvedObject->setString(index, resolvedName);
+        }
+      }
+      (resolvedObject ? *resolvedObject : idfObject).print(os);
+    };
+
+    // Workspace::toIdfFile puts the version object first
+    os << '\n';
+    for (const IdfObject& idfObject : m_idfObjects) {
+      if (idfObject.iddObject().type() == IddObjectType::Version) {
+        printObject(idfObject);
+      }
+    }
+    for (const IdfObject& idfObject : m_idfObjects) {
+      if (idfObject.iddObject().type() != IddObjectType::Version) {
+        printObject(idfObject);
+      }
+    }
+    return true;
+  }
+
   // struct for sorting children in forward translator
   struct ChildSorter
   {
@@ -667,6 +785,10 @@ namespace energyplus {
       return boost::optional<IdfObject>(objInMapIt->second);
     }
 
+    if (!m_leafTranslations.empty() && useLeafTranslation(modelObject, retVal)) {
+      return retVal;
+    }
+
     LOG(Trace, "Translating " << modelObject.briefDescription() << ".");
 
     switch (modelObject.iddObject().type().value()) {
@@ -3994,7 +4116,7 @@ namespace energyplus {
   }
 
   void ForwardTranslator::reset() {
-    m_idfObjects.clear();
+    clearIdfObjects();
 
     m_map.clear();
 
@@ -4006,11 +4128,178 @@ namespace energyplus {
 
     m_constructionHandleToReversedConstructions.clear();
 
+    m_leafTranslations.clear();
+
+    m_logMessages.clear();
+
     m_logSink.setThreadId(std::this_thread::get_id());
 
     m_logSink.resetStringStream();
   }
 
+  std::vector<IddObjectType> ForwardTranslator::leafIddObjectTypes() {
+    static const std::vector<IddObjectType> result{
+      IddObjectType::OS_Curve_Bicubic,
+      IddObjectType::OS_Curve_Biquadratic,
+      IddObjectType::OS_Curve_Cubic,
+      IddObjectType::OS_Curve_DoubleExponentialDecay,
+      IddObjectType::OS_Curve_Exponent,
+      IddObjectType::OS_Curve_ExponentialDecay,
+      IddObjectType::OS_Curve_ExponentialSkewNormal,
+      IddObjectType::OS_Curve_FanPressureRise,
+      IddObjectType::OS_Curve_Functional_PressureDrop,
+      IddObjectType::OS_Curve_Linear,
+      IddObjectType::OS_Curve_QuadLinear,
+      IddObjectType::OS_Curve_QuintLinear,
+      IddObjectType::OS_Curve_Quadratic,
+      IddObjectType::OS_Curve_QuadraticLinear,
+      IddObjectType::OS_Curve_Quartic,
+      IddObjectType::OS_Curve_RectangularHyperbola1,
+      IddObjectType::OS_Curve_RectangularHyperbola2,
+      IddObjectType::OS_Curve_Sigmoid,
+      IddObjectType::OS_Curve_Triquadratic,
+      IddObjectType::OS_Table_IndependentVariable,
+      IddObjectType::OS_Table_Lookup,
+    };
+    return result;
+  }
+
+  void ForwardTranslator::translateLeafObjectsParallel(const model::Model& model) {
+    m_leafTranslations.clear();
+
+    std::vector<ModelObject> objects;
+    for (const IddObjectType& iddObjectType : leafIddObjectTypes()) {
+      for (const WorkspaceObject& workspaceObject : model.getObjectsByType(iddObjectType)) {
+        objects.push_back(workspaceObject.cast<ModelObject>());
+      }
+    }
+
+    const unsigned numThreads = parallelThreadCount(objects.size(), m_numThreads, 64);
+    if (numThreads < 2) {
+      // the serial pass translates them as it goes
+      return;
+    }
+
+    // each thread has a translator of its own, reset on that thread so its log sink only sees the messages of that thread.
+    // None of them runs on this thread, whose messages go to m_logSink.
+    std::vector<ForwardTranslator> translators(numThreads);
+    for (auto& translator : translators) {
+      translator.m_forwardTranslatorOptions = m_forwardTranslatorOptions;
+    }
+    std::vector<char> translatorsReset(numThreads, 0);
+
+    std::vector<LeafTranslation> leafTranslations(objects.size());
+    parallelForChunks(objects.size(), numThreads, 64, [&](unsigned threadIndex, std::size_t i) {
+      ForwardTranslator& translator = translators[threadIndex];
+      if (!translatorsReset[threadIndex]) {
+        translator.reset();
+        translatorsReset[threadIndex] = 1;
+      }
+      // translate each object on its own, so that its translation holds everything it needs wherever the serial pass uses it
+      translator.clearIdfObjects();
+      translator.m_map.clear();
+      LeafTranslation& leafTranslation = leafTranslations[i];
+      try {
+        leafTranslation.result = translator.translateAndMapModelObject(objects[i]);
+      } catch (...) {
+        // leave it to the serial pass, which throws at the same point it always did
+        translator.m_logSink.resetStringStream();
+        return;
+      }
+      leafTranslation.translated = true;
+      leafTranslation.idfObjects = std::move(translator.m_idfObjects);
+      leafTranslation.map.assign(translator.m_map.begin(), translator.m_map.end());
+      leafTranslation.logMessages = translator.m_logSink.logMessages();
+      translator.m_logSink.resetStringStream();
+    });
+
+    for (std::size_t i = 0; i < objects.size(); ++i) {
+      if (leafTranslations[i].translated) {
+        m_leafTranslations.emplace(objects[i].handle(), std::move(leafTranslations[i]));
+      }
+    }
+  }
+
+  bool ForwardTranslator::useLeafTranslation(const model::ModelObject& modelObject, boost::optional<IdfObject>& result) {
+    auto it = m_leafTranslations.find(modelObject.handle());
+    if (it == m_leafTranslations.end()) {
+      return false;
+    }
+
+    LeafTranslation leafTranslation = std::move(it->second);
+    m_leafTranslations.erase(it);
+
+    // objects it translated along the way, e.g. the independent variables of a table, may already be translated
+    for (const auto& mapEntry : leafTranslation.map) {
+      if (m_map.find(mapEntry.first) != m_map.end()) {
+        return false;
+      }
+    }
+
+    m_idfObjects.insert(m_idfObjects.end(), leafTranslation.idfObjects.begin(), leafTranslation.idfObjects.end());
+    m_map.insert(leafTranslation.map.begin(), leafTranslation.map.end());
+    // splice its messages in after the ones logged so far
+    if (!leafTranslation.logMessages.empty()) {
+      std::vector<LogMessage> loggedMessages = m_logSink.logMessages();
+      m_logSink.resetStringStream();
+      m_logMessages.insert(m_logMessages.end(), loggedMessages.begin(), loggedMessages.end());
+      m_logMessages.insert(m_logMessages.end(), leafTranslation.logMessages.begin(), leafTranslation.logMessages.end());
+    }
+
+    if (m_progressBar) {
+      m_progressBar->setValue((int)m_map.size());
+    }
+
+    result = leafTranslation.result;
+    return true;
+  }
+
+  std::vector<LogMessage> ForwardTranslator::logMessages() const {
+    std::vector<LogMessage> result = m_logMessages;
+    std::vector<LogMessage> loggedMessages = m_logSink.logMessages();
+    result.insert(result.end(), loggedMessages.begin(), loggedMessages.end());
+    return result;
+  }
+
+  void ForwardTranslator::clearIdfObjects() {
+    m_idfObjects.clear();
+    m_idfObjectPositionsByType.clear();
+    m_numIndexedIdfObjects = 0;
+  }
+
+  std::vector<IdfObject> ForwardTranslator::idfObjectsByType(const IddObjectType& iddObjectType) {
+    // m_idfObjects only shrinks through clearIdfObjects and the pop_back of translateScheduleTypeLimits, which is followed by
+    // a push_back of the same type. Start over if it did anyway.
+    if (m_idfObjects.size() < m_numIndexedIdfObjects) {
+      m_idfObjectPositionsByType.clear();
+      m_numIndexedIdfObjects = 0;
+    }
+    for (std::size_t n = m_idfObjects.size(); m_numIndexedIdfObjects < n; ++m_numIndexedIdfObjects) {
+      m_idfObjectPositionsByType[m_idfObjects[m_numIndexedIdfObjects].iddObject().type()].push_back(m_numIndexedIdfObjects);
+    }
+
+    std::vector<IdfObject> result;
+    auto it = m_idfObjectPositionsByType.find(iddObjectType);
+    if (it != m_idfObjectPositionsByType.end()) {
+      result.reserve(it->second.size());
+      for (std::size_t position : it->second) {
+        if (m_idfObjects[position].iddObject().type() == iddObjectType) {
+          result.push_back(m_idfObjects[position]);
+        }
+      }
+    }
+    return result;
+  }
+
+  boost::optional<IdfObject> ForwardTranslator::findIdfObject(const IddObjectType& iddObjectType, const std::string& name) {
+    for (const IdfObject& idfObject : idfObjectsByType(iddObjectType)) {
+      if (idfObject.nameString() == name) {
+        return idfObject;
+      }
+    }
+    return boost::none;
+  }
+
   model::ConstructionBase ForwardTranslator::interiorPartitionSurfaceConstruction(model::Model& model) {
     if (m_interiorPartitionSurfaceConstruction) {
       return *m_interiorPartitionSurfaceConstruction;
@@ -4424,11 +4713,8 @@ namespace energyplus {
 
     // ensure at least one life cycle cost exists to prevent crash in E+ 8
     if (!m_forwardTranslatorOptions.excludeLCCObjects()) {
-      bool hasAtLeastOneCost = std::any_of(m_idfObjects.cbegin(), m_idfObjects.cend(), [](const auto& obj) {
-        auto iddObjType = obj.iddObject().type();
-        return (iddObjType == openstudio::IddObjectType::LifeCycleCost_NonrecurringCost)
-               || (iddObjType == openstudio::IddObjectType::LifeCycleCost_RecurringCosts);
-      });
+      bool hasAtLeastOneCost = !idfObjectsByType(openstudio::IddObjectType::LifeCycleCost_NonrecurringCost).empty()
+                               || !idfObjectsByType(openstudio::IddObjectType::LifeCycleCost_RecurringCosts).empty();
 
       if (!hasAtLeastOneCost) {
         // add default cost
@@ -4490,12 +4776,10 @@ namespace energyplus {
     sstm << glycolType << "_" << glycolConcentration;
     std::string glycolName = sstm.str();
 
-    auto it = std::find_if(m_idfObjects.cbegin(), m_idfObjects.cend(), [&glycolName](const IdfObject& i) {
-      return (i.iddObject().type().value() == openstudio::IddObjectType::FluidProperties_Name)
-             && openstudio::istringEqual(i.getString(FluidProperties_NameFields::FluidName, true).get(), glycolName);
-    });
-    if (it != m_idfObjects.cend()) {
-      return *it;
+    for (const IdfObject& fluidPropName : idfObjectsByType(openstudio::IddObjectType::FluidProperties_Name)) {
+      if (openstudio::istringEqual(fluidPropName.getString(FluidProperties_NameFields::FluidName, true).get(), glycolName)) {
+        return fluidPropName;
+      }
     }
 
     // TODO: JM 2019-03-22 I am not sure you need this one
@@ -4519,12 +4803,10 @@ namespace energyplus {
     boost::optional<IdfObject> idfObject;
     boost::optional<IdfFile> idfFile;
 
-    auto it = std::find_if(m_idfObjects.cbegin(), m_idfObjects.cend(), [&fluidType](const IdfObject& i) {
-      return (i.iddObject().type().value() == openstudio::IddObjectType::FluidProperties_Name)
-             && openstudio::istringEqual(i.getString(FluidProperties_NameFields::FluidName, true).get(), fluidType);
-    });
-    if (it != m_idfObjects.cend()) {
-      return *it;
+    for (const IdfObject& fluidPropName : idfObjectsByType(openstudio::IddObjectType::FluidProperties_Name)) {
+      if (openstudio::istringEqual(fluidPropName.getString(FluidProperties_NameFields::FluidName, true).get(), fluidType)) {
+        return fluidPropName;
+      }
     }
     auto objInMapIt = m_fluidPropertiesMap.find(fluidType);
     if (objInMapIt != m_fluidPropertiesMap.end()) {
@@ -4708,18 +4990,12 @@ namespace energyplus {
       for (const auto& node : upstreamNodes) {
         auto spms = subsetCastVector<model::SetpointManagerMixedAir>(node.setpointManagers());
         for (auto& spm : spms) {
-          auto pred = [&spm](IdfObject& idfObject) {
-            if (idfObject.iddObject().type() == IddObjectType::SetpointManager_MixedAir) {
-              auto idfName = idfObject.name();
-              auto osName = spm.name();
-              if (idfName && osName && (osName.get() == idfName.get())) {
-                return true;
-              }
-            }
-            return false;
-          };
-          auto spm_idf = std::find_if(m_idfObjects.begin(), m_idfObjects.end(), pred);
-          if (spm_idf != m_idfObjects.end()) {
+          auto osName = spm.name();
+          boost::optional<IdfObject> spm_idf;
+          if (osName) {
+            spm_idf = findIdfObject(IddObjectType::SetpointManager_MixedAir, osName.get());
+          }
+          if (spm_idf) {
             auto result = spm_idf->getString(SetpointManager_MixedAirFields::FanInletNodeName);
             if (!result || result->empty()) {
               spm_idf->setString(SetpointManager_MixedAirFields::FanInletNodeName, fanInletNodeName);
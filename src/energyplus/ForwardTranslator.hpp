@@ -515,6 +515,16 @@ namespace energyplus {
    */
     Workspace translateModel(const model::Model& model, ProgressBar* progressBar = nullptr);
 
+    /** Translates the given Model and writes the resulting IDF to os. The text is the same as that of the Workspace returned
+   *  by translateModel, but no Workspace is built unless names in the translated objects conflict. Returns false if writing
+   *  to os failed.
+   */
+    bool translateModelToStream(const model::Model& model, std::ostream& os, ProgressBar* progressBar = nullptr);
+
+    /** Translates the given Model and writes the resulting IDF to the file at p, see translateModelToStream.
+   */
+    bool translateModelToFile(const model::Model& model, const openstudio::path& p, ProgressBar* progressBar = nullptr);
+
     /** Translates a ModelObject into a Workspace
    */
     Workspace translateModelObject(model::ModelObject& modelObject);
@@ -568,6 +578,13 @@ namespace energyplus {
 
     //@}
 
+    /** Number of threads translating curves and tables ahead of the rest of the model, 0 means one per hardware thread.
+   *  The default of 1 translates everything on the calling thread. The Workspace is the same for any number of threads.
+   */
+    unsigned numThreads() const;
+
+    void setNumThreads(unsigned numThreads);
+
    private:
     REGISTER_LOGGER("openstudio.energyplus.ForwardTranslator");
 
@@ -588,6 +605,16 @@ namespace energyplus {
    */
     Workspace translateModelPrivate(model::Model& model, bool fullModelTranslation);
 
+    // the part of translateModelPrivate that fills m_idfObjects
+    void translateModelToIdfObjects(model::Model& model, bool fullModelTranslation);
+
+    // adds m_idfObjects to a new Workspace
+    Workspace idfObjectsToWorkspace() const;
+
+    /** Prints m_idfObjects as idfObjectsToWorkspace().toIdfFile() would. Returns false without printing anything if objects
+   *  would be renamed when adding them to a Workspace. */
+    bool printIdfObjects(std::ostream& os) const;
+
     // Pick up the Zone, ZoneList, Space or SpaceList (if allowSpaceType is true) object for a given SpaceLoad (or SpaceLoadInstance)
     IdfObject getSpaceLoadParent(const model::SpaceLoad& sp, bool allowSpaceType = true);
 
@@ -1589,6 +1616,38 @@ namespace energyplus {
     // reset the state of the translator between translations
     void reset();
 
+    // clears m_idfObjects and its index by type
+    void clearIdfObjects();
+
+    /** Returns the objects of m_idfObjects of type iddObjectType, in order, without scanning all of m_idfObjects.
+   *  Objects are returned by handle, changing them changes the objects in m_idfObjects. */
+    std::vector<IdfObject> idfObjectsByType(const IddObjectType& iddObjectType);
+
+    /** Returns the first object of m_idfObjects of type iddObjectType named name, if any. */
+    boost::optional<IdfObject> findIdfObject(const IddObjectType& iddObjectType, const std::string& name);
+
+    // result of translating a single leaf object on its own, see translateLeafObjectsParallel
+    struct LeafTranslation
+    {
+      bool translated = false;
+      boost::optional<IdfObject> result;
+      std::vector<IdfObject> idfObjects;
+      std::vector<std::pair<openstudio::Handle, IdfObject>> map;
+      std::vector<LogMessage> logMessages;
+    };
+
+    // types that do not depend on the state of the translator beyond m_idfObjects and m_map, and can be translated concurrently
+    static std::vector<IddObjectType> leafIddObjectTypes();
+
+    // translate the objects of leafIddObjectTypes() on m_numThreads threads into m_leafTranslations
+    void translateLeafObjectsParallel(const model::Model& model);
+
+    // if modelObject has a leaf translation that does not conflict with m_map, add it to m_idfObjects and m_map and set result
+    bool useLeafTranslation(const model::ModelObject& modelObject, boost::optional<IdfObject>& result);
+
+    // all the messages logged by the translation so far, in order
+    std::vector<LogMessage> logMessages() const;
+
     // helper method used by ForwardTranslatePlantLoop
     IdfObject populateBranch(IdfObject& branchIdfObject, std::vector<model::ModelObject>& modelObjects, model::Loop& loop, bool isSupplyBranch);
 
@@ -1682,10 +1741,24 @@ namespace energyplus {
 
     std::vector<IdfObject> m_idfObjects;
 
+    // positions in m_idfObjects of the objects of each type, for the first m_numIndexedIdfObjects objects.
+    // Translators append to m_idfObjects directly and often name an object after appending it, so the index is by type only,
+    // names are compared on lookup, and idfObjectsByType indexes the objects appended since the last lookup.
+    std::map<IddObjectType, std::vector<std::size_t>> m_idfObjectPositionsByType;
+    std::size_t m_numIndexedIdfObjects = 0;
+
     boost::optional<IdfObject> m_anyNumberScheduleTypeLimits;
 
     StringStreamLogSink m_logSink;
 
+    std::map<openstudio::Handle, LeafTranslation> m_leafTranslations;
+
+    // messages moved out of m_logSink when the messages of a leaf translation are spliced in after them, so that the messages are in the
+    // order of a serial translation. m_logSink holds the ones logged since.
+    std::vector<LogMessage> m_logMessages;
+
+    unsigned m_numThreads = 1;
+
     ProgressBar* m_progressBar;
 
     // ForwardTranslator options
@@ -18,8 +18,6 @@
 #include <utilities/idd/IddEnums.hxx>
 #include <utilities/idd/IddFactory.hxx>
 
-#include <algorithm>
-
 constexpr static auto pythonSearchPathsName = "Python Plugin Search Paths";
 
 using namespace openstudio::model;
@@ -68,8 +66,8 @@ namespace energyplus {
     // PythonPlugin:SearchPaths
     std::string searchPath = toString(filePath.parent_path());
 
-    auto it = std::find_if(m_idfObjects.begin(), m_idfObjects.end(), [](auto& idfObject) { return idfObject.nameString() == pythonSearchPathsName; });
-    if (it == m_idfObjects.end()) {
+    boost::optional<IdfObject> searchPaths_ = findIdfObject(IddObjectType::PythonPlugin_SearchPaths, pythonSearchPathsName);
+    if (!searchPaths_) {
       // First time: create it
       auto& pythonPluginSearchPaths = m_idfObjects.emplace_back(IddObjectType::PythonPlugin_SearchPaths);
 
@@ -85,7 +83,7 @@ namespace energyplus {
 
       // Try to locate it before adding it
       bool newSearchPath = true;
-      for (const IdfExtensibleGroup& eg : it->extensibleGroups()) {
+      for (const IdfExtensibleGroup& eg : searchPaths_->extensibleGroups()) {
         if (searchPath == eg.getString(0)) {
           newSearchPath = false;
           break;
@@ -93,7 +91,7 @@ namespace energyplus {
       }
 
       if (newSearchPath) {
-        it->pushExtensibleGroup({searchPath});
+        searchPaths_->pushExtensibleGroup({searchPath});
       }
     }
 
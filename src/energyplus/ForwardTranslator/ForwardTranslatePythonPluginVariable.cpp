@@ -14,8 +14,6 @@
 // #include "../../utilities/idd/IddEnums.hpp"
 #include <utilities/idd/IddEnums.hxx>
 
-#include <algorithm>
-
 using namespace openstudio::model;
 
 constexpr static auto pythonVariablesName = "Python Plugin Variables";
@@ -28,16 +26,16 @@ namespace energyplus {
 
     // Our objects are all translated to a single E+ PythonPlugin:Variables object which is extensible
 
-    auto it = std::find_if(m_idfObjects.begin(), m_idfObjects.end(), [](auto& idfObject) { return idfObject.nameString() == pythonVariablesName; });
-    if (it == m_idfObjects.end()) {
+    boost::optional<IdfObject> pluginVariables_ = findIdfObject(IddObjectType::PythonPlugin_Variables, pythonVariablesName);
+    if (!pluginVariables_) {
       auto& pluginVariables = m_idfObjects.emplace_back(openstudio::IddObjectType::PythonPlugin_Variables);
       pluginVariables.setName(pythonVariablesName);
       pluginVariables.pushExtensibleGroup({modelObject.nameString()});
       return pluginVariables;
     }
 
-    it->pushExtensibleGroup({modelObject.nameString()});
-    return *it;
+    pluginVariables_->pushExtensibleGroup({modelObject.nameString()});
+    return *pluginVariables_;
   }  // End of translate function
 
 }  // end namespace energyplus
@@ -36,6 +36,8 @@
 #include "../../model/CurveBiquadratic_Impl.hpp"
 #include "../../model/CurveQuadratic.hpp"
 #include "../../model/CurveQuadratic_Impl.hpp"
+#include "../../model/TableLookup.hpp"
+#include "../../model/TableIndependentVariable.hpp"
 #include "../../model/CoilCoolingDXSingleSpeed.hpp"
 #include "../../model/CoilCoolingDXSingleSpeed_Impl.hpp"
 #include "../../model/StandardOpaqueMaterial.hpp"
@@ -125,6 +127,72 @@ TEST_F(EnergyPlusFixture, ForwardTranslator_ExampleModel) {
   // workspace.save(toPath("./example.idf"), true);
 }
 
+TEST_F(EnergyPlusFixture, ForwardTranslator_TranslateModelToStream) {
+  Model model = exampleModel();
+
+  ForwardTranslator forwardTranslator;
+  Workspace workspace = forwardTranslator.translateModel(model);
+  std::stringstream workspaceText;
+  workspace.toIdfFile().print(workspaceText);
+
+  std::stringstream streamText;
+  EXPECT_TRUE(forwardTranslator.translateModelToStream(model, streamText));
+  EXPECT_EQ(workspaceText.str(), streamText.str());
+  EXPECT_EQ(0u, forwardTranslator.errors().size());
+
+  openstudio::path p = toPath("./ForwardTranslator_TranslateModelToFile.idf");
+  EXPECT_TRUE(forwardTranslator.translateModelToFile(model, p));
+  openstudio::filesystem::ifstream file(p, std::ios_base::binary);
+  std::stringstream fileText;
+  fileText << file.rdbuf();
+  EXPECT_EQ(workspaceText.str(), fileText.str());
+}
+
+TEST_F(EnergyPlusFixture, ForwardTranslator_NumThreads) {
+  Model model = exampleModel();
+  for (int i = 0; i < 200; ++i) {
+    CurveBiquadratic biquadratic(model);
+    biquadratic.setCoefficient2x(0.01 * i);
+    CurveQuadratic quadratic(model);
+    quadratic.setMinimumCurveOutput(-i);
+  }
+
+  // two tables sharing an independent variable, only the first one to be used can keep what it translated concurrently
+  TableIndependentVariable independentVariable(model);
+  independentVariable.addValue(70);
+  independentVariable.addValue(78);
+  for (int i = 0; i < 2; ++i) {
+    TableLookup tableLookup(model);
+    tableLookup.addOutputValue(0.1 * i);
+    tableLookup.addOutputValue(0.9);
+    tableLookup.addIndependentVariable(independentVariable);
+  }
+
+  ForwardTranslator serialTranslator;
+  EXPECT_EQ(1u, serialTranslator.numThreads());
+  Workspace serialWorkspace = serialTranslator.translateModel(model);
+  std::stringstream serialText;
+  serialWorkspace.toIdfFile().print(serialText);
+
+  for (unsigned numThreads : {2u, 4u, 0u}) {
+    ForwardTranslator parallelTranslator;
+    parallelTranslator.setNumThreads(numThreads);
+    Workspace parallelWorkspace = parallelTranslator.translateModel(model);
+    std::stringstream parallelText;
+    parallelWorkspace.toIdfFile().print(parallelText);
+    EXPECT_EQ(serialText.str(), parallelText.str());
+    // same messages, in the same order
+    auto expectSameMessages = [](const std::vector<LogMessage>& serialMessages, const std::vector<LogMessage>& parallelMessages) {
+      ASSERT_EQ(serialMessages.size(), parallelMessages.size());
+      for (std::size_t i = 0; i < serialMessages.size(); ++i) {
+        EXPECT_EQ(serialMessages[i].logMessage(), parallelMessages[i].logMessage());
+      }
+    };
+    expectSameMessages(serialTranslator.warnings(), parallelTranslator.warnings());
+    expectSameMessages(serialTranslator.errors(), parallelTranslator.errors());
+  }
+}
+
 TEST_F(EnergyPlusFixture, ForwardTranslatorTest_TranslateAirLoopHVAC) {
   openstudio::model::Model model;
   EXPECT_TRUE(model.getOptionalUniqueModelObject<Version>()) << "Blank model does not include a Version object.";
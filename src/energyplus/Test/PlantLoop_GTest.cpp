@@ -163,3 +163,33 @@ TEST_F(EnergyPlusFixture, ForwardTranslator_PlantLoop_createFluidProperties) {
     ASSERT_NO_THROW(ft.translateModel(m)) << "Failed for " << n << " PlantLoops";
   }
 }
+
+TEST_F(EnergyPlusFixture, ForwardTranslator_PlantLoop_createFluidProperties_Shared) {
+  Model m;
+
+  std::vector<std::pair<std::string, int>> glycols = {
+    {"PropyleneGlycol", 30}, {"EthyleneGlycol", 30}, {"PropyleneGlycol", 40}, {"PropyleneGlycol", 30}};
+  for (const auto& [glycolType, glycolConcentration] : glycols) {
+    PlantLoop p(m);
+    EXPECT_TRUE(p.setFluidType(glycolType));
+    EXPECT_TRUE(p.setGlycolConcentration(glycolConcentration));
+  }
+
+  ForwardTranslator ft;
+  Workspace w = ft.translateModel(m);
+
+  // loops with the same glycol share its FluidProperties objects
+  EXPECT_EQ(3u, w.getObjectsByType(IddObjectType::FluidProperties_Name).size());
+  EXPECT_EQ(3u, w.getObjectsByType(IddObjectType::FluidProperties_GlycolConcentration).size());
+
+  std::vector<WorkspaceObject> idf_plantLoops = w.getObjectsByType(IddObjectType::PlantLoop);
+  ASSERT_EQ(4u, idf_plantLoops.size());
+  std::map<std::string, int> numLoopsByFluid;
+  for (const auto& idf_plantLoop : idf_plantLoops) {
+    EXPECT_EQ("UserDefinedFluidType", idf_plantLoop.getString(PlantLoopFields::FluidType).get());
+    ++numLoopsByFluid[idf_plantLoop.getString(PlantLoopFields::UserDefinedFluidType).get()];
+  }
+  EXPECT_EQ(2, numLoopsByFluid["PropyleneGlycol_30"]);
+  EXPECT_EQ(1, numLoopsByFluid["EthyleneGlycol_30"]);
+  EXPECT_EQ(1, numLoopsByFluid["PropyleneGlycol_40"]);
+}
@@ -8,11 +8,17 @@
 #include "../ForwardTranslator.hpp"
 
 #include "../../model/Model.hpp"
+#include "../../model/CurveBiquadratic.hpp"
+#include "../../model/CurveQuadratic.hpp"
+#include "../../model/PlantLoop.hpp"
 
 #include "../../utilities/core/Logger.hpp"
 #include "../../utilities/core/FileLogSink.hpp"
+#include "../../utilities/idf/IdfFile.hpp"
 #include "../../utilities/idf/Workspace.hpp"
 
+#include <sstream>
+
 using namespace openstudio;
 using namespace openstudio::model;
 using namespace openstudio::energyplus;
@@ -58,6 +64,84 @@ static void BM_FT_ExampleModel_newFT(benchmark::State& state) {
   state.SetComplexityN(state.range(0));
 }
 
+static void BM_FT_ExampleModel_numThreads(benchmark::State& state) {
+
+  FileLogSink logFile(toPath("./ForwardTranslator_Benchmark.log"));
+  logFile.setLogLevel(Error);
+  openstudio::Logger::instance().standardOutLogger().disable();
+
+  // the curves and tables are what gets translated concurrently, a typical HVAC library carries a few thousands of them
+  Model model = exampleModel();
+  for (int i = 0; i < 2000; ++i) {
+    CurveBiquadratic biquadratic(model);
+    biquadratic.setCoefficient2x(0.01 * i);
+    CurveQuadratic quadratic(model);
+    quadratic.setCoefficient3xPOW2(0.01 * i);
+  }
+
+  ForwardTranslator forwardTranslator;
+  forwardTranslator.setNumThreads(static_cast<unsigned>(state.range(0)));
+
+  for (auto _ : state) {
+    Workspace workspace = forwardTranslator.translateModel(model);
+  }
+}
+
+static void BM_FT_ExampleModel_toWorkspaceText(benchmark::State& state) {
+
+  FileLogSink logFile(toPath("./ForwardTranslator_Benchmark.log"));
+  logFile.setLogLevel(Error);
+  openstudio::Logger::instance().standardOutLogger().disable();
+
+  Model model = exampleModel();
+  ForwardTranslator forwardTranslator;
+
+  for (auto _ : state) {
+    std::stringstream ss;
+    forwardTranslator.translateModel(model).toIdfFile().print(ss);
+    benchmark::DoNotOptimize(ss);
+  }
+}
+
+static void BM_FT_ExampleModel_toStream(benchmark::State& state) {
+
+  FileLogSink logFile(toPath("./ForwardTranslator_Benchmark.log"));
+  logFile.setLogLevel(Error);
+  openstudio::Logger::instance().standardOutLogger().disable();
+
+  Model model = exampleModel();
+  ForwardTranslator forwardTranslator;
+
+  for (auto _ : state) {
+    std::stringstream ss;
+    forwardTranslator.translateModelToStream(model, ss);
+    benchmark::DoNotOptimize(ss);
+  }
+}
+
+static void BM_FT_PlantLoops(benchmark::State& state) {
+
+  FileLogSink logFile(toPath("./ForwardTranslator_Benchmark.log"));
+  logFile.setLogLevel(Error);
+  openstudio::Logger::instance().standardOutLogger().disable();
+
+  // every glycol loop looks up its FluidProperties among the objects translated so far
+  Model model = exampleModel();
+  for (auto i = 0; i < state.range(0); ++i) {
+    PlantLoop plantLoop(model);
+    plantLoop.setFluidType(i % 2 == 0 ? "PropyleneGlycol" : "EthyleneGlycol");
+    plantLoop.setGlycolConcentration(30 + (i % 3) * 10);
+  }
+
+  ForwardTranslator forwardTranslator;
+
+  for (auto _ : state) {
+    Workspace workspace = forwardTranslator.translateModel(model);
+  }
+
+  state.SetComplexityN(state.range(0));
+}
+
 // Regular run, with n=512
 /*
 BENCHMARK(BM_WorkspaceSetNameWithChecks)->Unit(benchmark::kMillisecond)->Arg(512);
@@ -71,3 +155,10 @@ BENCHMARK(BM_WorkspaceSetNameWithoutAnyChecks)->Unit(benchmark::kMillisecond)->A
 BENCHMARK(BM_FT_ExampleModel_newFT)->Unit(benchmark::kMillisecond)->Ranges({{1, 256}, {0, 1}})->Complexity();
 
 BENCHMARK(BM_FT_ExampleModel_sameFT)->Unit(benchmark::kMillisecond)->Ranges({{1, 256}, {0, 1}})->Complexity();
+
+BENCHMARK(BM_FT_ExampleModel_numThreads)->Unit(benchmark::kMillisecond)->RangeMultiplier(2)->Range(1, 16);
+
+BENCHMARK(BM_FT_PlantLoops)->Unit(benchmark::kMillisecond)->RangeMultiplier(4)->Range(16, 1024)->Complexity();
+
+BENCHMARK(BM_FT_ExampleModel_toWorkspaceText)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_FT_ExampleModel_toStream)->Unit(benchmark::kMillisecond);
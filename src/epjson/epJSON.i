@@ -11,6 +11,8 @@
 
 // You're better off just loading the json directly in the target language, so ignore
 %ignore openstudio::epJSON::loadJSON;
+// std::ostream is not wrapped, use toJSONString
+%ignore openstudio::epJSON::toJSONStream;
 #ifdef SWIGCSHARP
 %ignore openstudio::epJSON::toJSON;
 #endif
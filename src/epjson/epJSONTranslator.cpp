@@ -7,17 +7,23 @@
 #include "../utilities/core/Assert.hpp"
 #include "../utilities/core/Logger.hpp"
 #include "../utilities/idd/IddEnums.hpp"
+#include "../utilities/idd/IddFileAndFactoryWrapper.hpp"
 #include "../utilities/idf/IdfFile.hpp"
 #include "../utilities/idf/Workspace.hpp"
 #include "../utilities/idf/WorkspaceObject.hpp"
-#include "../utilities/idf/IdfExtensibleGroup.hpp"
-#include "../utilities/idf/WorkspaceExtensibleGroup.hpp"
 #include "../utilities/core/ApplicationPathHelpers.hpp"
 
 #include <utilities/idd/IddEnums.hxx>
 
 #include <json/json.h>
 #include <fmt/format.h>
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <variant>
 #include <vector>
 #include <string_view>
 
@@ -114,13 +120,14 @@ const std::string& toJSONFieldName(std::map<std::string, std::string>& fieldName
   return cache_value(fieldNameInput, fieldName);
 }
 
+
 /** Locate the properties for a given object:
- *  schema root > properties > [type_description] (ObjectName) > patternProperties > "^.*\\S.*$" > properties */
+ *  schema root > properties > [type_description] (ObjectName) > patternProperties > "^.*\\S.*$" > properties
+ *  Returns null if the schema has no such object. */
 const Json::Value& getSchemaObjectProperties(const Json::Value& schema, const std::string& type_description) {
   const auto& patternProperties = safeLookupValue(schema, "properties", type_description, "patternProperties");
 
   if (!patternProperties.isObject()) {
-    LOG_FREE(LogLevel::Error, "epJSONTranslator", "Unable to find epJSON schema object for patternProperties for " << type_description);
     return patternProperties;
   }
 
@@ -152,133 +159,145 @@ JSONValueType schemaPropertyTypeDecode(const Json::Value& type) {
   return JSONValueType::NumberOrString;
 }
 
-/** Locate the properties for a given field of an object.
- * - group_name can be empty, or it's the name of the extensible group.
- * - field_name is the name of the field
- * - field_property_name is something like 'type', 'anyOf', or 'enum'
- *
- * if group_name is empty:
- *  getSchemaObjectProperties > [field_name] > [field_property_name]
- * else:
- *  getSchemaObjectProperties > [group_name] > items > properties > [field_name] > [field_property_name]
- */
-const Json::Value& getSchemaObjectFieldProperty(const Json::Value& schema, const std::string& type_description, const std::string& group_name,
-                                                const std::string& field_name, const std::string& field_property_name) {
-
-  const auto& objectProperties = getSchemaObjectProperties(schema, type_description);
-
-  if (group_name.empty()) {
-    return safeLookupValue(objectProperties, field_name, field_property_name);
-  } else {
-    return safeLookupValue(objectProperties, group_name, "items", "properties", field_name, field_property_name);
-  }
-}
+/** How the value of a field is matched to the casing of the schema, see fixupEnumerationValue */
+enum class EnumerationFixup
+{
+  None,
+  Choice,
+  MissingChoice,
+  Real
+};
 
-/** Find the 'type' property of a field and convert that to enum.*/
-JSONValueType getSchemaObjectFieldPropertyType(const Json::Value& schema, const std::string& type_description, const std::string& group_name,
-                                               const std::string& field_name) {
-  JSONValueType type = schemaPropertyTypeDecode(getSchemaObjectFieldProperty(schema, type_description, group_name, field_name, "type"));
-  if (type == JSONValueType::NumberOrString) {
-    LOG_FREE(LogLevel::Warn, "epJSONTranslator",
-             "Unknown value passed to schemaPropertyTypeDecode, returning generic 'NumberOrString' Option. "
-               << "Occurred for type_description= " << type_description << ", group_name=" << group_name << ", field_name=" << field_name);
-  }
-  return type;
-}
+/** What the schema says about one field of an object */
+struct FieldDescriptor
+{
+  // false for the name field, which is written separately, and for fields the schema has no name for
+  bool isWritten = false;
+  std::string name;
+  JSONValueType type = JSONValueType::NumberOrString;
+  // integral values are written as integers for Number fields only if the IDD field name has 'Number' in it
+  bool isNumberField = false;
+  EnumerationFixup fixup = EnumerationFixup::None;
+  // the enumeration of the schema, and its lower case values
+  std::vector<std::pair<std::string, std::string>> enumValues;
+};
 
-/** epJSON (unlike IDF) is case sensitive, so this routine find the correct 'enum' choice casing
- * It applies to fieldType = 'ChoiceType' or 'RealType' (since RealType can also be `anyOf` with values like 'Autosize' 'Autocalculate'))
- * eg: if given value='autosize', will convert it to 'Autosize' so that EnergyPlus' InputParser does recognize it */
-std::string fixupEnumerationValue(const Json::Value& schema, const std::string& value, const std::string& type_description,
-                                  const std::string& group_name, const std::string& field_name, const openstudio::IddFieldType fieldType) {
+/** The FieldDescriptors of an object type. If the extensible groups are an array of the schema, groupFields describes the fields of
+ *  the array items. Otherwise fields also describes the extensible fields, by field index, as named by legacy_idd. */
+struct ObjectDescriptor
+{
+  std::string typeDescription;
+  bool isInSchema = false;
+  bool isArrayGroup = false;
+  std::string groupName;
+  std::vector<FieldDescriptor> fields;
+  std::vector<FieldDescriptor> groupFields;
+};
 
-  if (fieldType == openstudio::IddFieldType::ChoiceType) {
-    const auto& fieldProperty = getSchemaObjectFieldProperty(schema, type_description, group_name, field_name, "enum");
-    const auto lower = boost::to_lower_copy(value);
+/** The ObjectDescriptors of all the object types of an IddFileType, by IddObjectType value. Compiled once per schema, see
+ *  compiledSchema. Catchall and UserCustom objects are not in there, their fields depend on the object. */
+struct CompiledSchema
+{
+  std::vector<ObjectDescriptor> objectDescriptors;
+};
 
-    if (fieldProperty.isNull()) {
-      LOG_FREE(LogLevel::Error, "epJSONTranslator", "Unable to find enum value for " << value << " in " << group_name << "::" << field_name)
-      return value;
-    }
+FieldDescriptor compileFieldDescriptor(const Json::Value& fieldProperties, const std::string& name, const openstudio::IddField& iddField) {
+  FieldDescriptor result;
+  result.isWritten = true;
+  result.name = name;
+  result.type = schemaPropertyTypeDecode(safeLookupValue(fieldProperties, "type"));
+  result.isNumberField = (iddField.name().find("Number") != std::string::npos);
 
-    for (const auto& enumOption : fieldProperty) {
+  const auto addEnumValues = [&result](const Json::Value& enumOptions) {
+    for (const auto& enumOption : enumOptions) {
       if (enumOption.isString()) {
-        const auto& enumStr = enumOption.asString();
-        if (boost::to_lower_copy(enumStr) == lower) {
-          return enumStr;
-        }
+        result.enumValues.emplace_back(enumOption.asString(), boost::to_lower_copy(enumOption.asString()));
       }
     }
+  };
 
-    // value wasn't found, so return passed-in value
-    return value;
-  }
-
-  if (fieldType == openstudio::IddFieldType::RealType) {
-
-    const auto& fieldProperty = getSchemaObjectFieldProperty(schema, type_description, group_name, field_name, "anyOf");
-
-    if (fieldProperty.isArray()) {
-      const auto lower = boost::to_lower_copy(value);
-
-      for (const auto& possibleValues : fieldProperty) {
-        const auto& enumOptions = possibleValues["enum"];
-        if (enumOptions.isArray()) {
-          for (const auto& enumOption : enumOptions) {
-            if (enumOption.isString()) {
-              const auto& enumStr = enumOption.asString();
-              const auto lowerEnumStr = boost::to_lower_copy(enumStr);
-
-              if (lowerEnumStr == lower) {
-                return enumStr;
-              }
-
-              if (lowerEnumStr.find("auto") == 0 && lower.find("auto") == 0) {
-                // it's the "auto" option, return it
-                return enumStr;
-              }
-            }
-          }
+  // epJSON (unlike IDF) is case sensitive, so the values of 'ChoiceType' fields are matched to the casing of their 'enum', and those of
+  // 'RealType' fields to the 'enum' of their 'anyOf' (for values like 'Autosize' 'Autocalculate')
+  const auto fieldType = iddField.properties().type;
+  if (fieldType == openstudio::IddFieldType::ChoiceType) {
+    const auto& enumOptions = safeLookupValue(fieldProperties, "enum");
+    if (enumOptions.isNull()) {
+      result.fixup = EnumerationFixup::MissingChoice;
+    } else {
+      result.fixup = EnumerationFixup::Choice;
+      addEnumValues(enumOptions);
+    }
+  } else if (fieldType == openstudio::IddFieldType::RealType) {
+    result.fixup = EnumerationFixup::Real;
+    const auto& anyOf = safeLookupValue(fieldProperties, "anyOf");
+    if (anyOf.isArray()) {
+      for (const auto& possibleValues : anyOf) {
+        if (possibleValues.isObject() && possibleValues["enum"].isArray()) {
+          addEnumValues(possibleValues["enum"]);
         }
       }
     }
-
-    // value wasn't found, so return passed-in value
-    return value;
   }
 
-  // Not a real or enumeration type, return value
-  return value;
+  return result;
 }
 
-/* Find name of an extensible group and cache it */
-auto getGroupName(std::map<std::pair<std::string, std::string>, std::pair<std::string, bool>>& group_names,
-                  std::map<std::string, std::string>& /*field_names*/, const Json::Value& schema, const std::string& type_description,
-                  const std::string& group_name) -> const auto& {
-
-  const auto key = std::pair{type_description, group_name};
+ObjectDescriptor compileObjectDescriptor(const Json::Value& schema, const openstudio::IddObject& iddObject,
+                                         std::map<std::string, std::string>& field_names) {
+  ObjectDescriptor result;
+  result.typeDescription = iddObject.type().valueDescription();
+  const auto& type_description = result.typeDescription;
+  const auto& objectProperties = getSchemaObjectProperties(schema, type_description);
+  result.isInSchema = !objectProperties.isNull();
 
-  if (const auto cached = group_names.find(key); cached != group_names.end()) {
-    return cached->second;
+  const auto nonextensibleFields = iddObject.nonextensibleFields();
+  for (const auto& iddField : nonextensibleFields) {
+    if (iddField.isNameField()) {
+      result.fields.emplace_back();
+      continue;
+    }
+    const auto& fieldName = toJSONFieldName(field_names, iddField.name());
+    result.fields.push_back(compileFieldDescriptor(safeLookupValue(objectProperties, fieldName), fieldName, iddField));
   }
 
-  const auto cache_result = [&](const auto& name, const bool is_array) -> const auto& {
-    return group_names.emplace(key, std::pair{name, is_array}).first->second;
-  };
-
-  const auto& objectProperties = getSchemaObjectProperties(schema, type_description);
+  const auto extensibleGroup = iddObject.extensibleGroup();
+  if (extensibleGroup.empty()) {
+    return result;
+  }
 
   for (const auto& propertyName : objectProperties.getMemberNames()) {
     const auto& type = safeLookupValue(objectProperties, propertyName, "type");
-    if (type.isString()) {
-      if (type.asString() == "array") {
-        return cache_result(propertyName, true);
+    if (type.isString() && (type.asString() == "array")) {
+      result.isArrayGroup = true;
+      result.groupName = propertyName;
+      break;
+    }
+  }
+
+  if (result.isArrayGroup) {
+    for (const auto& iddField : extensibleGroup) {
+      const auto& fieldName = toJSONFieldName(field_names, iddField.name());
+      result.groupFields.push_back(
+        compileFieldDescriptor(safeLookupValue(objectProperties, result.groupName, "items", "properties", fieldName), fieldName, iddField));
+    }
+  } else {
+    // OpenStudio treats all groups as extensible, the schema names each of these fields in legacy_idd
+    const auto& legacyFieldNames = getSchemaFieldNames(schema, type_description);
+    if (legacyFieldNames.isArray()) {
+      for (auto i = static_cast<Json::ArrayIndex>(nonextensibleFields.size()); i < legacyFieldNames.size(); ++i) {
+        const auto& legacyFieldName = legacyFieldNames[i];
+        if (!legacyFieldName.isString()) {
+          result.fields.emplace_back();
+          continue;
+        }
+        const auto& iddField = extensibleGroup[(i - nonextensibleFields.size()) % extensibleGroup.size()];
+        result.fields.push_back(compileFieldDescriptor(safeLookupValue(objectProperties, legacyFieldName.asString()), legacyFieldName.asString(),
+                                                       iddField));
       }
     }
   }
 
-  // group name is irrelevant if it's not an array group
-  return cache_result("", false);
+  return result;
 }
 
 openstudio::path defaultSchemaPath(openstudio::IddFileType filetype) {
@@ -306,190 +325,288 @@ Json::Value loadJSON(const openstudio::path& path) {
   return root;
 }
 
-std::string getFieldName(const bool is_array, const IddObject& iddObject, const Json::Value& schema, const std::string& type_description,
-                         const std::size_t group_number, const std::size_t field_number, std::string_view field_name) {
-  if (is_array) {
-    return std::string{field_name};
-  }
-
-  // Legacy IDD field names
-  const auto& fieldNames = getSchemaFieldNames(schema, type_description);
-
-  // use the index of the field inside of the IddObject to look up what its name should be
-  // inside of the epJSON schema
-  //
-  // This is (partially) necessary because OpenStudio treats all groups as extensible.
-  const auto& lookedUpFieldName =
-    fieldNames[static_cast<int>((group_number - 1) * iddObject.extensibleGroup().size() + field_number + iddObject.nonextensibleFields().size())];
-
-  LOG_FREE(LogLevel::Error, "epJSONTranslator", "Unable to look up field name for input field" << field_name)
-  OS_ASSERT(lookedUpFieldName.isString());
-  return lookedUpFieldName.asString();
-}
-
-Json::Value toJSON(const openstudio::IdfFile& idf, const openstudio::path& schemaPath) {
-
+/* Returns the schema at schemaPath, or the default one for iddFileType if schemaPath is empty, compiled for the object types of
+ * iddFileType. The schema is loaded and compiled on first use only, and kept for the life of the process. Returns nullptr if it cannot be
+ * loaded. */
+std::shared_ptr<const CompiledSchema> compiledSchema(const openstudio::path& schemaPath, openstudio::IddFileType iddFileType) {
   openstudio::path schemaToLoad = schemaPath;
   if (schemaToLoad.empty()) {
-    schemaToLoad = defaultSchemaPath(idf.iddFileType());
+    schemaToLoad = defaultSchemaPath(iddFileType);
     if (schemaToLoad.empty()) {
-      return Json::Value::null;
+      return nullptr;
     }
   }
 
-  std::map<std::string, int> type_counts;
-
-  Json::Value result;
+  static std::mutex cacheMutex;
+  static std::map<std::pair<int, openstudio::path>, std::shared_ptr<const CompiledSchema>> cache;
 
-  std::map<std::pair<std::string, std::string>, std::pair<std::string, bool>> group_names;
-  std::map<std::string, std::string> field_names;
+  std::unique_lock l{cacheMutex};
+  const auto key = std::make_pair(iddFileType.value(), schemaToLoad);
+  if (const auto it = cache.find(key); it != cache.end()) {
+    return it->second;
+  }
 
-  Json::Value schema = loadJSON(schemaToLoad);
+  const Json::Value schema = loadJSON(schemaToLoad);
   if (schema.isNull()) {
     LOG_FREE(LogLevel::Error, "epJSONTranslator", "Schema is invalid at path=" << schemaToLoad);
-    return Json::Value::null;
+    return nullptr;
   }
 
-  result["Version"]["Version 1"]["version_identifier"] = fmt::format("{}.{}", idf.version().major(), idf.version().minor());
-
-  for (const auto& obj : idf.objects()) {
-    if (obj.iddObject().type().value() == openstudio::IddObjectType::CommentOnly) {
-      // we aren't translating comments it seems
-      continue;
+  auto result = std::make_shared<CompiledSchema>();
+  if (iddFileType != openstudio::IddFileType::UserCustom) {
+    std::map<std::string, std::string> field_names;
+    for (const auto& iddObject : openstudio::IddFileAndFactoryWrapper(iddFileType).objects()) {
+      const auto type = iddObject.type();
+      if ((type == openstudio::IddObjectType::Catchall) || (type == openstudio::IddObjectType::UserCustom)) {
+        continue;
+      }
+      const auto index = static_cast<std::size_t>(type.value());
+      if (index >= result->objectDescriptors.size()) {
+        result->objectDescriptors.resize(index + 1);
+      }
+      result->objectDescriptors[index] = compileObjectDescriptor(schema, iddObject, field_names);
     }
+  }
 
-    const auto& type_description = obj.iddObject().type().valueDescription();
-
-    const auto& name = obj.name();
-    const auto& defaultedName = obj.nameString(true);
+  cache.emplace(key, result);
+  return result;
+}
 
-    auto& json_group = result[type_description];
+/* The ObjectDescriptor of iddObject. Types that are not in compiledSchema are compiled into uncachedDescriptor, against no schema, as
+ * the schema has no such object type */
+const ObjectDescriptor& objectDescriptor(const CompiledSchema& compiledSchema, const openstudio::IddObject& iddObject,
+                                         ObjectDescriptor& uncachedDescriptor) {
+  const auto index = static_cast<std::size_t>(iddObject.type().value());
+  if ((index < compiledSchema.objectDescriptors.size()) && !compiledSchema.objectDescriptors[index].typeDescription.empty()) {
+    return compiledSchema.objectDescriptors[index];
+  }
+  std::map<std::string, std::string> field_names;
+  uncachedDescriptor = compileObjectDescriptor(Json::Value::null, iddObject, field_names);
+  return uncachedDescriptor;
+}
 
-    const bool is_fluid_properties_name = type_description.find("FluidProperties:Name") != std::string::npos;
-    const bool is_lcc_use_price_escalation = type_description.find("LifeCycleCost:UsePriceEscalation") != std::string::npos;
+/* Returns value in the casing of the enumeration of fieldDescriptor, if it is there */
+std::string fixupEnumerationValue(const FieldDescriptor& fieldDescriptor, const std::string& value, const std::string& type_description) {
+  switch (fieldDescriptor.fixup) {
+    case EnumerationFixup::None:
+      return value;
+    case EnumerationFixup::MissingChoice:
+      LOG_FREE(LogLevel::Error, "epJSONTranslator", "Unable to find enum value for " << value << " in " << type_description << "::" << fieldDescriptor.name)
+      return value;
+    case EnumerationFixup::Choice: {
+      const auto lower = boost::to_lower_copy(value);
+      for (const auto& [enumStr, lowerEnumStr] : fieldDescriptor.enumValues) {
+        if (lowerEnumStr == lower) {
+          return enumStr;
+        }
+      }
+      return value;
+    }
+    case EnumerationFixup::Real: {
+      const auto lower = boost::to_lower_copy(value);
+      for (const auto& [enumStr, lowerEnumStr] : fieldDescriptor.enumValues) {
+        if ((lowerEnumStr == lower) || ((lowerEnumStr.find("auto") == 0) && (lower.find("auto") == 0))) {
+          // it's the "auto" option, return it
+          return enumStr;
+        }
+      }
+      return value;
+    }
+  }
+  return value;
+}
 
-    const auto& usable_json_object_name = [&]() {
-      if (name && !is_fluid_properties_name) {
-        return *name;
-      } else {
-        if (!defaultedName.empty() && !is_fluid_properties_name) {
-          return defaultedName;
-        } else {
-          return fmt::format("{} {}", type_description, ++type_counts[type_description]);
+/* The value of a member of an epJSON object, std::monostate stands for the array of extensible groups */
+using JSONMemberValue = std::variant<std::monostate, std::string, int, double>;
+using JSONMembers = std::vector<std::pair<const std::string*, JSONMemberValue>>;
+
+/* Returns the value of the field at index, if any. The JSON type of the schema is tried first, then the next ones down */
+JSONMemberValue fieldValue(const openstudio::IdfObject& obj, unsigned index, const FieldDescriptor& fieldDescriptor,
+                           const std::string& type_description) {
+  switch (fieldDescriptor.type) {
+    case JSONValueType::String: {
+      const auto fieldString = obj.getString(index);
+      if (fieldString && !fieldString->empty()) {
+        return fixupEnumerationValue(fieldDescriptor, *fieldString, type_description);
+      }
+    }
+    case JSONValueType::Integer: {
+      const auto fieldInt = obj.getInt(index);
+      if (fieldInt) {
+        return *fieldInt;
+      }
+    }
+    case JSONValueType::Number:
+    case JSONValueType::NumberOrString: {
+      const auto fieldDouble = obj.getDouble(index);
+      if (fieldDouble) {
+        if (fieldDescriptor.isNumberField) {
+          const auto fieldInt = obj.getInt(index);
+          if (fieldInt && static_cast<double>(*fieldInt) == *fieldDouble) {
+            return *fieldInt;
+          }
         }
+        return *fieldDouble;
       }
-    }();
+    }
+    case JSONValueType::Array:
+    case JSONValueType::Object:
+      break;
+  }
 
-    auto& json_object = json_group[usable_json_object_name];
-    json_object = Json::Value(Json::objectValue);
+  const auto fieldString = obj.getString(index);
+  if (fieldString && !fieldString->empty()) {
+    return fixupEnumerationValue(fieldDescriptor, *fieldString, type_description);
+  }
 
-    if (name) {
-      if (is_fluid_properties_name) {
-        json_object["fluid_name"] = *name;
-      } else if (is_lcc_use_price_escalation) {
-        json_object["lcc_price_escalation_name"] = *name;
-      }
+  return std::monostate{};
+}
+
+/* Returns the name of obj in its epJSON object type */
+std::string jsonObjectName(const openstudio::IdfObject& obj, const std::string& type_description, std::map<std::string, int>& type_counts) {
+  const bool is_fluid_properties_name = type_description.find("FluidProperties:Name") != std::string::npos;
+
+  if (const auto name = obj.name(); name && !is_fluid_properties_name) {
+    return *name;
+  }
+  if (auto defaultedName = obj.nameString(true); !defaultedName.empty() && !is_fluid_properties_name) {
+    return defaultedName;
+  }
+  return fmt::format("{} {}", type_description, ++type_counts[type_description]);
+}
+
+/* Collects the members of the epJSON object of obj, in the order they are set. groups are the items of the array of extensible groups */
+void collectMembers(const openstudio::IdfObject& obj, const ObjectDescriptor& objectDescriptor, JSONMembers& members,
+                    std::vector<JSONMembers>& groups) {
+  static const std::string fluidName("fluid_name");
+  static const std::string lccPriceEscalationName("lcc_price_escalation_name");
+
+  const auto& type_description = objectDescriptor.typeDescription;
+  if (!objectDescriptor.isInSchema) {
+    LOG_FREE(LogLevel::Error, "epJSONTranslator", "Unable to find epJSON schema object for patternProperties for " << type_description);
+  }
+
+  if (const auto name = obj.name()) {
+    if (type_description.find("FluidProperties:Name") != std::string::npos) {
+      members.emplace_back(&fluidName, *name);
+    } else if (type_description.find("LifeCycleCost:UsePriceEscalation") != std::string::npos) {
+      members.emplace_back(&lccPriceEscalationName, *name);
     }
+  }
 
-    const auto visitField = [&schema, &type_description](auto&& visitor, const openstudio::IddField& iddField, const std::string& group_name,
-                                                         const auto& fieldName, const auto& field, const auto idx) -> bool {
-      const auto jsonFieldType = getSchemaObjectFieldPropertyType(schema, type_description, group_name, fieldName);
+  const auto& iddObject = obj.iddObject();
+  const unsigned numFields = obj.numFields();
+  const unsigned numNonextensibleFields = iddObject.nonextensibleFields().size();
 
-      switch (jsonFieldType) {
-        case JSONValueType::String: {
-          const auto fieldString = field.getString(idx);
-          if (fieldString && !fieldString->empty()) {
-            visitor(fixupEnumerationValue(schema, *fieldString, type_description, group_name, fieldName, iddField.properties().type));
-            return true;
-          }
+  // extensible groups first
+  if (numFields > numNonextensibleFields) {
+    const unsigned groupSize = iddObject.extensibleGroup().size();
+    if (objectDescriptor.isArrayGroup) {
+      members.emplace_back(&objectDescriptor.groupName, std::monostate{});
+    }
+    for (unsigned index = numNonextensibleFields; index < numFields; ++index) {
+      const unsigned groupIndex = (index - numNonextensibleFields) % groupSize;
+      if (objectDescriptor.isArrayGroup) {
+        if (groupIndex == 0) {
+          groups.emplace_back();
         }
-        case JSONValueType::Integer: {
-          const auto fieldInt = field.getInt(idx);
-          if (fieldInt) {
-            visitor(*fieldInt);
-            return true;
-          }
+        if (groupIndex >= objectDescriptor.groupFields.size()) {
+          LOG_FREE(LogLevel::Error, "epJSONTranslator",
+                   "Unable to look up field name for field " << index << " of " << type_description << " named '" << obj.nameString() << "'");
+          continue;
         }
-        case JSONValueType::Number:
-        case JSONValueType::NumberOrString: {
-          const auto fieldDouble = field.getDouble(idx);
-
-          if (fieldDouble) {
-            const auto fieldInt = field.getInt(idx);
-
-            if (fieldInt && static_cast<double>(*fieldInt) == *fieldDouble) {
-              if (iddField.name().find("Number") != std::string::npos) {
-                visitor(*fieldInt);
-                return true;
-              }
-            }
-
-            visitor(*fieldDouble);
-            return true;
+        const auto& fieldDescriptor = objectDescriptor.groupFields[groupIndex];
+        auto value = fieldValue(obj, index, fieldDescriptor, type_description);
+        if (!std::holds_alternative<std::monostate>(value)) {
+          groups.back().emplace_back(&fieldDescriptor.name, std::move(value));
+        }
+      } else if (index < objectDescriptor.fields.size()) {
+        const auto& fieldDescriptor = objectDescriptor.fields[index];
+        if (fieldDescriptor.isWritten) {
+          auto value = fieldValue(obj, index, fieldDescriptor, type_description);
+          if (!std::holds_alternative<std::monostate>(value)) {
+            members.emplace_back(&fieldDescriptor.name, std::move(value));
           }
         }
-        case JSONValueType::Array:
-        case JSONValueType::Object:
-          break;
+      } else {
+        LOG_FREE(LogLevel::Error, "epJSONTranslator",
+                 "Unable to look up field name for field " << index << " of " << type_description << " named '" << obj.nameString() << "'");
       }
+    }
+  }
 
-      {
-        const auto fieldString = field.getString(idx);
-        if (fieldString && !fieldString->empty()) {
-          visitor(fixupEnumerationValue(schema, *fieldString, type_description, group_name, fieldName, iddField.properties().type));
-
-          return true;
-        }
-      }
+  // the descriptor is compiled from the IddObject of the factory, obj may have another one with more fields
+  for (unsigned index = 0; index < std::min(numFields, numNonextensibleFields); ++index) {
+    if (index >= objectDescriptor.fields.size()) {
+      LOG_FREE(LogLevel::Error, "epJSONTranslator",
+               "Unable to look up field name for field " << index << " of " << type_description << " named '" << obj.nameString() << "'");
+      continue;
+    }
+    const auto& fieldDescriptor = objectDescriptor.fields[index];
+    if (!fieldDescriptor.isWritten) {
+      continue;
+    }
+    auto value = fieldValue(obj, index, fieldDescriptor, type_description);
+    if (!std::holds_alternative<std::monostate>(value)) {
+      members.emplace_back(&fieldDescriptor.name, std::move(value));
+    }
+  }
+}
 
-      return false;
-    };
+Json::Value toJSONValue(const JSONMemberValue& value) {
+  if (const auto* s = std::get_if<std::string>(&value)) {
+    return *s;
+  } else if (const auto* i = std::get_if<int>(&value)) {
+    return *i;
+  }
+  return std::get<double>(value);
+}
 
-    std::size_t cur_group_number = 0;
+Json::Value toJSON(const openstudio::IdfFile& idf, const openstudio::path& schemaPath) {
 
-    for (const auto& g : obj.extensibleGroups()) {
-      ++cur_group_number;
-      // get first field and try to make a group name out of it
-      const auto& [group_name, is_array_group] =
-        openstudio::epJSON::getGroupName(group_names, field_names, schema, type_description, obj.iddObject().extensibleGroup()[0].name());
+  const auto schema = compiledSchema(schemaPath, idf.iddFileType());
+  if (!schema) {
+    return Json::Value::null;
+  }
 
-      auto& containing_json = [&json_object, &group_name = group_name, is_array_group = is_array_group ]() -> auto& {
-        if (is_array_group) {
-          auto& array_obj = json_object[group_name];
-          return array_obj.append(Json::Value{Json::objectValue});
-        } else {
-          return json_object;
-        }
-      }
-      ();
+  std::map<std::string, int> type_counts;
+  ObjectDescriptor uncachedDescriptor;
+  JSONMembers members;
+  std::vector<JSONMembers> groups;
 
-      for (unsigned int idx = 0; idx < g.numFields(); ++idx) {
-        const auto& iddField = obj.iddObject().extensibleGroup()[idx];
+  Json::Value result;
 
-        const auto fieldName = getFieldName(is_array_group, obj.iddObject(), schema, type_description, cur_group_number, idx,
-                                            toJSONFieldName(field_names, iddField.name()));
+  result["Version"]["Version 1"]["version_identifier"] = fmt::format("{}.{}", idf.version().major(), idf.version().minor());
 
-        [[maybe_unused]] const auto fieldAdded = visitField([&containing_json, &fieldName](const auto& value) { containing_json[fieldName] = value; },
-                                                            iddField, group_name, fieldName, g, idx);
-      }
+  for (const auto& obj : idf.objects()) {
+    if (obj.iddObject().type().value() == openstudio::IddObjectType::CommentOnly) {
+      // we aren't translating comments it seems
+      continue;
     }
 
-    for (unsigned int idx = 0; idx < obj.numFields(); ++idx) {
-      const auto& iddField = obj.iddObject().getField(idx);
+    const auto& objectDescriptor = openstudio::epJSON::objectDescriptor(*schema, obj.iddObject(), uncachedDescriptor);
+    const auto& type_description = objectDescriptor.typeDescription;
 
-      const auto& fieldName = toJSONFieldName(field_names, iddField->name());
-
-      if (iddField->isNameField()) {
-        // skip name, we already got that
-        continue;
-      }
+    auto& json_object = result[type_description][jsonObjectName(obj, type_description, type_counts)];
+    json_object = Json::Value(Json::objectValue);
 
-      if (obj.iddObject().isExtensibleField(idx)) {
-        // skip extensible field, we already dealt with that
-        continue;
+    members.clear();
+    groups.clear();
+    collectMembers(obj, objectDescriptor, members, groups);
+
+    for (const auto& [name, value] : members) {
+      if (std::holds_alternative<std::monostate>(value)) {
+        auto& array_obj = json_object[*name];
+        array_obj = Json::Value(Json::arrayValue);
+        for (const auto& group : groups) {
+          auto& json_group = array_obj.append(Json::Value{Json::objectValue});
+          for (const auto& [groupFieldName, groupFieldValue] : group) {
+            json_group[*groupFieldName] = toJSONValue(groupFieldValue);
+          }
+        }
+      } else {
+        json_object[*name] = toJSONValue(value);
       }
-
-      visitField([&json_object, &fieldName](const auto& value) { json_object[fieldName] = value; }, iddField.get(), "", fieldName, obj, idx);
     }
   }
   return result;
@@ -507,4 +624,192 @@ std::string toJSONString(const openstudio::Workspace& workspace, const openstudi
   return toJSON(workspace, schemaPath).toStyledString();
 }
 
+/* jsoncpp keeps the members of an object sorted by name, and the last value set to a name wins */
+void sortMembers(JSONMembers& members) {
+  std::stable_sort(members.begin(), members.end(), [](const auto& lhs, const auto& rhs) { return *lhs.first < *rhs.first; });
+  auto last = members.begin();
+  for (auto it = members.begin(); it != members.end(); ++it) {
+    if ((std::next(it) == members.end()) || (*std::next(it)->first != *it->first)) {
+      if (last != it) {
+        *last = std::move(*it);
+      }
+      ++last;
+    }
+  }
+  members.erase(last, members.end());
+}
+
+void writeJSONString(std::ostream& os, std::string_view value) {
+  os << '"';
+  std::size_t begin = 0;
+  for (std::size_t i = 0; i < value.size(); ++i) {
+    const auto c = static_cast<unsigned char>(value[i]);
+    if ((c >= 0x20) && (c != '"') && (c != '\\')) {
+      continue;
+    }
+    os.write(value.data() + begin, static_cast<std::streamsize>(i - begin));
+    begin = i + 1;
+    switch (c) {
+      case '"':
+        os << "\\\"";
+        break;
+      case '\\':
+        os << "\\\\";
+        break;
+      case '\b':
+        os << "\\b";
+        break;
+      case '\f':
+        os << "\\f";
+        break;
+      case '\n':
+        os << "\\n";
+        break;
+      case '\r':
+        os << "\\r";
+        break;
+      case '\t':
+        os << "\\t";
+        break;
+      default:
+        os << fmt::format("\\u{:04x}", static_cast<unsigned>(c));
+        break;
+    }
+  }
+  os.write(value.data() + begin, static_cast<std::streamsize>(value.size() - begin));
+  os << '"';
+}
+
+/* Writes doubles the way jsoncpp does: always with a decimal point or an exponent, and non finite values as null or out of range */
+void writeJSONDouble(std::ostream& os, double value) {
+  if (std::isnan(value)) {
+    os << "null";
+  } else if (std::isinf(value)) {
+    os << ((value < 0) ? "-1e+9999" : "1e+9999");
+  } else {
+    auto text = fmt::format("{}", value);
+    if (text.find_first_of(".e") == std::string::npos) {
+      text += ".0";
+    }
+    os << text;
+  }
+}
+
+void writeJSONMembers(std::ostream& os, const JSONMembers& members, const std::vector<JSONMembers>& groups, unsigned indent);
+
+void writeJSONValue(std::ostream& os, const JSONMemberValue& value, const std::vector<JSONMembers>& groups, unsigned indent) {
+  if (const auto* s = std::get_if<std::string>(&value)) {
+    writeJSONString(os, *s);
+  } else if (const auto* i = std::get_if<int>(&value)) {
+    os << *i;
+  } else if (const auto* d = std::get_if<double>(&value)) {
+    writeJSONDouble(os, *d);
+  } else {
+    const std::string itemIndent((indent + 1) * 3, ' ');
+    os << "[\n";
+    for (std::size_t i = 0; i < groups.size(); ++i) {
+      os << itemIndent;
+      writeJSONMembers(os, groups[i], {}, indent + 1);
+      os << ((i + 1 < groups.size()) ? ",\n" : "\n");
+    }
+    os << std::string(indent * 3, ' ') << ']';
+  }
+}
+
+/* Writes an object, members must be sorted. indent is the level of the opening brace */
+void writeJSONMembers(std::ostream& os, const JSONMembers& members, const std::vector<JSONMembers>& groups, unsigned indent) {
+  if (members.empty()) {
+    os << "{}";
+    return;
+  }
+  const std::string memberIndent((indent + 1) * 3, ' ');
+  os << "{\n";
+  for (std::size_t i = 0; i < members.size(); ++i) {
+    os << memberIndent;
+    writeJSONString(os, *members[i].first);
+    os << " : ";
+    writeJSONValue(os, members[i].second, groups, indent + 1);
+    os << ((i + 1 < members.size()) ? ",\n" : "\n");
+  }
+  os << std::string(indent * 3, ' ') << '}';
+}
+
+/* Writes the epJSON object of obj, at indent level 2 */
+void writeJSONObject(std::ostream& os, const openstudio::IdfObject& obj, const ObjectDescriptor& objectDescriptor, JSONMembers& members,
+                     std::vector<JSONMembers>& groups) {
+  members.clear();
+  groups.clear();
+  collectMembers(obj, objectDescriptor, members, groups);
+
+  for (auto& group : groups) {
+    sortMembers(group);
+  }
+  sortMembers(members);
+  writeJSONMembers(os, members, groups, 2);
+}
+
+/* Writes what toJSON returns for these objects to os, objects are IdfObjects or WorkspaceObjects */
+template <typename ObjectVector>
+void writeJSON(std::ostream& os, const CompiledSchema& schema, const openstudio::VersionString& version, const ObjectVector& objects) {
+  // object names by type, as jsoncpp sorts them. The version is not one of the objects, it is none here
+  std::map<std::string, std::map<std::string, boost::optional<openstudio::IdfObject>>> objectsByType;
+  objectsByType["Version"].emplace("Version 1", boost::none);
+
+  std::map<std::string, int> type_counts;
+  for (const auto& obj : objects) {
+    if (obj.iddObject().type() == openstudio::IddObjectType::CommentOnly) {
+      continue;
+    }
+
+    const auto& type_description = obj.iddObject().type().valueDescription();
+    // an object with the same type and name replaces the previous one
+    objectsByType[type_description][jsonObjectName(obj, type_description, type_counts)] = openstudio::IdfObject(obj);
+  }
+
+  ObjectDescriptor uncachedDescriptor;
+  JSONMembers members;
+  std::vector<JSONMembers> groups;
+
+  os << "{\n";
+  for (auto typeIt = objectsByType.begin(); typeIt != objectsByType.end(); ++typeIt) {
+    os << "   ";
+    writeJSONString(os, typeIt->first);
+    os << " : {\n";
+    for (auto objectIt = typeIt->second.begin(); objectIt != typeIt->second.end(); ++objectIt) {
+      os << "      ";
+      writeJSONString(os, objectIt->first);
+      os << " : ";
+      if (objectIt->second) {
+        writeJSONObject(os, *objectIt->second, objectDescriptor(schema, objectIt->second->iddObject(), uncachedDescriptor), members, groups);
+      } else {
+        os << "{\n         \"version_identifier\" : ";
+        writeJSONString(os, fmt::format("{}.{}", version.major(), version.minor()));
+        os << "\n      }";
+      }
+      os << ((std::next(objectIt) != typeIt->second.end()) ? ",\n" : "\n");
+    }
+    os << "   }" << ((std::next(typeIt) != objectsByType.end()) ? ",\n" : "\n");
+  }
+  os << "}\n";
+}
+
+bool toJSONStream(const openstudio::IdfFile& inputFile, std::ostream& os, const openstudio::path& schemaPath) {
+  const auto schema = compiledSchema(schemaPath, inputFile.iddFileType());
+  if (!schema) {
+    return false;
+  }
+  writeJSON(os, *schema, inputFile.version(), inputFile.objects());
+  return true;
+}
+
+bool toJSONStream(const openstudio::Workspace& workspace, std::ostream& os, const openstudio::path& schemaPath) {
+  const auto schema = compiledSchema(schemaPath, workspace.iddFileType());
+  if (!schema) {
+    return false;
+  }
+  // same objects, in the same order, as Workspace::toIdfFile
+  writeJSON(os, *schema, workspace.version(), workspace.objects(true));
+  return true;
+}
+
 }  // namespace openstudio::epJSON
@@ -6,6 +6,7 @@
 #ifndef EPJSON_TRANSLATOR_HPP
 #define EPJSON_TRANSLATOR_HPP
 
+#include <iosfwd>
 #include <string>
 #include "epJSONAPI.hpp"
 
@@ -27,12 +28,21 @@ EPJSON_API openstudio::path defaultSchemaPath(openstudio::IddFileType filetype);
 
 EPJSON_API Json::Value loadJSON(const openstudio::path& path);
 
+/** The schema, at schemaPath or the default one, is loaded and compiled into field descriptors on first use only, and reused by all later
+ *  calls for the life of the process. */
 EPJSON_API Json::Value toJSON(const openstudio::IdfFile& inputFile, const openstudio::path& schemaPath = openstudio::path());
 EPJSON_API std::string toJSONString(const openstudio::IdfFile& inputFile, const openstudio::path& schemaPath = openstudio::path());
 
 EPJSON_API Json::Value toJSON(const openstudio::Workspace& workspace, const openstudio::path& schemaPath = openstudio::path());
 EPJSON_API std::string toJSONString(const openstudio::Workspace& workspace, const openstudio::path& schemaPath = openstudio::path());
 
+/** Writes the epJSON of inputFile to os as it goes, without building the Json::Value that toJSON returns. Objects and fields are
+ *  written in the same order as toJSONString. Returns false if the schema cannot be loaded, nothing is written then. */
+EPJSON_API bool toJSONStream(const openstudio::IdfFile& inputFile, std::ostream& os, const openstudio::path& schemaPath = openstudio::path());
+
+/** Writes the epJSON of workspace to os, reading its objects directly rather than through Workspace::toIdfFile. */
+EPJSON_API bool toJSONStream(const openstudio::Workspace& workspace, std::ostream& os, const openstudio::path& schemaPath = openstudio::path());
+
 }  // namespace openstudio::epJSON
 
 #endif
@@ -30,6 +30,8 @@
 #include <json/json.h>
 #include <resources.hxx>
 #include <algorithm>
+#include <future>
+#include <sstream>
 
 TEST_F(epJSONFixture, TranslateIDFToEPJSON_RefBldgMediumOfficeNew2004_Chicago) {
   compareEPJSONTranslations("RefBldgMediumOfficeNew2004_Chicago.idf");
@@ -173,6 +175,61 @@ TEST_F(epJSONFixture, canTranslateWorkspaceToJSON) {
   EXPECT_TRUE(str1.size() > 100);
 }
 
+TEST_F(epJSONFixture, toJSONStream) {
+
+  const auto parseStream = [](const std::stringstream& ss) {
+    Json::Value root;
+    Json::CharReaderBuilder builder;
+    JSONCPP_STRING errs;
+    std::istringstream is(ss.str());
+    EXPECT_TRUE(Json::parseFromStream(builder, is, &root, &errs)) << errs;
+    return root;
+  };
+
+  const auto location = epJSONFixture::completeIDFPath("RefBldgMediumOfficeNew2004_Chicago.idf");
+  auto idf = openstudio::IdfFile::load(location);
+  ASSERT_TRUE(idf);
+
+  std::stringstream idfStream;
+  ASSERT_TRUE(openstudio::epJSON::toJSONStream(*idf, idfStream));
+  auto streamed = parseStream(idfStream);
+  auto expected = openstudio::epJSON::toJSON(*idf);
+  // integral doubles may be read back as integers
+  epJSONFixture::makeDoubles(streamed);
+  epJSONFixture::makeDoubles(expected);
+  EXPECT_EQ(expected, streamed);
+
+  auto m = openstudio::model::exampleModel();
+  openstudio::energyplus::ForwardTranslator ft;
+  openstudio::Workspace w = ft.translateModel(m);
+
+  std::stringstream workspaceStream;
+  ASSERT_TRUE(openstudio::epJSON::toJSONStream(w, workspaceStream));
+  streamed = parseStream(workspaceStream);
+  expected = openstudio::epJSON::toJSON(w);
+  epJSONFixture::makeDoubles(streamed);
+  epJSONFixture::makeDoubles(expected);
+  EXPECT_EQ(expected, streamed);
+}
+
+TEST_F(epJSONFixture, toJSON_ConcurrentCalls) {
+  const auto location = epJSONFixture::completeIDFPath("RefBldgMediumOfficeNew2004_Chicago.idf");
+  auto idf = openstudio::IdfFile::load(location);
+  ASSERT_TRUE(idf);
+
+  // the schema is compiled by whichever call comes first, and shared by the others
+  std::vector<std::future<std::string>> results;
+  for (int i = 0; i < 4; ++i) {
+    results.push_back(std::async(std::launch::async, [&idf]() { return openstudio::epJSON::toJSONString(*idf); }));
+  }
+
+  const auto expected = openstudio::epJSON::toJSONString(*idf);
+  EXPECT_GT(expected.size(), 100u);
+  for (auto& result : results) {
+    EXPECT_EQ(expected, result.get());
+  }
+}
+
 TEST_F(epJSONFixture, CustomCases) {
 
   // Test for #4264, part 1
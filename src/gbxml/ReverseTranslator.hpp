@@ -63,7 +63,8 @@ namespace gbxml {
     // given id and name from XML (name may be empty) return an OS name
     std::string escapeName(const std::string& id, const std::string& name);
 
-    std::map<std::string, openstudio::model::ModelObject> m_idToObjectMap;
+    // every translated object by its gbXML id, cross-references such as spaceIdRef and constructionIdRef resolve through it
+    std::unordered_map<std::string, openstudio::model::ModelObject> m_idToObjectMap;
 
     // In ReverseTranslator.cpp
     boost::optional<openstudio::model::Model> convert(const pugi::xml_node& root);
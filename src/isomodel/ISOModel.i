@@ -31,6 +31,9 @@
 // #endif
 
 %ignore openstudio::isomodel::mult;
+// batch simulation, std::vector<SimModel> and std::vector<UserModel> are not wrapped
+%ignore openstudio::isomodel::SimModel::simulate(const std::vector<SimModel>&);
+%ignore openstudio::isomodel::UserModel::simulate;
 
 %rename("terrainClass=") openstudio::isomodel::UserModel::setTerrainClass(double value);
 %rename("floorArea=") openstudio::isomodel::UserModel::setFloorArea(double value);
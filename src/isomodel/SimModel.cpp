@@ -5,7 +5,9 @@
 
 #include "SimModel.hpp"
 
+#include <algorithm>
 #include <cmath>
+#include <limits>
 
 #if _DEBUG || (__GNUC__ && !NDEBUG)
 #  define DEBUG_ISO_MODEL_SIMULATION
@@ -2328,5 +2330,560 @@ Ebldg.mon=sum(Ebldg.total,2);  % sum normally works down columns but by putting
 Ebldg.yr=sum(Ebldg.mon);
   */
   }
+
+  // Number of models SimModel::simulate(simModels) runs through each step together, small enough for the values of a block
+  // to stay in cache.
+  constexpr std::size_t simulationBlockSize = 256;
+
+  // Same as the div helpers, for a single value.
+  static double divide(double v1, double s1) {
+    return (s1 == 0) ? std::numeric_limits<double>::max() : v1 / s1;
+  }
+
+  // Setback temperatures of interiorTemp for one model. The outdoor temperature and solar terms (M_Te and M_dT) are zero and the
+  // control set points are the same every month, so every month gets the same values.
+  static void setbackTemperatures(double tset_ctrl, double tset_unocc, double tau, const double (&v_ti)[5], double& T_wke_avg,
+                                  double& T_wk_nt) {
+    constexpr double T_e = 0.0;
+    constexpr double dT = 0.0;
+
+    double T_a[4];
+    double T_start = tset_ctrl;
+    for (int i = 0; i < 4; i++) {
+      T_start = T_a[i] = (T_start - T_e - dT) * exp(-1 * v_ti[i] / tau) + T_e + dT;
+    }
+
+    double T_aa[5] = {0, 0, 0, 0, 0};
+    for (int i = 1; i < 5; i++) {
+      T_aa[i] = std::max(T_a[i - 1], tset_unocc);
+    }
+
+    double T_b[5];
+    for (int i = 0; i < 5; i++) {
+      double v_T_avg = tau / v_ti[i] * (T_aa[i] - T_e - dT) * (1 - exp(-1 * v_ti[i] / tau)) + T_e + dT;
+      T_b[i] = std::max(v_T_avg, tset_unocc);
+    }
+
+    double thisSum = 0;
+    for (double T : T_b) {
+      thisSum += T;
+    }
+    T_wke_avg = thisSum / 5.0;
+    T_wk_nt = T_b[1];
+  }
+
+  bool SimModel::fitsSimulationBlock() const {
+    const auto isDirectional = [](const Vector& v) { return v.size() == 9; };
+    const Matrix& msolar = location->weather()->msolar();
+    const Matrix& mhEgh = location->weather()->mhEgh();
+    return isDirectional(structure->wallArea()) && isDirectional(structure->windowArea()) && isDirectional(structure->wallUniform())
+           && isDirectional(structure->windowUniform()) && isDirectional(structure->wallThermalEmissivity())
+           && isDirectional(structure->wallSolarAbsorbtion()) && isDirectional(structure->windowNormalIncidenceSolarEnergyTransmittance())
+           && isDirectional(structure->windowShadingCorrectionFactor()) && (msolar.size1() == 12) && (msolar.size2() >= 8)
+           && (mhEgh.size1() == 12) && (mhEgh.size2() == 24) && (location->weather()->mEgh().size() == 12)
+           && (location->weather()->mdbt().size() == 12) && (location->weather()->mwind().size() == 12);
+  }
+
+  std::vector<ISOResults> SimModel::simulate(const std::vector<SimModel>& simModels) {
+    std::vector<ISOResults> results(simModels.size());
+
+    std::vector<const SimModel*> blockModels;
+    std::vector<ISOResults*> blockResults;
+    blockModels.reserve(simulationBlockSize);
+    blockResults.reserve(simulationBlockSize);
+
+    for (size_t i = 0; i < simModels.size(); i++) {
+      if (!simModels[i].fitsSimulationBlock()) {
+        results[i] = simModels[i].simulate();
+        continue;
+      }
+      blockModels.push_back(&simModels[i]);
+      blockResults.push_back(&results[i]);
+      if (blockModels.size() == simulationBlockSize) {
+        simulateBlock(blockModels, blockResults);
+        blockModels.clear();
+        blockResults.clear();
+      }
+    }
+    if (!blockModels.empty()) {
+      simulateBlock(blockModels, blockResults);
+    }
+
+    return results;
+  }
+
+  // Each step below is the one of simulate() with the same name, computed with the same operations in the same order so that the
+  // results are identical. Values are stored one array per quantity, with one entry per model (or per month and model, month by month),
+  // so that the loops over the models are simple elementwise loops. Intermediate values which simulate() computes but which do not
+  // contribute to its results (the unoccupied heat gains and the night time dry bulb temperatures) are left out.
+  void SimModel::simulateBlock(const std::vector<const SimModel*>& models, const std::vector<ISOResults*>& results) {
+    const size_t n = models.size();
+    const auto perModel = [n]() { return std::vector<double>(n); };
+    const auto perDirection = [n]() { return std::vector<double>(9 * n); };
+    const auto perMonth = [n]() { return std::vector<double>(12 * n); };
+
+    // inputs
+    std::vector<double> hoursStart = perModel(), hoursEnd = perModel(), daysStart = perModel(), daysEnd = perModel();
+    std::vector<double> densityOccupied = perModel(), densityUnoccupied = perModel(), heatGainPerPerson = perModel();
+    std::vector<double> terrain = perModel();
+    std::vector<double> lpd_occ = perModel(), lpd_unocc = perModel(), F_D = perModel(), exteriorEnergy = perModel();
+    std::vector<double> F_O = perModel(), F_C = perModel(), buildingEnergyManagement = perModel();
+    std::vector<double> elecOccupied = perModel(), elecUnoccupied = perModel(), gasOccupied = perModel(), gasUnoccupied = perModel();
+    std::vector<double> floorArea = perModel(), windowShadingDevice = perModel(), interiorHeatCapacity = perModel();
+    std::vector<double> wallHeatCapacity = perModel(), buildingHeight = perModel(), infiltrationRate = perModel();
+    std::vector<double> v_wall_A = perDirection(), v_win_A = perDirection(), v_wall_U = perDirection(), v_win_U = perDirection();
+    std::vector<double> v_wall_emiss = perDirection(), v_wall_alpha_sc = perDirection();
+    std::vector<double> v_g_gln = perDirection(), v_win_SCF = perDirection();
+    std::vector<double> ht_tset_occ = perModel(), ht_tset_unocc = perModel(), f_waste = perModel(), a_ht_loss = perModel();
+    std::vector<double> ht_efficiency = perModel(), ht_energyType = perModel(), ht_pumpControl = perModel();
+    std::vector<double> dhw_demand = perModel(), dhw_distributionEfficiency = perModel(), dhw_systemEfficiency = perModel();
+    std::vector<double> dhw_energyType = perModel();
+    std::vector<double> cl_tset_occ = perModel(), cl_tset_unocc = perModel(), cop = perModel(), partialLoadValue = perModel();
+    std::vector<double> a_cl_loss = perModel(), cl_pumpControl = perModel();
+    std::vector<double> supplyRate = perModel(), supplyDifference = perModel(), heatRecoveryEfficiency = perModel();
+    std::vector<double> exhaustAirRecirculated = perModel(), ventilationType = perModel(), fanPower = perModel();
+    std::vector<double> fanControlFactor = perModel();
+    std::vector<double> mdbt = perMonth(), mwind = perMonth(), v_hrs_sun_down_mo = perMonth();
+    // month x direction x model, the last direction (roof) is the global horizontal radiation
+    std::vector<double> m_I_sol(12 * 9 * n);
+
+    for (size_t i = 0; i < n; i++) {
+      const SimModel& model = *models[i];
+      const WeatherData& weather = *model.location->weather();
+
+      hoursStart[i] = model.pop->hoursStart();
+      hoursEnd[i] = model.pop->hoursEnd();
+      daysStart[i] = model.pop->daysStart();
+      daysEnd[i] = model.pop->daysEnd();
+      densityOccupied[i] = model.pop->densityOccupied();
+      densityUnoccupied[i] = model.pop->densityUnoccupied();
+      heatGainPerPerson[i] = model.pop->heatGainPerPerson();
+
+      terrain[i] = model.location->terrain();
+
+      lpd_occ[i] = model.lights->powerDensityOccupied();
+      lpd_unocc[i] = model.lights->powerDensityUnoccupied();
+      F_D[i] = model.lights->dimmingFraction();
+      exteriorEnergy[i] = model.lights->exteriorEnergy();
+
+      F_O[i] = model.building->lightingOccupancySensor();
+      F_C[i] = model.building->constantIllumination();
+      buildingEnergyManagement[i] = model.building->buildingEnergyManagement();
+      elecOccupied[i] = model.building->electricApplianceHeatGainOccupied();
+      elecUnoccupied[i] = model.building->electricApplianceHeatGainUnoccupied();
+      gasOccupied[i] = model.building->gasApplianceHeatGainOccupied();
+      gasUnoccupied[i] = model.building->gasApplianceHeatGainUnoccupied();
+
+      floorArea[i] = model.structure->floorArea();
+      windowShadingDevice[i] = model.structure->windowShadingDevice();
+      interiorHeatCapacity[i] = model.structure->interiorHeatCapacity();
+      wallHeatCapacity[i] = model.structure->wallHeatCapacity();
+      buildingHeight[i] = model.structure->buildingHeight();
+      infiltrationRate[i] = model.structure->infiltrationRate();
+      for (size_t d = 0; d < 9; d++) {
+        v_wall_A[d * n + i] = model.structure->wallArea()[d];
+        v_win_A[d * n + i] = model.structure->windowArea()[d];
+        v_wall_U[d * n + i] = model.structure->wallUniform()[d];
+        v_win_U[d * n + i] = model.structure->windowUniform()[d];
+        v_wall_emiss[d * n + i] = model.structure->wallThermalEmissivity()[d];
+        v_wall_alpha_sc[d * n + i] = model.structure->wallSolarAbsorbtion()[d];
+        v_g_gln[d * n + i] = model.structure->windowNormalIncidenceSolarEnergyTransmittance()[d];
+        v_win_SCF[d * n + i] = model.structure->windowShadingCorrectionFactor()[d];
+      }
+
+      ht_tset_occ[i] = model.heating->temperatureSetPointOccupied();
+      ht_tset_unocc[i] = model.heating->temperatureSetPointUnoccupied();
+      f_waste[i] = model.heating->hotcoldWasteFactor();
+      a_ht_loss[i] = model.heating->hvacLossFactor();
+      ht_efficiency[i] = model.heating->efficiency();
+      ht_energyType[i] = model.heating->energyType();
+      ht_pumpControl[i] = model.heating->pumpControlReduction();
+      dhw_demand[i] = model.heating->hotWaterDemand();
+      dhw_distributionEfficiency[i] = model.heating->hotWaterDistributionEfficiency();
+      dhw_systemEfficiency[i] = model.heating->hotWaterSystemEfficiency();
+      dhw_energyType[i] = model.heating->hotWaterEnergyType();
+
+      cl_tset_occ[i] = model.cooling->temperatureSetPointOccupied();
+      cl_tset_unocc[i] = model.cooling->temperatureSetPointUnoccupied();
+      cop[i] = model.cooling->cop();
+      partialLoadValue[i] = model.cooling->partialLoadValue();
+      a_cl_loss[i] = model.cooling->hvacLossFactor();
+      cl_pumpControl[i] = model.cooling->pumpControlReduction();
+
+      supplyRate[i] = model.ventilation->supplyRate();
+      supplyDifference[i] = model.ventilation->supplyDifference();
+      heatRecoveryEfficiency[i] = model.ventilation->heatRecoveryEfficiency();
+      exhaustAirRecirculated[i] = model.ventilation->exhaustAirRecirculated();
+      ventilationType[i] = model.ventilation->type();
+      fanPower[i] = model.ventilation->fanPower();
+      fanControlFactor[i] = model.ventilation->fanControlFactor();
+
+      for (size_t m = 0; m < 12; m++) {
+        mdbt[m * n + i] = weather.mdbt()[m];
+        mwind[m * n + i] = weather.mwind()[m];
+        for (size_t d = 0; d < 8; d++) {
+          m_I_sol[(m * 9 + d) * n + i] = weather.msolar()(m, d);
+        }
+        m_I_sol[(m * 9 + 8) * n + i] = weather.mEgh()[m];
+
+        // solarRadiationBreakdown
+        double sunUp = 0;
+        double sunDown = 0;
+        for (int j = 0; j < 24; j++) {
+          if (weather.mhEgh()(m, j) != 0) {
+            sunUp = j;
+            break;
+          }
+        }
+        for (int j = 23; j >= 0; j--) {
+          if (weather.mhEgh()(m, j) != 0) {
+            sunDown = j;
+            break;
+          }
+        }
+        double v_frac_hrs_sun_up = (sunDown - sunUp + 1) / 24.0;
+        double v_frac_hrs_sun_down = 1.0 - v_frac_hrs_sun_up;
+        v_hrs_sun_down_mo[m * n + i] = v_frac_hrs_sun_down * hoursInMonth[m];
+      }
+    }
+
+    // scheduleAndOccupancy
+    std::vector<double> frac_hrs_wk_day = perModel(), frac_hrs_wk_nt = perModel(), frac_hrs_wke_tot = perModel();
+    std::vector<double> hoursOccupiedPerDay = perModel(), hoursUnoccupiedPerDay = perModel();
+    for (size_t i = 0; i < n; i++) {
+      double hoursOccupied = hoursEnd[i] - hoursStart[i];
+      hoursOccupied = (hoursOccupied < 0) ? hoursOccupied + 24 : hoursOccupied;
+      double daysOccupiedPerWeek = daysEnd[i] - daysStart[i] + 1;
+      daysOccupiedPerWeek = (daysOccupiedPerWeek < 0) ? daysOccupiedPerWeek + 7 : daysOccupiedPerWeek;
+      double hoursOccupiedDuringWeek = hoursOccupied * daysOccupiedPerWeek;
+      frac_hrs_wk_day[i] = hoursOccupiedDuringWeek / hoursInWeek;
+      hoursOccupiedPerDay[i] = hoursOccupied;
+      hoursUnoccupiedPerDay[i] = 24 - hoursOccupied;
+      double hoursUnoccupiedDuringWeek = (daysOccupiedPerWeek - 1) * hoursUnoccupiedPerDay[i];
+      frac_hrs_wk_nt[i] = hoursUnoccupiedDuringWeek / hoursInWeek;
+      double totalWeekendHours = hoursInWeek - hoursOccupiedDuringWeek - hoursUnoccupiedDuringWeek;
+      frac_hrs_wke_tot[i] = totalWeekendHours / hoursInWeek;
+    }
+
+    // lightingEnergyUse, heatGainsAndLosses and internalHeatGain
+    std::vector<double> Q_illum_tot_yr = perModel(), phi_I_tot = perModel();
+    for (size_t i = 0; i < n; i++) {
+      double n_day_start = 7;
+      double n_day_end = 19;
+      double n_weeks = 50;
+      double t_lt_D =
+        (std::min(n_day_end, hoursEnd[i]) - std::max(hoursStart[i], n_day_start)) * (daysEnd[i] + 1 - daysStart[i] + 1) * n_weeks;
+      double t_lt_N = (std::max(n_day_start - hoursStart[i], 0.0) + std::max(hoursEnd[i] - n_day_end, 0.0))
+                      * (daysEnd[i] + 1 - daysStart[i] + 1) * n_weeks;
+      double Q_illum_occ = floorArea[i] * lpd_occ[i] * F_C[i] * F_O[i] * (t_lt_D * F_D[i] + t_lt_N) / 1000.0;
+      double t_unocc = hoursInYear - t_lt_D - t_lt_N;
+      double Q_illum_unocc = floorArea[i] * lpd_unocc[i] * t_unocc / 1000.0;
+      Q_illum_tot_yr[i] = Q_illum_occ + Q_illum_unocc;
+
+      double phi_int_occ = heatGainPerPerson[i] / densityOccupied[i];
+      double phi_int_unocc = heatGainPerPerson[i] / densityUnoccupied[i];
+      double phi_int_avg = frac_hrs_wk_day[i] * phi_int_occ + (1 - frac_hrs_wk_day[i]) * phi_int_unocc;
+      double phi_plug_occ = elecOccupied[i] + gasOccupied[i];
+      double phi_plug_unocc = elecUnoccupied[i] + gasUnoccupied[i];
+      double phi_plug_avg = phi_plug_occ * frac_hrs_wk_day[i] + phi_plug_unocc * (1 - frac_hrs_wk_day[i]);
+      double phi_illum_avg = Q_illum_tot_yr[i] / floorArea[i] / hoursInYear * 1000;
+
+      double phi_I_occ = phi_int_avg * floorArea[i];
+      double phi_I_app = phi_plug_avg * floorArea[i];
+      double phi_I_lt = phi_illum_avg * floorArea[i];
+      phi_I_tot[i] = phi_I_occ + phi_I_app + phi_I_lt;
+    }
+
+    // envelopCalculations and windowSolarGain
+    std::vector<double> H_D = perModel(), wallAreaSum = perModel(), windowAreaSum = perModel(), v_win_F_shgl = perModel();
+    for (size_t i = 0; i < n; i++) {
+      double n_win_SDF_table[] = {0.5, 0.35, 1.0};
+      int n_win_SDF_table_index = std::min(2, std::max(static_cast<int>(windowShadingDevice[i]) - 1, 0));
+      v_win_F_shgl[i] = n_win_SDF_table[n_win_SDF_table_index] * 1.0;
+    }
+    std::vector<double> v_win_A_sol = perDirection(), v_wall_A_sol = perDirection(), v_wall_phi_r = perDirection();
+    for (size_t d = 0; d < 9; d++) {
+      const size_t o = d * n;
+      for (size_t i = 0; i < n; i++) {
+        H_D[i] += v_wall_A[o + i] * v_wall_U[o + i] + v_win_A[o + i] * v_win_U[o + i];
+        wallAreaSum[i] += v_wall_A[o + i];
+        windowAreaSum[i] += v_win_A[o + i];
+
+        double n_win_ff = 0.25;
+        double n_win_F_W = 0.9;
+        double n_R_sc_ext = 0.04;
+        double theta_er = 11.0;
+        double v_win_hr = v_wall_emiss[o + i] * 5.0;
+        v_win_A_sol[o + i] = v_win_F_shgl[i] * (v_g_gln[o + i] * n_win_F_W) * (1.0 - n_win_ff) * v_win_A[o + i];
+        v_wall_A_sol[o + i] = v_wall_alpha_sc[o + i] * n_R_sc_ext * v_wall_U[o + i] * v_wall_A[o + i];
+        v_wall_phi_r[o + i] = n_R_sc_ext * v_wall_U[o + i] * v_wall_A[o + i] * v_win_hr * theta_er;
+      }
+    }
+    std::vector<double> H_tr = perModel();
+    for (size_t i = 0; i < n; i++) {
+      double H_g = 0;
+      double H_U = 0;
+      double H_A = 0;
+      H_tr[i] = H_D[i] + H_g + H_U + H_A;
+    }
+
+    // solarHeatGain
+    std::vector<double> v_E_sol = perMonth();
+    for (size_t m = 0; m < 12; m++) {
+      double n_v_env_form_factors[] = {0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 1};
+      const size_t o = m * n;
+      for (size_t i = 0; i < n; i++) {
+        double v_win_phi_sol = 0;
+        double v_wall_phi_sol = 0;
+        for (size_t d = 0; d < 9; d++) {
+          double I_sol = m_I_sol[(m * 9 + d) * n + i];
+          v_win_phi_sol += v_win_SCF[d * n + i] * 1.0 * v_win_A_sol[d * n + i] * I_sol;
+          v_wall_phi_sol += v_wall_A_sol[d * n + i] * I_sol - v_wall_phi_r[d * n + i] * n_v_env_form_factors[d];
+        }
+        v_E_sol[o + i] = (v_win_phi_sol + v_wall_phi_sol) * megasecondsInMonth[m];
+      }
+    }
+
+    // interiorTemp
+    std::vector<double> tau = perModel(), v_Th_avg = perModel(), v_Tc_avg = perModel();
+    for (size_t i = 0; i < n; i++) {
+      double T_adj = 0;
+      switch (static_cast<int>(buildingEnergyManagement[i])) {
+        case 1:
+          T_adj = 0.0;
+          break;
+        case 2:
+          T_adj = 0.5;
+          break;
+        case 3:
+          T_adj = 1.0;
+          break;
+      }
+      double ht_tset_ctrl = ht_tset_occ[i] - T_adj;
+      double cl_tset_ctrl = cl_tset_occ[i] + T_adj;
+
+      double Cm_int = interiorHeatCapacity[i] * floorArea[i];
+      double Cm_env = wallHeatCapacity[i] * wallAreaSum[i];
+      double Cm = Cm_int + Cm_env;
+      double H_ve = 0.0;
+      double H_tot = H_tr[i] + H_ve;
+      tau[i] = Cm / H_tot / 3600.0;
+
+      const double v_ti[5] = {hoursUnoccupiedPerDay[i], hoursOccupiedPerDay[i], hoursUnoccupiedPerDay[i], hoursOccupiedPerDay[i],
+                              hoursUnoccupiedPerDay[i]};
+      double v_Th_wke_avg = 0;
+      double v_Th_wk_nt = 0;
+      setbackTemperatures(ht_tset_ctrl, ht_tset_unocc[i], tau[i], v_ti, v_Th_wke_avg, v_Th_wk_nt);
+      double v_Tc_wke_avg = 0;
+      double v_Tc_wk_nt = 0;
+      setbackTemperatures(cl_tset_ctrl, cl_tset_unocc[i], tau[i], v_ti, v_Tc_wke_avg, v_Tc_wk_nt);
+
+      double v_Th_wk_avg = ht_tset_ctrl * frac_hrs_wk_day[i] + v_Th_wk_nt * frac_hrs_wk_nt[i] + v_Th_wke_avg * frac_hrs_wke_tot[i];
+      double v_Tc_wk_avg = cl_tset_ctrl * frac_hrs_wk_day[i] + v_Tc_wk_nt * frac_hrs_wk_nt[i] + v_Tc_wke_avg * frac_hrs_wke_tot[i];
+      v_Th_avg[i] = std::min(v_Th_wk_avg, ht_tset_ctrl);
+      v_Tc_avg[i] = std::min(v_Tc_wk_avg, cl_tset_ctrl);
+    }
+
+    // ventilationCalc
+    std::vector<double> h_stack = perModel(), v_Q4pa = perModel(), qv_inf_extra = perModel(), v_qv_mve = perModel();
+    for (size_t i = 0; i < n; i++) {
+      double vent_zone_height = std::max(0.1, buildingHeight[i]);
+      double qv_supp = supplyRate[i] / floorArea[i] / 3.6;
+      double qv_ext = -(qv_supp - supplyDifference[i] / floorArea[i] / 3.6);
+      double qv_comb = 0;
+      double qv_diff = qv_supp + qv_ext + qv_comb;
+      double vent_outdoor_frac = 1 - exhaustAirRecirculated[i];
+      double tot_env_A = wallAreaSum[i] + windowAreaSum[i];
+      double n_p_exp = 0.65;
+      double v_Q75pa = (infiltrationRate[i] == 0) ? 0.00000000001 : infiltrationRate[i];
+      v_Q4pa[i] = v_Q75pa * tot_env_A / floorArea[i] * (std::pow((4.0 / 75.0), n_p_exp));
+      double n_zone_frac = 0.7;
+      h_stack[i] = n_zone_frac * vent_zone_height;
+      qv_inf_extra[i] = std::max(0.0, -qv_diff);
+      // vent_rate_flag is 1, so the ventilation runs for the occupied hours
+      double vent_op_frac = frac_hrs_wk_day[i];
+      v_qv_mve[i] = ventilationType[i] == 3 ? 0 : (vent_op_frac * qv_supp * vent_outdoor_frac * (1 - heatRecoveryEfficiency[i]));
+    }
+    std::vector<double> v_Hve_ht = perMonth(), v_Hve_cl = perMonth();
+    for (size_t m = 0; m < 12; m++) {
+      double n_stack_exp = 0.667;
+      double n_stack_coeff = 0.0146;
+      double n_wind_exp = 0.667;
+      double n_wind_coeff = 0.0769;
+      double n_dCp = 0.75;
+      double n_sw_coeff = 0.14;
+      double n_rhoc_air = 1200;
+      const size_t o = m * n;
+      for (size_t i = 0; i < n; i++) {
+        double v_qv_stack_ht =
+          std::max(std::pow(std::fabs(mdbt[o + i] - v_Th_avg[i]) * h_stack[i], n_stack_exp) * (n_stack_coeff * v_Q4pa[i]), 0.001);
+        double v_qv_stack_cl =
+          std::max(std::pow(std::fabs(mdbt[o + i] - v_Tc_avg[i]) * h_stack[i], n_stack_exp) * (n_stack_coeff * v_Q4pa[i]), 0.001);
+        double v_qv_wind = std::pow(mwind[o + i] * mwind[o + i] * (n_dCp * terrain[i]), n_wind_exp) * v_Q4pa[i] * n_wind_coeff;
+        double v_qv_sw_ht = std::max(v_qv_stack_ht, v_qv_wind) + divide(v_qv_stack_ht * v_qv_wind * n_sw_coeff, v_Q4pa[i]);
+        double v_qv_sw_cl = std::max(v_qv_stack_cl, v_qv_wind) + divide(v_qv_stack_cl * v_qv_wind * n_sw_coeff, v_Q4pa[i]);
+        double v_qve_ht = v_qv_sw_ht + qv_inf_extra[i] + v_qv_mve[i];
+        double v_qve_cl = v_qv_sw_cl + qv_inf_extra[i] + v_qv_mve[i];
+        v_Hve_ht[o + i] = v_qve_ht * n_rhoc_air / 3600.0;
+        v_Hve_cl[o + i] = v_qve_cl * n_rhoc_air / 3600.0;
+      }
+    }
+
+    // heatingAndCooling
+    std::vector<double> v_Qneed_ht = perMonth(), v_Qneed_cl = perMonth(), v_Qfan_tot = perMonth();
+    std::vector<double> Qneed_ht_yr = perModel(), Qneed_cl_yr = perModel();
+    for (size_t m = 0; m < 12; m++) {
+      double a_H0 = 1;
+      double tau_H0 = 15;
+      double n_dT_supp_ht = 7.0;
+      double n_dT_supp_cl = 7.0;
+      double n_rhoC_a = 1.22521 * 0.001012;
+      const size_t o = m * n;
+      for (size_t i = 0; i < n; i++) {
+        double v_tot_mo_ht_gain = megasecondsInMonth[m] * phi_I_tot[i] + v_E_sol[o + i];
+        double a_H = a_H0 + tau[i] / tau_H0;
+
+        double v_QT_ht = (v_Th_avg[i] - mdbt[o + i]) * megasecondsInMonth[m] * H_tr[i];
+        double v_QV_ht = v_Hve_ht[o + i] * floorArea[i] * (v_Th_avg[i] - mdbt[o + i]) * megasecondsInMonth[m];
+        double v_Qtot_ht = v_QT_ht + v_QV_ht;
+        double v_gamma_H_ht = divide(v_tot_mo_ht_gain, v_Qtot_ht + std::numeric_limits<double>::min());
+        double v_eta_g_H = v_gamma_H_ht > 0 ? (1 - std::pow(v_gamma_H_ht, a_H)) / (1 - std::pow(v_gamma_H_ht, (a_H + 1)))
+                                            : 1 / (v_gamma_H_ht + std::numeric_limits<double>::min());
+        v_Qneed_ht[o + i] = v_Qtot_ht - v_eta_g_H * v_tot_mo_ht_gain;
+        Qneed_ht_yr[i] += v_Qneed_ht[o + i];
+
+        double v_QT_cl = (v_Tc_avg[i] - mdbt[o + i]) * H_tr[i] * megasecondsInMonth[m];
+        double v_QV_cl = v_Hve_cl[o + i] * floorArea[i] * (v_Tc_avg[i] - mdbt[o + i]) * megasecondsInMonth[m];
+        double v_Qtot_cl = v_QT_cl + v_QV_cl;
+        double v_gamma_H_cl = divide(v_Qtot_cl, v_tot_mo_ht_gain + std::numeric_limits<double>::min());
+        double v_eta_g_CL = v_gamma_H_cl > 0.0 ? (1.0 - std::pow(v_gamma_H_cl, a_H)) / (1.0 - std::pow(v_gamma_H_cl, (a_H + 1.0))) : 1.0;
+        v_Qneed_cl[o + i] = v_tot_mo_ht_gain - v_eta_g_CL * v_Qtot_cl;
+        Qneed_cl_yr[i] += v_Qneed_cl[o + i];
+
+        double T_sup_ht = ht_tset_occ[i] + n_dT_supp_ht;
+        double T_sup_cl = cl_tset_occ[i] - n_dT_supp_cl;
+        double v_Vair_ht = divide(v_Qneed_ht[o + i], (T_sup_ht - v_Th_avg[i]) * n_rhoC_a + std::numeric_limits<double>::min());
+        double v_Vair_cl = divide(v_Qneed_cl[o + i], (v_Tc_avg[i] - T_sup_cl) * n_rhoC_a + std::numeric_limits<double>::min());
+        double v_Vair_tot = std::max(v_Vair_ht + v_Vair_cl, divide(megasecondsInMonth[m] * (supplyRate[i] * frac_hrs_wk_day[i]), 1000));
+        double v_fanPower = v_Vair_tot * (fanPower[i] * fanControlFactor[i]);
+        v_Qfan_tot[o + i] = divide(divide(v_fanPower, floorArea[i]), 3600);
+      }
+    }
+
+    // hvac, without district heating or cooling (DH_YesNo and DC_YesNo are 0)
+    std::vector<double> v_Qelec_ht = perMonth(), v_Qgas_ht = perMonth(), v_Qcl_elec_tot = perMonth(), v_Qcl_gas_tot = perMonth();
+    for (size_t i = 0; i < n; i++) {
+      double IEER = cop[i] * partialLoadValue[i];
+      double f_dem_ht = std::max(Qneed_ht_yr[i] / (Qneed_cl_yr[i] + Qneed_ht_yr[i]), 0.1);
+      double f_dem_cl = std::max((1.0 - f_dem_ht), 0.1);
+      double eta_dist_ht = 1.0 / (1.0 + a_ht_loss[i] + f_waste[i] / f_dem_ht);
+      double eta_dist_cl = 1.0 / (1.0 + a_cl_loss[i] + f_waste[i] / f_dem_cl);
+      // v_Qcool_DC and v_Qht_DH are zero, and so are the district energies computed from them
+      double v_Qcl_DC_elec = 0;
+      double v_Qcl_DC_abs = 0;
+      double v_Qht_DH_total = 0;
+      for (size_t m = 0; m < 12; m++) {
+        const size_t j = m * n + i;
+        double v_Qloss_ht_dist = divide(v_Qneed_ht[j] * (1 - eta_dist_ht), eta_dist_ht);
+        double v_Qloss_cl_dist = divide(v_Qneed_cl[j] * (1 - eta_dist_cl), eta_dist_cl);
+        double v_Qht_sys = divide(v_Qloss_ht_dist + v_Qneed_ht[j], ht_efficiency[i] + std::numeric_limits<double>::min());
+        double v_Qcl_sys = divide(v_Qloss_cl_dist + v_Qneed_cl[j], IEER + std::numeric_limits<double>::min());
+        v_Qcl_elec_tot[j] = v_Qcl_sys + v_Qcl_DC_elec;
+        v_Qcl_gas_tot[j] = v_Qcl_DC_abs;
+        if (ht_energyType[i] == 1) {
+          v_Qelec_ht[j] = v_Qht_sys;
+          v_Qgas_ht[j] = v_Qht_DH_total;
+        } else {
+          v_Qelec_ht[j] = 0;
+          v_Qgas_ht[j] = v_Qht_sys + v_Qht_DH_total;
+        }
+      }
+    }
+
+    // pump
+    double n_E_pumps = 0.25;
+    double Q_pumps_yr = 0;
+    for (double megaseconds : megasecondsInMonth) {
+      Q_pumps_yr += megaseconds * n_E_pumps;
+    }
+    std::vector<double> frac_ht_total = perModel(), frac_cl_total = perModel(), frac_total = perModel();
+    for (size_t m = 0; m < 12; m++) {
+      const size_t o = m * n;
+      for (size_t i = 0; i < n; i++) {
+        frac_ht_total[i] += divide(v_Qneed_ht[o + i], v_Qneed_ht[o + i] + v_Qneed_cl[o + i]);
+        frac_cl_total[i] += divide(v_Qneed_cl[o + i], v_Qneed_ht[o + i] + v_Qneed_cl[o + i]);
+        frac_total[i] += divide(v_Qneed_ht[o + i] + v_Qneed_cl[o + i], Qneed_ht_yr[i] + Qneed_cl_yr[i]);
+      }
+    }
+    std::vector<double> v_Q_pump_tot = perMonth();
+    for (size_t i = 0; i < n; i++) {
+      double Q_pumps_ht = Q_pumps_yr * ht_pumpControl[i] * floorArea[i];
+      double Q_pumps_cl = Q_pumps_yr * cl_pumpControl[i] * floorArea[i];
+      double Q_pumps_tot = Q_pumps_ht + Q_pumps_cl;
+      for (size_t m = 0; m < 12; m++) {
+        const size_t j = m * n + i;
+        if (Q_pumps_ht == 0 || Q_pumps_cl == 0) {
+          double v_Q_pumps_ht = divide(divide(v_Qneed_ht[j], v_Qneed_ht[j] + v_Qneed_cl[j]) * Q_pumps_ht, frac_ht_total[i]);
+          double v_Q_pumps_cl = divide(divide(v_Qneed_cl[j], v_Qneed_ht[j] + v_Qneed_cl[j]) * Q_pumps_cl, frac_cl_total[i]);
+          v_Q_pump_tot[j] = v_Q_pumps_ht + v_Q_pumps_cl;
+        } else {
+          v_Q_pump_tot[j] = divide(divide(v_Qneed_ht[j] + v_Qneed_cl[j], Qneed_ht_yr[i] + Qneed_cl_yr[i]) * Q_pumps_tot, frac_total[i]);
+        }
+      }
+    }
+
+    // heatedWater and outputGeneration
+    for (size_t i = 0; i < n; i++) {
+      double n_dhw_tset = 60;
+      double n_dhw_tsupply = 20;
+      double n_CP_h20 = 4.18;
+      double v_Q_dhw_solar = 0;
+      double Q_dhw_yr = dhw_demand[i] * (n_dhw_tset - n_dhw_tsupply) * n_CP_h20;
+
+      double E_plug_elec = elecOccupied[i] * frac_hrs_wk_day[i] + elecUnoccupied[i] * (1.0 - frac_hrs_wk_day[i]);
+      double E_plug_gas = gasOccupied[i] * frac_hrs_wk_day[i] + gasUnoccupied[i] * (1.0 - frac_hrs_wk_day[i]);
+
+      ISOResults& allResults = *results[i];
+      allResults.monthlyResults.resize(12);
+      for (size_t m = 0; m < 12; m++) {
+        const size_t j = m * n + i;
+        double v_MonthlyDemand = daysInMonth[m] * Q_dhw_yr;
+        double v_frac_MonthlyDemand_yr = divide(v_MonthlyDemand, daysInYear);
+        double v_Qe_demand = divide(v_frac_MonthlyDemand_yr, dhw_distributionEfficiency[i]);
+        double v_Q_dhw_demand = divide(v_Qe_demand, kWh2MJ);
+        double v_Q_dhw_need = std::max(divide(v_Q_dhw_demand - v_Q_dhw_solar, dhw_systemEfficiency[i]), 0.0);
+        double v_Q_dhw_elec = (dhw_energyType[i] == 1) ? v_Q_dhw_need : 0.0;
+        double v_Q_dhw_gas = (dhw_energyType[i] == 1) ? 0.0 : v_Q_dhw_need;
+
+        double Eelec_ht = divide(divide(v_Qelec_ht[j], floorArea[i]), kWh2MJ);
+        double Eelec_cl = divide(divide(v_Qcl_elec_tot[j], floorArea[i]), kWh2MJ);
+        double Eelec_int_lt = divide(monthFractionOfYear[m] * Q_illum_tot_yr[i], floorArea[i]);
+        double Eelec_ext_lt = divide(v_hrs_sun_down_mo[j] * (exteriorEnergy[i] / 1000.0), floorArea[i]);
+        double Eelec_fan = v_Qfan_tot[j];
+        double Eelec_pump = divide(divide(v_Q_pump_tot[j], floorArea[i]), kWh2MJ);
+        double Eelec_plug = divide(hoursInMonth[m] * E_plug_elec, 1000.0);
+        double Eelec_dhw = divide(v_Q_dhw_elec, floorArea[i]);
+        double Egas_ht = divide(divide(v_Qgas_ht[j], floorArea[i]), kWh2MJ);
+        double Egas_cl = divide(divide(v_Qcl_gas_tot[j], floorArea[i]), kWh2MJ);
+        double Egas_plug = divide(hoursInMonth[m] * E_plug_gas, 1000.0);
+        double Egas_dhw = divide(v_Q_dhw_gas, floorArea[i]);
+
+        EndUses& result = allResults.monthlyResults[m];
+        result.addEndUse(Eelec_ht, EndUseFuelType::Electricity, EndUseCategoryType::Heating);
+        result.addEndUse(Eelec_cl, EndUseFuelType::Electricity, EndUseCategoryType::Cooling);
+        result.addEndUse(Eelec_int_lt, EndUseFuelType::Electricity, EndUseCategoryType::InteriorLights);
+        result.addEndUse(Eelec_ext_lt, EndUseFuelType::Electricity, EndUseCategoryType::ExteriorLights);
+        result.addEndUse(Eelec_fan, EndUseFuelType::Electricity, EndUseCategoryType::Fans);
+        result.addEndUse(Eelec_pump, EndUseFuelType::Electricity, EndUseCategoryType::Pumps);
+        result.addEndUse(Eelec_plug, EndUseFuelType::Electricity, EndUseCategoryType::InteriorEquipment);
+        result.addEndUse(Eelec_dhw, EndUseFuelType::Electricity, EndUseCategoryType::WaterSystems);
+
+        result.addEndUse(Egas_ht, EndUseFuelType::Gas, EndUseCategoryType::Heating);
+        result.addEndUse(Egas_cl, EndUseFuelType::Gas, EndUseCategoryType::Cooling);
+        result.addEndUse(Egas_plug, EndUseFuelType::Gas, EndUseCategoryType::InteriorEquipment);
+        result.addEndUse(Egas_dhw, EndUseFuelType::Gas, EndUseCategoryType::WaterSystems);
+      }
+    }
+  }
 }  // namespace isomodel
 }  // namespace openstudio
@@ -89,6 +89,13 @@ namespace isomodel {
      *  returns ISOResults which is a vector of EndUses, one EndUses per month of the year
      */
     ISOResults simulate() const;
+
+    /*
+     *  Runs the ISO Model calculations for each of simModels, with the same results as calling simulate() on each of them.
+     *  Models are simulated in blocks, each step of the calculations going over all the models of a block at once.
+     */
+    static std::vector<ISOResults> simulate(const std::vector<SimModel>& simModels);
+
     REGISTER_LOGGER("openstudio.isomodel.SimModel");
 
    private:
@@ -144,6 +151,10 @@ namespace isomodel {
                                 const Vector& v_Qfan_tot, const Vector& v_Q_pump_tot, const Vector& v_Q_dhw_elec, const Vector& v_Qgas_ht,
                                 const Vector& v_Qcl_gas_tot, const Vector& v_Q_dhw_gas, double frac_hrs_wk_day) const;
 
+    // true if the inputs have the sizes simulateBlock expects: 9 directions, 12 months and 24 hours
+    bool fitsSimulationBlock() const;
+    static void simulateBlock(const std::vector<const SimModel*>& models, const std::vector<ISOResults*>& results);
+
     static void printVector(const char* vecName, const Vector& vec);
     static void printMatrix(const char* matName, const Matrix& mat);
   };
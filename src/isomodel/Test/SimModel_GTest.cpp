@@ -302,3 +302,48 @@ TEST_F(ISOModelFixture, SimModel) {
   EXPECT_DOUBLE_EQ(0, results.monthlyResults[10].getEndUse(EndUseFuelType::Gas, EndUseCategoryType::WaterSystems));
   EXPECT_DOUBLE_EQ(0, results.monthlyResults[11].getEndUse(EndUseFuelType::Gas, EndUseCategoryType::WaterSystems));
 }
+
+TEST_F(ISOModelFixture, SimModel_simulateBatch) {
+  UserModel userModel;
+  userModel.load(resourcesPath() / openstudio::toPath("isomodel/exampleModel.ISO"));
+  ASSERT_TRUE(userModel.valid());
+
+  // more variants than a simulation block holds, covering the branches of the calculations
+  std::vector<UserModel> userModels;
+  for (int i = 0; i < 300; i++) {
+    UserModel variant = userModel;
+    variant.setFloorArea(userModel.floorArea() * (1.0 + 0.01 * (i % 50)));
+    variant.setHeatingOccupiedSetpoint(userModel.heatingOccupiedSetpoint() - 0.1 * (i % 20));
+    variant.setWindowAreaS(userModel.windowAreaS() * (1.0 + 0.02 * (i % 10)));
+    variant.setHeatingEnergyCarrier(1 + (i % 2));
+    variant.setDhwEnergyCarrier(1 + (i % 3 == 0));
+    variant.setVentilationType(1 + (i % 3));
+    variant.setBemType(1 + (i % 3));
+    variant.setWindowSDFS(1 + (i % 3));
+    if (i % 5 == 0) {
+      variant.setHeatingPumpControl(0);
+    }
+    if (i % 7 == 0) {
+      variant.setInfiltration(0);
+    }
+    userModels.push_back(variant);
+  }
+
+  std::vector<ISOResults> batchResults = UserModel::simulate(userModels);
+  ASSERT_EQ(userModels.size(), batchResults.size());
+
+  for (size_t i = 0; i < userModels.size(); i++) {
+    ISOResults results = userModels[i].toSimModel().simulate();
+    ASSERT_EQ(12u, batchResults[i].monthlyResults.size());
+    for (size_t month = 0; month < 12; month++) {
+      for (const auto& fuelType : EndUses::fuelTypes()) {
+        for (const auto& category : EndUses::categories()) {
+          // identical, not only close
+          EXPECT_EQ(results.monthlyResults[month].getEndUse(fuelType, category),
+                    batchResults[i].monthlyResults[month].getEndUse(fuelType, category))
+            << "variant " << i << ", month " << month;
+        }
+      }
+    }
+  }
+}
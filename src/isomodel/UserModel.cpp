@@ -195,6 +195,15 @@ namespace isomodel {
     sim.setVentilation(ventilation);
     return sim;
   }
+
+  std::vector<ISOResults> UserModel::simulate(std::vector<UserModel>& userModels) {
+    std::vector<SimModel> simModels;
+    simModels.reserve(userModels.size());
+    for (auto& userModel : userModels) {
+      simModels.push_back(userModel.toSimModel());
+    }
+    return SimModel::simulate(simModels);
+  }
   //http://stackoverflow.com/questions/10051679/c-tokenize-string
   std::vector<std::string> inline stringSplit(const std::string& source, char delimiter = ' ', bool keepEmpty = false) {
     std::vector<std::string> results;
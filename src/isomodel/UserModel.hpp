@@ -47,6 +47,13 @@ namespace isomodel {
      */
     SimModel toSimModel();
 
+    /**
+     * Generates the SimModel of each of userModels and simulates them
+     * together, see SimModel::simulate(simModels). Variants of a model
+     * copied after its weather was loaded share that weather data.
+     */
+    static std::vector<ISOResults> simulate(std::vector<UserModel>& userModels);
+
     /**
      * Indicates whether or not the user model loaded in correctly
      * If either the ISO file or the Weather File cannot be found
@@ -0,0 +1,60 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#include <benchmark/benchmark.h>
+
+#include "../SimModel.hpp"
+#include "../UserModel.hpp"
+
+#include "../../utilities/core/Path.hpp"
+
+#include <resources.hxx>
+
+using namespace openstudio;
+using namespace openstudio::isomodel;
+
+// Variants of the example model, as a parametric study would generate them
+static std::vector<SimModel> simModelVariants(std::size_t numVariants) {
+  UserModel userModel;
+  userModel.load(resourcesPath() / toPath("isomodel/exampleModel.ISO"));
+
+  std::vector<SimModel> result;
+  result.reserve(numVariants);
+  for (std::size_t i = 0; i < numVariants; ++i) {
+    UserModel variant = userModel;
+    variant.setFloorArea(userModel.floorArea() * (1.0 + 0.01 * (i % 50)));
+    variant.setHeatingOccupiedSetpoint(userModel.heatingOccupiedSetpoint() - 0.1 * (i % 20));
+    variant.setCoolingOccupiedSetpoint(userModel.coolingOccupiedSetpoint() + 0.1 * (i % 20));
+    variant.setWindowAreaS(userModel.windowAreaS() * (1.0 + 0.02 * (i % 10)));
+    variant.setInfiltration(userModel.infiltration() * (1.0 + 0.05 * (i % 7)));
+    result.push_back(variant.toSimModel());
+  }
+  return result;
+}
+
+static void BM_SimModel_simulate(benchmark::State& state) {
+  std::vector<SimModel> simModels = simModelVariants(static_cast<std::size_t>(state.range(0)));
+
+  for (auto _ : state) {
+    for (const SimModel& simModel : simModels) {
+      ISOResults results = simModel.simulate();
+      benchmark::DoNotOptimize(results);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_SimModel_simulateBatch(benchmark::State& state) {
+  std::vector<SimModel> simModels = simModelVariants(static_cast<std::size_t>(state.range(0)));
+
+  for (auto _ : state) {
+    std::vector<ISOResults> results = SimModel::simulate(simModels);
+    benchmark::DoNotOptimize(results);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(BM_SimModel_simulate)->RangeMultiplier(8)->Range(1, 4096)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_SimModel_simulateBatch)->RangeMultiplier(8)->Range(1, 4096)->Unit(benchmark::kMillisecond);
@@ -634,14 +634,33 @@ namespace model {
       return result;
     }
 
-    double Building_Impl::floorArea() const {
-      double result = 0;
-      for (const Space& space : spaces()) {
-        if (space.partofTotalFloorArea()) {
-          result += space.multiplier() * space.floorArea();
+    template <typename Compute>
+    double Building_Impl::cachedAggregate(boost::optional<double>& cachedValue, Compute compute) const {
+      const unsigned changeVersion = model().getImpl<Model_Impl>()->changeVersion();
+      if (changeVersion != m_cachedAggregatesVersion) {
+        for (boost::optional<double>* cache :
+             {&m_cachedFloorArea, &m_cachedExteriorSurfaceArea, &m_cachedExteriorWallArea, &m_cachedAirVolume, &m_cachedNumberOfPeople,
+              &m_cachedLightingPower, &m_cachedElectricEquipmentPower, &m_cachedGasEquipmentPower, &m_cachedInfiltrationDesignFlowRate}) {
+          cache->reset();
         }
+        m_cachedAggregatesVersion = changeVersion;
       }
-      return result;
+      if (!cachedValue) {
+        cachedValue = compute();
+      }
+      return *cachedValue;
+    }
+
+    double Building_Impl::floorArea() const {
+      return cachedAggregate(m_cachedFloorArea, [this]() {
+        double result = 0;
+        for (const Space& space : spaces()) {
+          if (space.partofTotalFloorArea()) {
+            result += space.multiplier() * space.floorArea();
+          }
+        }
+        return result;
+      });
     }
 
     boost::optional<double> Building_Impl::conditionedFloorArea() const {
@@ -671,41 +690,49 @@ namespace model {
     }
 
     double Building_Impl::exteriorSurfaceArea() const {
-      double result(0.0);
-      for (const Surface& surface : model().getConcreteModelObjects<Surface>()) {
-        OptionalSpace space = surface.space();
-        std::string outsideBoundaryCondition = surface.outsideBoundaryCondition();
-        if (space && openstudio::istringEqual(outsideBoundaryCondition, "Outdoors")) {
-          result += surface.grossArea() * space->multiplier();
+      return cachedAggregate(m_cachedExteriorSurfaceArea, [this]() {
+        double result(0.0);
+        for (const Surface& surface : model().getConcreteModelObjects<Surface>()) {
+          OptionalSpace space = surface.space();
+          std::string outsideBoundaryCondition = surface.outsideBoundaryCondition();
+          if (space && openstudio::istringEqual(outsideBoundaryCondition, "Outdoors")) {
+            result += surface.grossArea() * space->multiplier();
+          }
         }
-      }
-      return result;
+        return result;
+      });
     }
 
     double Building_Impl::exteriorWallArea() const {
-      double result(0.0);
-      for (const Surface& exteriorWall : exteriorWalls()) {
-        if (OptionalSpace space = exteriorWall.space()) {
-          result += exteriorWall.grossArea() * space->multiplier();
+      return cachedAggregate(m_cachedExteriorWallArea, [this]() {
+        double result(0.0);
+        for (const Surface& exteriorWall : exteriorWalls()) {
+          if (OptionalSpace space = exteriorWall.space()) {
+            result += exteriorWall.grossArea() * space->multiplier();
+          }
         }
-      }
-      return result;
+        return result;
+      });
     }
 
     double Building_Impl::airVolume() const {
-      double result(0.0);
-      for (const Space& space : spaces()) {
-        result += space.volume() * space.multiplier();
-      }
-      return result;
+      return cachedAggregate(m_cachedAirVolume, [this]() {
+        double result(0.0);
+        for (const Space& space : spaces()) {
+          result += space.volume() * space.multiplier();
+        }
+        return result;
+      });
     }
 
     double Building_Impl::numberOfPeople() const {
-      double result(0.0);
-      for (const Space& space : spaces()) {
-        result += space.numberOfPeople() * space.multiplier();
-      }
-      return result;
+      return cachedAggregate(m_cachedNumberOfPeople, [this]() {
+        double result(0.0);
+        for (const Space& space : spaces()) {
+          result += space.numberOfPeople() * space.multiplier();
+        }
+        return result;
+      });
     }
 
     double Building_Impl::peoplePerFloorArea() const {
@@ -733,11 +760,13 @@ namespace model {
     }
 
     double Building_Impl::lightingPower() const {
-      double result(0.0);
-      for (const Space& space : spaces()) {
-        result += space.multiplier() * space.lightingPower();
-      }
-      return result;
+      return cachedAggregate(m_cachedLightingPower, [this]() {
+        double result(0.0);
+        for (const Space& space : spaces()) {
+          result += space.multiplier() * space.lightingPower();
+        }
+        return result;
+      });
     }
 
     double Building_Impl::lightingPowerPerFloorArea() const {
@@ -770,11 +799,13 @@ namespace model {
     }
 
     double Building_Impl::electricEquipmentPower() const {
-      double result(0.0);
-      for (const Space& space : spaces()) {
-        result += space.multiplier() * space.electricEquipmentPower();
-      }
-      return result;
+      return cachedAggregate(m_cachedElectricEquipmentPower, [this]() {
+        double result(0.0);
+        for (const Space& space : spaces()) {
+          result += space.multiplier() * space.electricEquipmentPower();
+        }
+        return result;
+      });
     }
 
     double Building_Impl::electricEquipmentPowerPerFloorArea() const {
@@ -808,11 +839,13 @@ namespace model {
     }
 
     double Building_Impl::gasEquipmentPower() const {
-      double result(0.0);
-      for (const Space& space : spaces()) {
-        result += space.multiplier() * space.gasEquipmentPower();
-      }
-      return result;
+      return cachedAggregate(m_cachedGasEquipmentPower, [this]() {
+        double result(0.0);
+        for (const Space& space : spaces()) {
+          result += space.multiplier() * space.gasEquipmentPower();
+        }
+        return result;
+      });
     }
 
     double Building_Impl::gasEquipmentPowerPerFloorArea() const {
@@ -846,11 +879,13 @@ namespace model {
     }
 
     double Building_Impl::infiltrationDesignFlowRate() const {
-      double result(0.0);
-      for (const Space& space : spaces()) {
-        result += space.multiplier() * space.infiltrationDesignFlowRate();
-      }
-      return result;
+      return cachedAggregate(m_cachedInfiltrationDesignFlowRate, [this]() {
+        double result(0.0);
+        for (const Space& space : spaces()) {
+          result += space.multiplier() * space.infiltrationDesignFlowRate();
+        }
+        return result;
+      });
     }
 
     double Building_Impl::infiltrationDesignFlowPerSpaceFloorArea() const {
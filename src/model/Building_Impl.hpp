@@ -230,6 +230,21 @@ namespace model {
       bool setSpaceTypeAsModelObject(const boost::optional<ModelObject>& modelObject);
       bool setDefaultConstructionSetAsModelObject(const boost::optional<ModelObject>& modelObject);
       bool setDefaultScheduleSetAsModelObject(const boost::optional<ModelObject>& modelObject);
+
+      // returns cachedValue, computing it first if the model changed since the aggregates were last cached
+      template <typename Compute>
+      double cachedAggregate(boost::optional<double>& cachedValue, Compute compute) const;
+
+      mutable unsigned m_cachedAggregatesVersion = 0;
+      mutable boost::optional<double> m_cachedFloorArea;
+      mutable boost::optional<double> m_cachedExteriorSurfaceArea;
+      mutable boost::optional<double> m_cachedExteriorWallArea;
+      mutable boost::optional<double> m_cachedAirVolume;
+      mutable boost::optional<double> m_cachedNumberOfPeople;
+      mutable boost::optional<double> m_cachedLightingPower;
+      mutable boost::optional<double> m_cachedElectricEquipmentPower;
+      mutable boost::optional<double> m_cachedGasEquipmentPower;
+      mutable boost::optional<double> m_cachedInfiltrationDesignFlowRate;
     };
 
   }  // namespace detail
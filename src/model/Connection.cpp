@@ -6,6 +6,8 @@
 #include "Connection.hpp"
 #include "Connection_Impl.hpp"
 #include "ModelObject.hpp"
+#include "Model.hpp"
+#include "Model_Impl.hpp"
 
 #include "../utilities/core/Assert.hpp"
 #include "../utilities/core/Compare.hpp"
@@ -23,14 +25,21 @@ namespace model {
     Connection_Impl::Connection_Impl(const IdfObject& idfObject, Model_Impl* model, bool keepHandle)
       : ModelObject_Impl(idfObject, model, keepHandle) {
       OS_ASSERT(idfObject.iddObject().type() == Connection::iddObjectType());
+      this->Connection_Impl::onChange.connect<Connection_Impl, &Connection_Impl::incrementHvacTopologyVersion>(this);
+      model->incrementHvacTopologyVersion();
     }
 
     Connection_Impl::Connection_Impl(const openstudio::detail::WorkspaceObject_Impl& other, Model_Impl* model, bool keepHandle)
       : ModelObject_Impl(other, model, keepHandle) {
       OS_ASSERT(other.iddObject().type() == Connection::iddObjectType());
+      this->Connection_Impl::onChange.connect<Connection_Impl, &Connection_Impl::incrementHvacTopologyVersion>(this);
+      model->incrementHvacTopologyVersion();
     }
 
-    Connection_Impl::Connection_Impl(const Connection_Impl& other, Model_Impl* model, bool keepHandle) : ModelObject_Impl(other, model, keepHandle) {}
+    Connection_Impl::Connection_Impl(const Connection_Impl& other, Model_Impl* model, bool keepHandle) : ModelObject_Impl(other, model, keepHandle) {
+      this->Connection_Impl::onChange.connect<Connection_Impl, &Connection_Impl::incrementHvacTopologyVersion>(this);
+      model->incrementHvacTopologyVersion();
+    }
 
     // virtual destructor
 
@@ -84,6 +93,10 @@ namespace model {
       return this->setUnsigned(openstudio::OS_ConnectionFields::InletPort, port);
     }
 
+    void Connection_Impl::incrementHvacTopologyVersion() {
+      model().getImpl<Model_Impl>()->incrementHvacTopologyVersion();
+    }
+
   }  // namespace detail
 
   Connection::Connection(const Model& model)
@@ -46,6 +46,9 @@ namespace model {
 
      private:
       REGISTER_LOGGER("openstudio.model.Connection");
+
+      // the edges between HVAC components go through connections, so any change of one changes the HVAC topology
+      void incrementHvacTopologyVersion();
     };
 
   }  // namespace detail
@@ -27,21 +27,40 @@
 #include "../utilities/core/Assert.hpp"
 // #include "../utilities/data/DataEnums.hpp"
 
+#include <algorithm>
+
 namespace openstudio {
 namespace model {
 
   namespace detail {
 
-    HVACComponent_Impl::HVACComponent_Impl(IddObjectType type, Model_Impl* model) : ParentObject_Impl(type, model) {}
+    HVACComponent_Impl::HVACComponent_Impl(IddObjectType type, Model_Impl* model) : ParentObject_Impl(type, model) {
+      this->HVACComponent_Impl::onRelationshipChange.connect<HVACComponent_Impl, &HVACComponent_Impl::relationshipChange>(this);
+    }
 
     HVACComponent_Impl::HVACComponent_Impl(const IdfObject& idfObject, Model_Impl* model, bool keepHandle)
-      : ParentObject_Impl(idfObject, model, keepHandle) {}
+      : ParentObject_Impl(idfObject, model, keepHandle) {
+      this->HVACComponent_Impl::onRelationshipChange.connect<HVACComponent_Impl, &HVACComponent_Impl::relationshipChange>(this);
+    }
 
     HVACComponent_Impl::HVACComponent_Impl(const openstudio::detail::WorkspaceObject_Impl& other, Model_Impl* model, bool keepHandle)
-      : ParentObject_Impl(other, model, keepHandle) {}
+      : ParentObject_Impl(other, model, keepHandle) {
+      this->HVACComponent_Impl::onRelationshipChange.connect<HVACComponent_Impl, &HVACComponent_Impl::relationshipChange>(this);
+    }
 
     HVACComponent_Impl::HVACComponent_Impl(const HVACComponent_Impl& other, Model_Impl* model, bool keepHandles)
-      : ParentObject_Impl(other, model, keepHandles) {}
+      : ParentObject_Impl(other, model, keepHandles) {
+      this->HVACComponent_Impl::onRelationshipChange.connect<HVACComponent_Impl, &HVACComponent_Impl::relationshipChange>(this);
+    }
+
+    void HVACComponent_Impl::relationshipChange(int index, Handle /*newHandle*/, Handle /*oldHandle*/) {
+      if (boost::optional<IddField> iddField = iddObject().getField(index)) {
+        const std::vector<std::string>& objectLists = iddField->properties().objectLists;
+        if (std::find(objectLists.begin(), objectLists.end(), "ConnectionNames") != objectLists.end()) {
+          model().getImpl<Model_Impl>()->incrementHvacTopologyVersion();
+        }
+      }
+    }
 
     boost::optional<Loop> HVACComponent_Impl::loop() const {
       if (boost::optional<AirLoopHVAC> airLoopHVAC = this->airLoopHVAC()) {
@@ -110,6 +110,9 @@ namespace model {
      private:
       REGISTER_LOGGER("openstudio.model.HVACComponent");
 
+      // increments the HVAC topology version of the model when a port is pointed to another Connection
+      void relationshipChange(int index, Handle newHandle, Handle oldHandle);
+
       boost::optional<ModelObject> airLoopHVACAsModelObject() const;
       boost::optional<ModelObject> plantLoopAsModelObject() const;
       boost::optional<ModelObject> airLoopHVACOutdoorAirSystemAsModelObject() const;
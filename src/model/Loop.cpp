@@ -28,6 +28,7 @@
 #include "ConnectorSplitter.hpp"
 #include "ConnectorSplitter_Impl.hpp"
 #include "Model.hpp"
+#include "Model_Impl.hpp"
 
 #include "../utilities/core/Assert.hpp"
 #include "../utilities/core/ContainersMove.hpp"
@@ -37,6 +38,7 @@
 
 #include <algorithm>
 #include <functional>
+#include <unordered_set>
 
 namespace openstudio {
 
@@ -179,61 +181,100 @@ namespace model {
       return result;
     }
 
-    // Recursive depth first search
-    // start algorithm with one source node in the visited vector
-    // when complete, paths will be populated with all nodes between the source node and sink
-    void findModelObjects(const HVACComponent& sink, std::vector<HVACComponent>& visited, std::vector<HVACComponent>& paths,
-                          bool isDemandComponents) {
-      boost::optional<HVACComponent> prev;
-      if (visited.size() >= 2u) {
-        prev = visited.rbegin()[1];
+    const std::vector<HVACComponent>& Loop_Impl::cachedEdges(const HVACComponent& component, const boost::optional<HVACComponent>& prev) const {
+      EdgeKey key(component.handle(), prev ? prev->handle() : Handle());
+      auto it = m_cachedEdges.find(key);
+      if (it == m_cachedEdges.end()) {
+        it = m_cachedEdges.emplace(key, component.getImpl<HVACComponent_Impl>()->edges(prev)).first;
       }
+      return it->second;
+    }
 
-      std::vector<HVACComponent> nodes = visited.back().getImpl<HVACComponent_Impl>()->edges(prev);
+    // Depth first search from inletComp, each component is entered from each of its neighbors at most once so the
+    // search is linear in the number of edges. A component is added to the result the first time a path through it
+    // reaches outletComp, which keeps the order of the previous search that enumerated every path.
+    std::vector<HVACComponent> Loop_Impl::findComponents(const HVACComponent& inletComp, const HVACComponent& outletComp) const {
+      if (inletComp == outletComp) {
+        return {inletComp};
+      }
 
-      for (const auto& node : nodes) {
-        // if it node has already been visited then continue
-        if (std::find(visited.begin(), visited.end(), node) != visited.end()) {
-          continue;
+      unsigned version = model().getImpl<Model_Impl>()->hvacTopologyVersion();
+      if (version != m_cachedEdgesVersion) {
+        m_cachedEdges.clear();
+        m_cachedEdgesVersion = version;
+      }
+
+      using HandleSet = std::unordered_set<Handle, boost::hash<boost::uuids::uuid>>;
+
+      std::vector<HVACComponent> result;
+      HandleSet inResult;
+
+      // the current path, and whether each (component, prev) already searched reaches outletComp
+      std::vector<HVACComponent> path{inletComp};
+      HandleSet onPath{inletComp.handle()};
+      std::unordered_map<EdgeKey, bool, boost::hash<EdgeKey>> searched;
+
+      auto addPath = [&]() {
+        for (const auto& comp : path) {
+          if (inResult.insert(comp.handle()).second) {
+            result.push_back(comp);
+          }
+        }
+      };
+
+      std::function<bool()> search = [&]() -> bool {
+        HVACComponent current = path.back();
+        boost::optional<HVACComponent> prev;
+        if (path.size() >= 2u) {
+          prev = path.rbegin()[1];
         }
-        if (node == sink) {
-          visited.push_back(node);
-          // Avoid pushing duplicate nodes into paths
-          if (paths.empty()) {
-            paths.insert(paths.end(), visited.begin(), visited.end());
-          } else {
-            for (const auto& visitedit : visited) {
-              if (std::find(paths.begin(), paths.end(), visitedit) == paths.end()) {
-                paths.push_back(visitedit);
-              }
-            }
+
+        EdgeKey key(current.handle(), prev ? prev->handle() : Handle());
+        auto it = searched.find(key);
+        if (it != searched.end()) {
+          // components past this point are already in the result
+          if (it->second) {
+            addPath();
           }
-          visited.pop_back();
+          return it->second;
         }
-      }
+        searched.emplace(key, false);
 
-      for (const auto& node : nodes) {
-        // if it node has already been visited or node is sink then continue
-        if (std::find(visited.begin(), visited.end(), node) != visited.end() || node == sink) {
-          continue;
+        const std::vector<HVACComponent>& nodes = cachedEdges(current, prev);
+
+        bool reachesOutlet = false;
+        if (std::find(nodes.begin(), nodes.end(), outletComp) != nodes.end()) {
+          path.push_back(outletComp);
+          addPath();
+          path.pop_back();
+          reachesOutlet = true;
         }
-        visited.push_back(node);
-        findModelObjects(sink, visited, paths, isDemandComponents);
-        visited.pop_back();
-      }
+
+        for (const auto& node : nodes) {
+          if ((node == outletComp) || (onPath.count(node.handle()) != 0)) {
+            continue;
+          }
+          path.push_back(node);
+          onPath.insert(node.handle());
+          if (search()) {
+            reachesOutlet = true;
+          }
+          onPath.erase(node.handle());
+          path.pop_back();
+        }
+
+        searched[key] = reachesOutlet;
+        return reachesOutlet;
+      };
+
+      search();
+
+      return result;
     }
 
     std::vector<ModelObject> Loop_Impl::demandComponents(const HVACComponent& inletComp, const HVACComponent& outletComp,
                                                          openstudio::IddObjectType type) const {
-      std::vector<HVACComponent> visited;
-      visited.push_back(inletComp);
-      std::vector<HVACComponent> allPaths;
-
-      if (inletComp == outletComp) {
-        allPaths.push_back(inletComp);
-      } else {
-        findModelObjects(outletComp, visited, allPaths, true);
-      }
+      std::vector<HVACComponent> allPaths = findComponents(inletComp, outletComp);
       std::vector<ModelObject> modelObjects = std::vector<ModelObject>(allPaths.begin(), allPaths.end());
 
       // Filter modelObjects for type
@@ -304,15 +345,7 @@ namespace model {
 
     std::vector<ModelObject> Loop_Impl::supplyComponents(const HVACComponent& inletComp, const HVACComponent& outletComp,
                                                          openstudio::IddObjectType type) const {
-      std::vector<HVACComponent> visited;
-      visited.push_back(inletComp);
-      std::vector<HVACComponent> allPaths;
-
-      if (inletComp == outletComp) {
-        allPaths.push_back(inletComp);
-      } else {
-        findModelObjects(outletComp, visited, allPaths, false);
-      }
+      std::vector<HVACComponent> allPaths = findComponents(inletComp, outletComp);
       std::vector<ModelObject> modelObjects = std::vector<ModelObject>(allPaths.begin(), allPaths.end());
 
       // Filter modelObjects for type
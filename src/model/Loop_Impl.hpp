@@ -7,6 +7,11 @@
 #define MODEL_LOOP_IMPL_HPP
 
 #include "ParentObject_Impl.hpp"
+#include "HVACComponent.hpp"
+
+#include <boost/functional/hash.hpp>
+
+#include <unordered_map>
 
 namespace openstudio {
 
@@ -113,6 +118,18 @@ namespace model {
       boost::optional<ModelObject> supplyOutletNodeAsModelObject() const;
       boost::optional<ModelObject> demandInletNodeAsModelObject() const;
       boost::optional<ModelObject> demandOutletNodeAsModelObject() const;
+
+      // Returns every component on a path from inletComp to outletComp, in the order a depth first search finds them
+      std::vector<HVACComponent> findComponents(const HVACComponent& inletComp, const HVACComponent& outletComp) const;
+
+      // Returns component's edges when entered from prev, cached until the connections of the model change
+      const std::vector<HVACComponent>& cachedEdges(const HVACComponent& component, const boost::optional<HVACComponent>& prev) const;
+
+      // (component, prev) handles, prev is the null handle at the start of a search
+      using EdgeKey = std::pair<Handle, Handle>;
+
+      mutable std::unordered_map<EdgeKey, std::vector<HVACComponent>, boost::hash<EdgeKey>> m_cachedEdges;
+      mutable unsigned m_cachedEdgesVersion = 0;
     };
 
   }  // namespace detail
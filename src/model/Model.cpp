@@ -57,6 +57,7 @@ namespace model {
     // default constructor
     Model_Impl::Model_Impl() : Workspace_Impl(StrictnessLevel::Draft, IddFileType::OpenStudio) {
       // careful not to call anything that calls shared_from_this here, this is not yet constructed
+      this->Workspace_Impl::onChange.connect<Model_Impl, &Model_Impl::incrementChangeVersion>(this);
     }
 
     Model_Impl::Model_Impl(const IdfFile& idfFile) : Workspace_Impl(idfFile, StrictnessLevel(StrictnessLevel::Draft)) {
@@ -65,6 +66,7 @@ namespace model {
         LOG_AND_THROW("Models must be constructed with the OpenStudio Idd as the underlying "
                       << "data schema. (Attempted construction from IdfFile with IddFileType " << idfFile.iddFileType().valueDescription() << ".)");
       }
+      this->Workspace_Impl::onChange.connect<Model_Impl, &Model_Impl::incrementChangeVersion>(this);
     }
 
     Model_Impl::Model_Impl(const openstudio::detail::Workspace_Impl& workspace, bool keepHandles)
@@ -75,6 +77,7 @@ namespace model {
                       << "data schema. (Attempted construction from Workspace with IddFileType " << workspace.iddFileType().valueDescription()
                       << ".)");
       }
+      this->Workspace_Impl::onChange.connect<Model_Impl, &Model_Impl::incrementChangeVersion>(this);
     }
 
     // copy constructor, used for clone
@@ -84,6 +87,7 @@ namespace model {
         m_workflowJSON(WorkflowJSON(other.m_workflowJSON)) {
       // notice we are cloning the workflow and sqlfile too, if necessary
       // careful not to call anything that calls shared_from_this here, this is not yet constructed
+      this->Workspace_Impl::onChange.connect<Model_Impl, &Model_Impl::incrementChangeVersion>(this);
     }
 
     // copy constructor used for cloneSubset
@@ -92,6 +96,7 @@ namespace model {
         m_sqlFile((other.m_sqlFile) ? (std::shared_ptr<SqlFile>(new SqlFile(*other.m_sqlFile))) : (other.m_sqlFile)),
         m_workflowJSON(WorkflowJSON(other.m_workflowJSON)) {
       // notice we are cloning the workflow and sqlfile too, if necessary
+      this->Workspace_Impl::onChange.connect<Model_Impl, &Model_Impl::incrementChangeVersion>(this);
     }
     Workspace Model_Impl::clone(bool keepHandles) const {
       // copy everything but objects
@@ -1367,6 +1372,22 @@ namespace model {
       return removedObjects;
     }
 
+    unsigned Model_Impl::hvacTopologyVersion() const {
+      return m_hvacTopologyVersion;
+    }
+
+    unsigned Model_Impl::changeVersion() const {
+      return m_changeVersion;
+    }
+
+    void Model_Impl::incrementHvacTopologyVersion() {
+      ++m_hvacTopologyVersion;
+    }
+
+    void Model_Impl::incrementChangeVersion() {
+      ++m_changeVersion;
+    }
+
     void Model_Impl::connect(const Model& m, ModelObject sourceObject, unsigned sourcePort, ModelObject targetObject, unsigned targetPort) {
       disconnect(sourceObject, sourcePort);
       disconnect(targetObject, targetPort);
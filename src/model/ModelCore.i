@@ -196,6 +196,8 @@
   #include <utilities/geometry/ThreeJS.hpp>
 
   #include <utilities/units/Unit.hpp>
+
+  #include <model/ScheduleAnnualProfile.hpp>
 %}
 
 // templates for non-ModelObjects
@@ -369,6 +371,8 @@ SWIG_MODELOBJECT(UtilityBill, 1);
 SWIG_MODELEXTENSIBLEGROUP(BillingPeriod);
 SWIG_MODELOBJECT(ComponentData, 1);
 SWIG_MODELOBJECT(ScheduleTypeLimits, 1); // Needed for OutputVariable
+%include <model/ScheduleAnnualProfile.hpp>
+%template(OptionalScheduleAnnualProfile) boost::optional<openstudio::model::ScheduleAnnualProfile>;
 SWIG_MODELOBJECT(ScheduleBase, 0); // Needed for OutputVariable
 SWIG_MODELOBJECT(Schedule, 0);  // Needed for OutputVariable
 SWIG_MODELOBJECT(ScheduleDay, 1);
@@ -420,6 +420,18 @@ namespace model {
 
       void disconnect(ModelObject object, unsigned port);
 
+      /** Incremented whenever a connection between HVAC components may have changed, that is when a Connection is
+     *  created or changed and when a port of an HVACComponent is pointed to another Connection. Loop uses it to know
+     *  when its cached topology is out of date. */
+      unsigned hvacTopologyVersion() const;
+
+      /** Called by Connection_Impl and HVACComponent_Impl when the HVAC topology may have changed. */
+      void incrementHvacTopologyVersion();
+
+      /** Incremented whenever an object in the model is changed, added or removed. Space and Building use it to
+     *  know when their cached aggregate quantities, such as floor area or lighting power, are out of date. */
+      unsigned changeVersion() const;
+
       //@}
       /** @name Nano Signals */
       //@{
@@ -460,6 +472,12 @@ namespace model {
 
       WorkflowJSON m_workflowJSON;
 
+      unsigned m_hvacTopologyVersion = 0;
+
+      unsigned m_changeVersion = 0;
+
+      void incrementChangeVersion();
+
      private:
       mutable boost::optional<Building> m_cachedBuilding;
       mutable boost::optional<FoundationKivaSettings> m_cachedFoundationKivaSettings;
@@ -11,10 +11,18 @@
 #include "ScheduleTypeRegistry.hpp"
 #include "ScheduleDay.hpp"
 #include "ScheduleDay_Impl.hpp"
+#include "Timestep.hpp"
+#include "Timestep_Impl.hpp"
+#include "YearDescription.hpp"
+#include "YearDescription_Impl.hpp"
 
 #include "../utilities/idf/ValidityReport.hpp"
 
 #include "../utilities/core/Assert.hpp"
+#include "../utilities/time/Date.hpp"
+
+#include <map>
+#include <set>
 
 using openstudio::Handle;
 using openstudio::OptionalHandle;
@@ -31,12 +39,119 @@ namespace model {
   namespace detail {
 
     // constructor
-    Schedule_Impl::Schedule_Impl(const IdfObject& idfObject, Model_Impl* model, bool keepHandle) : ScheduleBase_Impl(idfObject, model, keepHandle) {}
+    Schedule_Impl::Schedule_Impl(const IdfObject& idfObject, Model_Impl* model, bool keepHandle) : ScheduleBase_Impl(idfObject, model, keepHandle) {
+      // connect signals
+      this->Schedule_Impl::onChange.connect<Schedule_Impl, &Schedule_Impl::clearCachedAnnualProfile>(this);
+    }
 
     Schedule_Impl::Schedule_Impl(const openstudio::detail::WorkspaceObject_Impl& other, Model_Impl* model, bool keepHandle)
-      : ScheduleBase_Impl(other, model, keepHandle) {}
+      : ScheduleBase_Impl(other, model, keepHandle) {
+      // connect signals
+      this->Schedule_Impl::onChange.connect<Schedule_Impl, &Schedule_Impl::clearCachedAnnualProfile>(this);
+    }
+
+    Schedule_Impl::Schedule_Impl(const Schedule_Impl& other, Model_Impl* model, bool keepHandles) : ScheduleBase_Impl(other, model, keepHandles) {
+      // connect signals
+      this->Schedule_Impl::onChange.connect<Schedule_Impl, &Schedule_Impl::clearCachedAnnualProfile>(this);
+    }
+
+    boost::optional<ScheduleAnnualProfile> Schedule_Impl::annualProfile() const {
+      int numberOfTimestepsPerHour = 6;
+      if (boost::optional<Timestep> timestep = this->model().getOptionalUniqueModelObject<Timestep>()) {
+        numberOfTimestepsPerHour = timestep->numberOfTimestepsPerHour();
+      }
+      return annualProfile(numberOfTimestepsPerHour);
+    }
+
+    boost::optional<ScheduleAnnualProfile> Schedule_Impl::annualProfile(int numberOfTimestepsPerHour) const {
+      if ((numberOfTimestepsPerHour < 1) || (numberOfTimestepsPerHour > 60) || (60 % numberOfTimestepsPerHour != 0)) {
+        LOG(Error, "Cannot compute the annual profile of " << briefDescription() << " at " << numberOfTimestepsPerHour
+                                                           << " timesteps per hour, it must divide 60.");
+        return boost::none;
+      }
+
+      int year = openstudio::YearDescription().assumedYear();
+      if (boost::optional<YearDescription> yearDescription = this->model().getOptionalUniqueModelObject<YearDescription>()) {
+        year = yearDescription->assumedYear();
+      }
+
+      if (m_cachedAnnualProfile && (m_cachedAnnualProfile->numberOfTimestepsPerHour() == numberOfTimestepsPerHour)
+          && (m_cachedAnnualProfile->year() == year)) {
+        return m_cachedAnnualProfile;
+      }
 
-    Schedule_Impl::Schedule_Impl(const Schedule_Impl& other, Model_Impl* model, bool keepHandles) : ScheduleBase_Impl(other, model, keepHandles) {}
+      auto* mutableThis = const_cast<Schedule_Impl*>(this);
+
+      // stop listening to the objects the previous profile was made of
+      for (const std::weak_ptr<ModelObject_Impl>& weakSource : m_annualProfileSources) {
+        if (std::shared_ptr<ModelObject_Impl> source = weakSource.lock()) {
+          source->ModelObject_Impl::onChange.disconnect<Schedule_Impl, &Schedule_Impl::clearCachedAnnualProfile>(mutableThis);
+          source->ModelObject_Impl::onRemoveFromWorkspace.disconnect<Schedule_Impl, &Schedule_Impl::onAnnualProfileSourceRemoved>(mutableThis);
+        }
+      }
+      m_annualProfileSources.clear();
+      m_cachedAnnualProfile.reset();
+
+      std::vector<ModelObject> sources;
+      boost::optional<std::vector<double>> values = annualValues(year, numberOfTimestepsPerHour, sources);
+      if (!values) {
+        return boost::none;
+      }
+
+      std::set<Handle> connected{this->handle()};
+      for (const ModelObject& source : sources) {
+        if (connected.insert(source.handle()).second) {
+          std::shared_ptr<ModelObject_Impl> sourceImpl = source.getImpl<ModelObject_Impl>();
+          sourceImpl->ModelObject_Impl::onChange.connect<Schedule_Impl, &Schedule_Impl::clearCachedAnnualProfile>(mutableThis);
+          sourceImpl->ModelObject_Impl::onRemoveFromWorkspace.connect<Schedule_Impl, &Schedule_Impl::onAnnualProfileSourceRemoved>(mutableThis);
+          m_annualProfileSources.push_back(sourceImpl);
+        }
+      }
+
+      m_cachedAnnualProfile = ScheduleAnnualProfile(year, numberOfTimestepsPerHour, std::move(*values));
+      return m_cachedAnnualProfile;
+    }
+
+    boost::optional<std::vector<double>> Schedule_Impl::annualValues(int /*year*/, int /*numberOfTimestepsPerHour*/,
+                                                                     std::vector<ModelObject>& /*sources*/) const {
+      LOG(Warn, "Cannot compute the annual profile of " << briefDescription() << ", this type of schedule is not supported.");
+      return boost::none;
+    }
+
+    std::vector<double> Schedule_Impl::annualValuesFromDaySchedules(const std::vector<boost::optional<ScheduleDay>>& daySchedules,
+                                                                    int numberOfTimestepsPerHour) {
+      const unsigned timestepsPerDay = 24 * numberOfTimestepsPerHour;
+
+      std::vector<double> result(daySchedules.size() * timestepsPerDay, 0.0);
+
+      // the same few day schedules are usually repeated over the year, only compute each one once
+      std::map<Handle, std::vector<double>> dayValues;
+      for (unsigned i = 0; i < daySchedules.size(); ++i) {
+        if (!daySchedules[i]) {
+          continue;
+        }
+        auto it = dayValues.find(daySchedules[i]->handle());
+        if (it == dayValues.end()) {
+          it = dayValues
+                 .emplace(daySchedules[i]->handle(),
+                          daySchedules[i]->getImpl<ScheduleDay_Impl>()->timestepValues(numberOfTimestepsPerHour))
+                 .first;
+        }
+        if (it->second.size() == timestepsPerDay) {
+          std::copy(it->second.begin(), it->second.end(), result.begin() + i * timestepsPerDay);
+        }
+      }
+
+      return result;
+    }
+
+    void Schedule_Impl::clearCachedAnnualProfile() {
+      m_cachedAnnualProfile.reset();
+    }
+
+    void Schedule_Impl::onAnnualProfileSourceRemoved(const Handle& /*handle*/) {
+      m_cachedAnnualProfile.reset();
+    }
 
     bool Schedule_Impl::candidateIsCompatibleWithCurrentUse(const ScheduleTypeLimits& candidate) const {
       ModelObjectVector users = getObject<Schedule>().getModelObjectSources<ModelObject>();
@@ -78,5 +193,13 @@ namespace model {
     OS_ASSERT(getImpl<detail::Schedule_Impl>());
   }
 
+  boost::optional<ScheduleAnnualProfile> Schedule::annualProfile() const {
+    return getImpl<detail::Schedule_Impl>()->annualProfile();
+  }
+
+  boost::optional<ScheduleAnnualProfile> Schedule::annualProfile(int numberOfTimestepsPerHour) const {
+    return getImpl<detail::Schedule_Impl>()->annualProfile(numberOfTimestepsPerHour);
+  }
+
 }  // namespace model
 }  // namespace openstudio
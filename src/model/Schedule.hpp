@@ -8,6 +8,7 @@
 
 #include "ModelAPI.hpp"
 #include "ScheduleBase.hpp"
+#include "ScheduleAnnualProfile.hpp"
 
 namespace openstudio {
 namespace model {
@@ -44,6 +45,20 @@ namespace model {
     Schedule& operator=(const Schedule&) = default;
     Schedule& operator=(Schedule&&) = default;
 
+    //@}
+    /** @name Getters */
+    //@{
+
+    /** Returns the values of this schedule at every timestep of the year, at the number of timesteps per hour of
+   *  the model's Timestep (6 if there is none). The year, and so the day of week of each date, is the assumed year
+   *  of the model's YearDescription. Holidays, special days and design days are not applied. The profile is
+   *  computed once and kept until this schedule, or one of the objects it is made of, changes. Returns
+   *  boost::none if the schedule cannot be evaluated, for instance a ScheduleFile whose file cannot be read. */
+    boost::optional<ScheduleAnnualProfile> annualProfile() const;
+
+    /** \overload numberOfTimestepsPerHour must divide 60. */
+    boost::optional<ScheduleAnnualProfile> annualProfile(int numberOfTimestepsPerHour) const;
+
     //@}
    protected:
     /// @cond
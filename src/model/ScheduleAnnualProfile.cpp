@@ -0,0 +1,98 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#include "ScheduleAnnualProfile.hpp"
+
+#include "../utilities/data/Vector.hpp"
+#include "../utilities/core/Assert.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <utility>
+
+namespace openstudio {
+namespace model {
+
+  ScheduleAnnualProfile::ScheduleAnnualProfile(int year, int numberOfTimestepsPerHour, std::vector<double> values)
+    : m_year(year),
+      m_numberOfTimestepsPerHour(numberOfTimestepsPerHour),
+      m_values(std::move(values)),
+      m_minimumValue(0.0),
+      m_maximumValue(0.0),
+      m_equivalentFullLoadHours(0.0) {
+    OS_ASSERT(m_numberOfTimestepsPerHour > 0);
+    OS_ASSERT(m_values.size() == numberOfDays() * 24 * static_cast<unsigned>(m_numberOfTimestepsPerHour));
+
+    const auto [minIt, maxIt] = std::minmax_element(m_values.begin(), m_values.end());
+    m_minimumValue = *minIt;
+    m_maximumValue = *maxIt;
+    m_equivalentFullLoadHours = std::accumulate(m_values.begin(), m_values.end(), 0.0) / m_numberOfTimestepsPerHour;
+  }
+
+  int ScheduleAnnualProfile::year() const {
+    return m_year;
+  }
+
+  int ScheduleAnnualProfile::numberOfTimestepsPerHour() const {
+    return m_numberOfTimestepsPerHour;
+  }
+
+  unsigned ScheduleAnnualProfile::numberOfDays() const {
+    return Date::isLeapYear(m_year) ? 366 : 365;
+  }
+
+  const std::vector<double>& ScheduleAnnualProfile::values() const {
+    return m_values;
+  }
+
+  double ScheduleAnnualProfile::value(const openstudio::Date& date, const openstudio::Time& time) const {
+    const int secondsPerTimestep = 3600 / m_numberOfTimestepsPerHour;
+    const int timestepsPerDay = 24 * m_numberOfTimestepsPerHour;
+
+    // timesteps are period ending, round up to the timestep that contains time
+    int timestep = (time.totalSeconds() + secondsPerTimestep - 1) / secondsPerTimestep - 1;
+    timestep = std::clamp(timestep, 0, timestepsPerDay - 1);
+
+    return m_values[dayIndex(date) * timestepsPerDay + timestep];
+  }
+
+  double ScheduleAnnualProfile::value(const openstudio::DateTime& dateTime) const {
+    return value(dateTime.date(), dateTime.time());
+  }
+
+  std::vector<double> ScheduleAnnualProfile::dailyValues(const openstudio::Date& date) const {
+    const unsigned timestepsPerDay = 24 * m_numberOfTimestepsPerHour;
+    auto begin = m_values.begin() + dayIndex(date) * timestepsPerDay;
+    return {begin, begin + timestepsPerDay};
+  }
+
+  double ScheduleAnnualProfile::minimumValue() const {
+    return m_minimumValue;
+  }
+
+  double ScheduleAnnualProfile::maximumValue() const {
+    return m_maximumValue;
+  }
+
+  double ScheduleAnnualProfile::equivalentFullLoadHours() const {
+    return m_equivalentFullLoadHours;
+  }
+
+  openstudio::TimeSeries ScheduleAnnualProfile::timeSeries() const {
+    const Time intervalLength(0, 0, 60 / m_numberOfTimestepsPerHour);
+    const DateTime firstReportDateTime(Date(MonthOfYear::Jan, 1, m_year), intervalLength);
+    return {firstReportDateTime, intervalLength, createVector(m_values), ""};
+  }
+
+  unsigned ScheduleAnnualProfile::dayIndex(const openstudio::Date& date) const {
+    unsigned dayOfMonth = date.dayOfMonth();
+    if ((date.monthOfYear() == MonthOfYear::Feb) && (dayOfMonth == 29) && !Date::isLeapYear(m_year)) {
+      dayOfMonth = 28;
+    }
+    return Date(date.monthOfYear(), dayOfMonth, m_year).dayOfYear() - 1;
+  }
+
+}  // namespace model
+}  // namespace openstudio
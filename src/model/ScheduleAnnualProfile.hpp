@@ -0,0 +1,91 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#ifndef MODEL_SCHEDULEANNUALPROFILE_HPP
+#define MODEL_SCHEDULEANNUALPROFILE_HPP
+
+#include "ModelAPI.hpp"
+
+#include "../utilities/core/Logger.hpp"
+#include "../utilities/data/TimeSeries.hpp"
+#include "../utilities/time/Date.hpp"
+#include "../utilities/time/DateTime.hpp"
+#include "../utilities/time/Time.hpp"
+
+#include <vector>
+
+namespace openstudio {
+
+namespace model {
+
+  /** ScheduleAnnualProfile holds the values of a Schedule at every timestep of one year, as returned by
+ *  Schedule::annualProfile. Each value applies to the timestep ending at its time, like EnergyPlus
+ *  reports them, so the first value is the one for 00:00 to the end of the first timestep of January 1.
+ *  Looking up a value is a constant time index into the array, which makes the profile suited to
+ *  measures that query a schedule many times over the year. */
+  class MODEL_API ScheduleAnnualProfile
+  {
+   public:
+    /** @name Constructors and Destructors */
+    //@{
+
+    /** values must hold numberOfTimestepsPerHour * 24 values for every day of year. */
+    ScheduleAnnualProfile(int year, int numberOfTimestepsPerHour, std::vector<double> values);
+
+    //@}
+    /** @name Getters */
+    //@{
+
+    /** The calendar year the profile was computed for, it sets the day of week of each date. */
+    int year() const;
+
+    int numberOfTimestepsPerHour() const;
+
+    /** Returns 365 or 366. */
+    unsigned numberOfDays() const;
+
+    /** The values at the end of each timestep of the year, in order. */
+    const std::vector<double>& values() const;
+
+    /** Returns the value of the timestep containing time on date, the year of date is ignored. A time on a
+   *  timestep boundary belongs to the timestep ending there, except 00:00 which belongs to the first
+   *  timestep of date. February 29 is read as February 28 if year is not a leap year. */
+    double value(const openstudio::Date& date, const openstudio::Time& time) const;
+
+    /** \overload */
+    double value(const openstudio::DateTime& dateTime) const;
+
+    /** Returns the values of the timesteps of date. */
+    std::vector<double> dailyValues(const openstudio::Date& date) const;
+
+    double minimumValue() const;
+
+    double maximumValue() const;
+
+    /** Returns the sum of the values multiplied by the timestep length in hours. For a fractional schedule
+   *  this is the number of hours the schedule would be at full load. */
+    double equivalentFullLoadHours() const;
+
+    /** Returns the values as a TimeSeries starting at the end of the first timestep of January 1. */
+    openstudio::TimeSeries timeSeries() const;
+
+    //@}
+   private:
+    unsigned dayIndex(const openstudio::Date& date) const;
+
+    int m_year;
+    int m_numberOfTimestepsPerHour;
+    std::vector<double> m_values;
+    double m_minimumValue;
+    double m_maximumValue;
+    double m_equivalentFullLoadHours;
+
+    REGISTER_LOGGER("openstudio.model.ScheduleAnnualProfile");
+  };
+
+}  // namespace model
+}  // namespace openstudio
+
+#endif  // MODEL_SCHEDULEANNUALPROFILE_HPP
@@ -16,6 +16,9 @@
 #include <utilities/idd/IddEnums.hxx>
 
 #include "../utilities/core/Assert.hpp"
+#include "../utilities/time/Date.hpp"
+
+#include <cstdio>
 
 using openstudio::Handle;
 using openstudio::OptionalHandle;
@@ -164,6 +167,143 @@ namespace model {
       std::vector<std::string> types;
       return types;
     }
+
+    boost::optional<std::vector<double>> ScheduleCompact_Impl::annualValues(int year, int numberOfTimestepsPerHour,
+                                                                            std::vector<ModelObject>& /*sources*/) const {
+      const int secondsPerTimestep = 3600 / numberOfTimestepsPerHour;
+      const unsigned timestepsPerDay = 24 * numberOfTimestepsPerHour;
+      const unsigned numberOfDays = openstudio::Date::isLeapYear(year) ? 366 : 365;
+      const unsigned firstDayOfWeek = openstudio::Date(MonthOfYear::Jan, 1, year).dayOfWeek().value();
+
+      std::vector<double> result(numberOfDays * timestepsPerDay, 0.0);
+
+      auto warn = [this](const std::string& field) {
+        LOG(Warn, "Cannot compute the annual profile of " << briefDescription() << ", could not read '" << field << "'.");
+      };
+
+      // days of the current Through: field, and the days of week of the current For: field
+      unsigned firstDay = 0;
+      unsigned lastDay = 0;
+      std::vector<bool> assigned;
+      std::vector<bool> daysOfWeek(7, false);
+      std::vector<std::pair<int, double>> untils;  // seconds from the start of day and value
+
+      // apply the Until: fields of the current For: field to its days, the first For: field to cover a day wins
+      auto applyFor = [&]() {
+        for (unsigned i = firstDay; i <= lastDay && !untils.empty(); ++i) {
+          const unsigned dayOfWeek = (firstDayOfWeek + i) % 7;
+          if (!daysOfWeek[dayOfWeek] || assigned[i - firstDay]) {
+            continue;
+          }
+          assigned[i - firstDay] = true;
+          auto until = untils.begin();
+          for (unsigned j = 0; j < timestepsPerDay; ++j) {
+            const int t = (j + 1) * secondsPerTimestep;
+            while ((until != untils.end()) && (until->first < t)) {
+              ++until;
+            }
+            if (until == untils.end()) {
+              break;
+            }
+            result[i * timestepsPerDay + j] = until->second;
+          }
+        }
+        untils.clear();
+        std::fill(daysOfWeek.begin(), daysOfWeek.end(), false);
+      };
+
+      bool started = false;
+      bool expectValue = false;
+      int untilSeconds = 0;
+      for (const IdfExtensibleGroup& eg : extensibleGroups()) {
+        std::string str = eg.getString(0, true).get();
+        boost::trim(str);
+        if (str.empty()) {
+          continue;
+        }
+
+        if (expectValue) {
+          try {
+            untils.emplace_back(untilSeconds, boost::lexical_cast<double>(str));
+          } catch (...) {
+            warn(str);
+            return boost::none;
+          }
+          expectValue = false;
+        } else if (istringEqual(str.substr(0, 8), "Through:")) {
+          applyFor();
+          unsigned month = 0;
+          unsigned day = 0;
+          if (std::sscanf(str.c_str() + 8, "%u/%u", &month, &day) != 2) {
+            warn(str);
+            return boost::none;
+          }
+          if ((month == 2) && (day == 29) && !openstudio::Date::isLeapYear(year)) {
+            day = 28;
+          }
+          unsigned through = 0;
+          try {
+            through = openstudio::Date(MonthOfYear(month), day, year).dayOfYear() - 1;
+          } catch (...) {
+            warn(str);
+            return boost::none;
+          }
+          firstDay = started ? lastDay + 1 : 0;
+          lastDay = through;
+          if (firstDay > lastDay) {
+            warn(str);
+            return boost::none;
+          }
+          assigned.assign(lastDay - firstDay + 1, false);
+          started = true;
+        } else if (istringEqual(str.substr(0, 4), "For:")) {
+          if (!started) {
+            warn(str);
+            return boost::none;
+          }
+          applyFor();
+          std::vector<std::string> tokens;
+          std::string forDays = str.substr(4);
+          boost::split(tokens, forDays, boost::is_any_of(" \t"), boost::token_compress_on);
+          for (const std::string& token : tokens) {
+            if (istringEqual(token, "AllDays") || istringEqual(token, "AllOtherDays")) {
+              std::fill(daysOfWeek.begin(), daysOfWeek.end(), true);
+            } else if (istringEqual(token, "Weekdays")) {
+              for (unsigned d = DayOfWeek::Monday; d <= DayOfWeek::Friday; ++d) {
+                daysOfWeek[d] = true;
+              }
+            } else if (istringEqual(token, "Weekends")) {
+              daysOfWeek[DayOfWeek::Sunday] = true;
+              daysOfWeek[DayOfWeek::Saturday] = true;
+            } else {
+              // day names, holidays, design days and custom days are not in the annual profile
+              for (unsigned d = DayOfWeek::Sunday; d <= DayOfWeek::Saturday; ++d) {
+                const std::string dayName = DayOfWeek(d).valueName();
+                if (istringEqual(token, dayName) || istringEqual(token, dayName + "s")) {
+                  daysOfWeek[d] = true;
+                }
+              }
+            }
+          }
+        } else if (istringEqual(str.substr(0, 6), "Until:")) {
+          unsigned hours = 0;
+          unsigned minutes = 0;
+          if (std::sscanf(str.c_str() + 6, "%u:%u", &hours, &minutes) != 2) {
+            warn(str);
+            return boost::none;
+          }
+          untilSeconds = hours * 3600 + minutes * 60;
+          expectValue = true;
+        } else if (!istringEqual(str.substr(0, 12), "Interpolate:")) {
+          warn(str);
+          return boost::none;
+        }
+      }
+      applyFor();
+
+      return result;
+    }
+
   }  // namespace detail
 
   // create a new ScheduleCompact object in the model's workspace
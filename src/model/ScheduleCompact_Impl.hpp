@@ -75,6 +75,10 @@ namespace model {
       boost::optional<double> constantValue() const;
 
       //@}
+     protected:
+      virtual boost::optional<std::vector<double>> annualValues(int year, int numberOfTimestepsPerHour,
+                                                                std::vector<ModelObject>& sources) const override;
+
      private:
       REGISTER_LOGGER("openstudio.model.ScheduleCompact");
     };
@@ -117,6 +117,13 @@ namespace model {
       std::vector<std::string> types;
       return types;
     }
+
+    boost::optional<std::vector<double>> ScheduleConstant_Impl::annualValues(int year, int numberOfTimestepsPerHour,
+                                                                             std::vector<ModelObject>& /*sources*/) const {
+      const unsigned numberOfDays = openstudio::Date::isLeapYear(year) ? 366 : 365;
+      return std::vector<double>(numberOfDays * 24 * numberOfTimestepsPerHour, this->value());
+    }
+
   }  // namespace detail
 
   // create a new ScheduleConstant object in the model's workspace
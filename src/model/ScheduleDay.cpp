@@ -256,55 +256,67 @@ namespace model {
           }
         }
 
-        std::vector<double> values = this->values();          // these are already sorted
-        std::vector<openstudio::Time> times = this->times();  // these are already sorted
-
-        const unsigned N = times.size();
-        OS_ASSERT(values.size() == N);
+        std::vector<double> values = timestepValues(numberOfTimestepsPerHour);
 
         TimeSeries result;
-        if (N == 0) {
+        if (values.empty()) {
           return result;
         }
 
-        Vector x(N + 2);
-        Vector y(N + 2);
+        result = TimeSeries(tsDateTimes, createVector(values), "");
+        m_cachedTimeSeries = result;
+      }
 
-        x[0] = -0.000001;
-        y[0] = 0.0;
+      return m_cachedTimeSeries.get();
+    }
 
-        for (unsigned i = 0; i < N; ++i) {
-          x[i + 1] = times[i].totalSeconds();
-          y[i + 1] = values[i];
-        }
+    std::vector<double> ScheduleDay_Impl::timestepValues(int numberOfTimestepsPerHour) const {
+      std::vector<double> values = this->values();          // these are already sorted
+      std::vector<openstudio::Time> times = this->times();  // these are already sorted
 
-        x[N + 1] = 86400.000001;
-        y[N + 1] = 0.0;
+      const unsigned N = times.size();
+      OS_ASSERT(values.size() == N);
 
-        std::string interpolatetoTimestep = this->interpolatetoTimestep();
-        Vector tsValues(tsDateTimes.size());
-        for (unsigned j = 0; j < tsDateTimes.size(); ++j) {
-          openstudio::Time t = tsDateTimes[j].time();
-          if (t.totalDays() == 0.0) {  // this is 00:00:00 from the next day
-            t = openstudio::Time(0, 24, 0);
-          }
+      std::vector<double> result;
+      if (N == 0) {
+        return result;
+      }
 
-          if (istringEqual("No", interpolatetoTimestep)) {
-            tsValues[j] = interp(x, y, t.totalSeconds(), HoldNextInterp, NoneExtrap);
-          } else if (istringEqual("Average", interpolatetoTimestep)) {
-            double minutes = 60.0 / numberOfTimestepsPerHour;
-            double ti = minutes * 60.0;  // total seconds of the timestep interval
-            tsValues[j] = interp(x, y, t.totalSeconds(), AverageInterp, NoneExtrap, ti);
-          } else if (istringEqual("Linear", interpolatetoTimestep)) {
-            tsValues[j] = interp(x, y, t.totalSeconds(), LinearInterp, NoneExtrap);
-          }
-        }
+      Vector x(N + 2);
+      Vector y(N + 2);
 
-        result = TimeSeries(tsDateTimes, tsValues, "");
-        m_cachedTimeSeries = result;
+      x[0] = -0.000001;
+      y[0] = 0.0;
+
+      for (unsigned i = 0; i < N; ++i) {
+        x[i + 1] = times[i].totalSeconds();
+        y[i + 1] = values[i];
       }
 
-      return m_cachedTimeSeries.get();
+      x[N + 1] = 86400.000001;
+      y[N + 1] = 0.0;
+
+      const int secondsPerTimestep = 3600 / numberOfTimestepsPerHour;
+      const unsigned timestepsPerDay = 24 * numberOfTimestepsPerHour;
+
+      std::string interpolatetoTimestep = this->interpolatetoTimestep();
+      result.resize(timestepsPerDay, 0.0);
+      for (unsigned j = 0; j < timestepsPerDay; ++j) {
+        // timesteps are period ending, the last one ends at 24:00:00
+        double t = (j + 1) * secondsPerTimestep;
+
+        if (istringEqual("No", interpolatetoTimestep)) {
+          result[j] = interp(x, y, t, HoldNextInterp, NoneExtrap);
+        } else if (istringEqual("Average", interpolatetoTimestep)) {
+          double minutes = 60.0 / numberOfTimestepsPerHour;
+          double ti = minutes * 60.0;  // total seconds of the timestep interval
+          result[j] = interp(x, y, t, AverageInterp, NoneExtrap, ti);
+        } else if (istringEqual("Linear", interpolatetoTimestep)) {
+          result[j] = interp(x, y, t, LinearInterp, NoneExtrap);
+        }
+      }
+
+      return result;
     }
 
     bool ScheduleDay_Impl::setScheduleTypeLimits(const ScheduleTypeLimits& scheduleTypeLimits) {
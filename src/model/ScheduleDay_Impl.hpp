@@ -81,6 +81,10 @@ namespace model {
       /// Returns the timeseries corresponding to simulation timestep and chosen interpolation method.
       openstudio::TimeSeries timeSeries() const;
 
+      /// Returns the values at the end of each timestep of the day, with the chosen interpolation method.
+      /// Returns an empty vector if there are no values.
+      std::vector<double> timestepValues(int numberOfTimestepsPerHour) const;
+
       //@}
       /** @name Setters */
       //@{
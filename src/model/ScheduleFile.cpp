@@ -21,9 +21,12 @@
 #include "../utilities/data/TimeSeries.hpp"
 #include "../utilities/core/Assert.hpp"
 #include "../utilities/filetypes/CSVFile.hpp"
+#include "../utilities/data/Variant.hpp"
+#include "../utilities/time/Date.hpp"
 
 #include "../utilities/core/DeprecatedHelpers.hpp"
 
+#include <algorithm>
 #include <unordered_map>
 
 namespace openstudio {
@@ -416,6 +419,70 @@ namespace model {
       return filePath;
     }
 
+
+    boost::optional<std::vector<double>> ScheduleFile_Impl::annualValues(int year, int numberOfTimestepsPerHour,
+                                                                         std::vector<ModelObject>& sources) const {
+      ExternalFile externalFile = this->externalFile();
+      sources.push_back(externalFile);
+
+      if (columnSeparatorChar() != ',') {
+        LOG(Warn, "Cannot compute the annual profile of " << briefDescription() << ", only comma separated files are supported.");
+        return boost::none;
+      }
+
+      boost::optional<CSVFile> csvFile = CSVFile::load(externalFile.filePath());
+      if (!csvFile) {
+        LOG(Warn, "Cannot compute the annual profile of " << briefDescription() << ", could not load " << externalFile.filePath() << ".");
+        return boost::none;
+      }
+
+      const unsigned columnIndex = columnNumber() - 1;
+      std::vector<std::vector<Variant>> rows = csvFile->rows();
+      std::vector<double> fileValues;
+      for (unsigned i = rowstoSkipatTop(); i < rows.size(); ++i) {
+        if (columnIndex >= rows[i].size()) {
+          break;
+        }
+        const Variant& variant = rows[i][columnIndex];
+        if (variant.variantType() == VariantType::Double) {
+          fileValues.push_back(variant.valueAsDouble());
+        } else if (variant.variantType() == VariantType::Integer) {
+          fileValues.push_back(variant.valueAsInteger());
+        } else {
+          LOG(Warn, "Cannot compute the annual profile of " << briefDescription() << ", value at row " << i + 1 << " is not a numeric value.");
+          return boost::none;
+        }
+      }
+
+      if (fileValues.empty()) {
+        LOG(Warn, "Cannot compute the annual profile of " << briefDescription() << ", it has no values.");
+        return boost::none;
+      }
+
+      // like EnergyPlus, the values span the number of hours of data when minutes per item is not given
+      int minutesPerItem = this->minutesperItem();
+      if (isMinutesperItemDefaulted()) {
+        minutesPerItem = std::max(1, static_cast<int>(numberofHoursofData() * 60 / fileValues.size()));
+      }
+      const int secondsPerItem = minutesPerItem * 60;
+
+      const int secondsPerTimestep = 3600 / numberOfTimestepsPerHour;
+      const unsigned numberOfDays = openstudio::Date::isLeapYear(year) ? 366 : 365;
+      const unsigned numberOfTimesteps = numberOfDays * 24 * numberOfTimestepsPerHour;
+
+      // each value holds until the end of its item, values past the end of the file are zero
+      std::vector<double> result(numberOfTimesteps, 0.0);
+      for (unsigned j = 0; j < numberOfTimesteps; ++j) {
+        const unsigned itemIndex = ((j + 1) * secondsPerTimestep + secondsPerItem - 1) / secondsPerItem - 1;
+        if (itemIndex >= fileValues.size()) {
+          break;
+        }
+        result[j] = fileValues[itemIndex];
+      }
+
+      return result;
+    }
+
   }  // namespace detail
 
   ScheduleFile::ScheduleFile(const ExternalFile& externalfile, int column, int rowsToSkip)
@@ -137,6 +137,9 @@ namespace model {
 
       //@}
      protected:
+      virtual boost::optional<std::vector<double>> annualValues(int year, int numberOfTimestepsPerHour,
+                                                                std::vector<ModelObject>& sources) const override;
+
      private:
       REGISTER_LOGGER("openstudio.model.ScheduleFile");
     };
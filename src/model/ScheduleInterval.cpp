@@ -19,6 +19,8 @@
 #include <utilities/idd/OS_Schedule_Compact_FieldEnums.hxx>
 
 #include "../utilities/data/TimeSeries.hpp"
+#include "../utilities/time/Date.hpp"
+#include "../utilities/time/DateTime.hpp"
 #include "../utilities/core/Assert.hpp"
 
 using openstudio::Handle;
@@ -65,6 +67,32 @@ namespace model {
       return toStandardVector(timeSeries().values());
     }
 
+
+    boost::optional<std::vector<double>> ScheduleInterval_Impl::annualValues(int year, int numberOfTimestepsPerHour,
+                                                                             std::vector<ModelObject>& /*sources*/) const {
+      openstudio::TimeSeries timeSeries = this->timeSeries();
+      if (timeSeries.values().size() == 0) {
+        LOG(Warn, "Cannot compute the annual profile of " << briefDescription() << ", it has no values.");
+        return boost::none;
+      }
+
+      // the time series may start on any day, read it with the same offset from the start of year
+      const openstudio::DateTime firstReportDateTime = timeSeries.firstReportDateTime();
+      const openstudio::DateTime startOfYear(openstudio::Date(MonthOfYear::Jan, 1, firstReportDateTime.date().year()), openstudio::Time(0));
+      const int offset = (firstReportDateTime - startOfYear).totalSeconds();
+
+      const int secondsPerTimestep = 3600 / numberOfTimestepsPerHour;
+      const unsigned numberOfDays = openstudio::Date::isLeapYear(year) ? 366 : 365;
+      const unsigned numberOfTimesteps = numberOfDays * 24 * numberOfTimestepsPerHour;
+
+      std::vector<double> result(numberOfTimesteps);
+      for (unsigned j = 0; j < numberOfTimesteps; ++j) {
+        result[j] = timeSeries.value(openstudio::Time(0, 0, 0, static_cast<int>(j + 1) * secondsPerTimestep - offset));
+      }
+
+      return result;
+    }
+
   }  // namespace detail
 
   boost::optional<ScheduleInterval> ScheduleInterval::fromTimeSeries(const openstudio::TimeSeries& timeSeries, Model& model) {
@@ -61,6 +61,10 @@ namespace model {
       virtual bool setTimeSeries(const openstudio::TimeSeries& timeSeries) = 0;
 
       //@}
+     protected:
+      virtual boost::optional<std::vector<double>> annualValues(int year, int numberOfTimestepsPerHour,
+                                                                std::vector<ModelObject>& sources) const override;
+
      private:
       REGISTER_LOGGER("openstudio.model.ScheduleInterval");
     };
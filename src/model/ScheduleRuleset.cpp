@@ -533,6 +533,9 @@ namespace model {
     }
 
     bool ScheduleRuleset_Impl::setScheduleRuleIndex(ScheduleRule& scheduleRule, unsigned index) {
+      // rules do not change this ruleset, but a new or reordered rule changes its values
+      clearCachedAnnualProfile();
+
       std::vector<ScheduleRule> scheduleRules = this->scheduleRules();
       unsigned N = scheduleRules.size();
 
@@ -671,6 +674,22 @@ namespace model {
       return getObject<ScheduleRuleset>().getModelObjectTarget<ScheduleDay>(OS_Schedule_RulesetFields::DefaultDayScheduleName);
     }
 
+
+    boost::optional<std::vector<double>> ScheduleRuleset_Impl::annualValues(int year, int numberOfTimestepsPerHour,
+                                                                            std::vector<ModelObject>& sources) const {
+      std::vector<ScheduleDay> daySchedules =
+        this->getDaySchedules(openstudio::Date(MonthOfYear::Jan, 1, year), openstudio::Date(MonthOfYear::Dec, 31, year));
+
+      sources.push_back(this->defaultDaySchedule());
+      for (const ScheduleRule& scheduleRule : this->scheduleRules()) {
+        sources.push_back(scheduleRule);
+        sources.push_back(scheduleRule.daySchedule());
+      }
+
+      return annualValuesFromDaySchedules(std::vector<boost::optional<ScheduleDay>>(daySchedules.begin(), daySchedules.end()),
+                                          numberOfTimestepsPerHour);
+    }
+
   }  // namespace detail
 
   ScheduleRuleset::ScheduleRuleset(const Model& model) : Schedule(ScheduleRuleset::iddObjectType(), model) {
@@ -156,6 +156,10 @@ namespace model {
       virtual void ensureNoLeapDays() override;
 
       //@}
+     protected:
+      virtual boost::optional<std::vector<double>> annualValues(int year, int numberOfTimestepsPerHour,
+                                                                std::vector<ModelObject>& sources) const override;
+
      private:
       REGISTER_LOGGER("openstudio.model.ScheduleRuleset");
 
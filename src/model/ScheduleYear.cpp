@@ -7,6 +7,8 @@
 #include "ScheduleYear_Impl.hpp"
 #include "ScheduleWeek.hpp"
 #include "ScheduleWeek_Impl.hpp"
+#include "ScheduleDay.hpp"
+#include "ScheduleDay_Impl.hpp"
 #include "ScheduleTypeLimits.hpp"
 #include "ScheduleTypeLimits_Impl.hpp"
 #include "YearDescription.hpp"
@@ -243,6 +245,76 @@ namespace model {
       std::vector<std::string> types;
       return types;
     }
+
+    boost::optional<std::vector<double>> ScheduleYear_Impl::annualValues(int year, int numberOfTimestepsPerHour,
+                                                                         std::vector<ModelObject>& sources) const {
+      // day of year index of each until date, read in the requested year
+      std::vector<std::pair<unsigned, ScheduleWeek>> untilDays;
+      for (const ModelExtensibleGroup& group : castVector<ModelExtensibleGroup>(this->extensibleGroups())) {
+        OptionalUnsigned month = group.getUnsigned(0, true);
+        OptionalUnsigned day = group.getUnsigned(1, true);
+        boost::optional<ScheduleWeek> scheduleWeek = group.getModelObjectTarget<ScheduleWeek>(2);
+        if (!month || !day || !scheduleWeek) {
+          LOG(Warn, "Cannot compute the annual profile of " << briefDescription() << ", could not read week " << group.groupIndex() << ".");
+          return boost::none;
+        }
+        if ((*month == 2) && (*day == 29) && !openstudio::Date::isLeapYear(year)) {
+          day = 28;
+        }
+        untilDays.emplace_back(openstudio::Date(MonthOfYear(*month), *day, year).dayOfYear() - 1, *scheduleWeek);
+      }
+
+      const unsigned numberOfDays = openstudio::Date::isLeapYear(year) ? 366 : 365;
+      const unsigned firstDayOfWeek = openstudio::Date(MonthOfYear::Jan, 1, year).dayOfWeek().value();
+
+      std::vector<boost::optional<ScheduleDay>> daySchedules(numberOfDays);
+      for (unsigned i = 0; i < numberOfDays; ++i) {
+        // want first until date which is greater than or equal to the day, these are already sorted
+        auto it = std::find_if(untilDays.begin(), untilDays.end(), [i](const auto& untilDay) { return untilDay.first >= i; });
+        if (it == untilDays.end()) {
+          break;
+        }
+
+        const ScheduleWeek& scheduleWeek = it->second;
+        switch ((firstDayOfWeek + i) % 7) {
+          case DayOfWeek::Sunday:
+            daySchedules[i] = scheduleWeek.sundaySchedule();
+            break;
+          case DayOfWeek::Monday:
+            daySchedules[i] = scheduleWeek.mondaySchedule();
+            break;
+          case DayOfWeek::Tuesday:
+            daySchedules[i] = scheduleWeek.tuesdaySchedule();
+            break;
+          case DayOfWeek::Wednesday:
+            daySchedules[i] = scheduleWeek.wednesdaySchedule();
+            break;
+          case DayOfWeek::Thursday:
+            daySchedules[i] = scheduleWeek.thursdaySchedule();
+            break;
+          case DayOfWeek::Friday:
+            daySchedules[i] = scheduleWeek.fridaySchedule();
+            break;
+          case DayOfWeek::Saturday:
+            daySchedules[i] = scheduleWeek.saturdaySchedule();
+            break;
+          default:
+            OS_ASSERT(false);
+        }
+      }
+
+      for (const auto& untilDay : untilDays) {
+        sources.push_back(untilDay.second);
+      }
+      for (const boost::optional<ScheduleDay>& daySchedule : daySchedules) {
+        if (daySchedule) {
+          sources.push_back(*daySchedule);
+        }
+      }
+
+      return annualValuesFromDaySchedules(daySchedules, numberOfTimestepsPerHour);
+    }
+
   }  // namespace detail
 
   ScheduleYear::ScheduleYear(const Model& model) : Schedule(ScheduleYear::iddObjectType(), model) {
@@ -7,11 +7,15 @@
 #define MODEL_SCHEDULE_IMPL_HPP
 
 #include "ScheduleBase_Impl.hpp"
+#include "ScheduleAnnualProfile.hpp"
+
+#include <memory>
 
 namespace openstudio {
 namespace model {
 
   class ScheduleTypeLimits;
+  class ScheduleDay;
 
   namespace detail {
 
@@ -34,14 +38,40 @@ namespace model {
       // virtual destructor
       virtual ~Schedule_Impl() = default;
 
+      //@}
+      /** @name Getters */
+      //@{
+
+      boost::optional<ScheduleAnnualProfile> annualProfile() const;
+
+      boost::optional<ScheduleAnnualProfile> annualProfile(int numberOfTimestepsPerHour) const;
+
       //@}
      protected:
       virtual bool candidateIsCompatibleWithCurrentUse(const ScheduleTypeLimits& candidate) const override;
 
       virtual bool okToResetScheduleTypeLimits() const override;
 
+      /** Returns the values of this schedule at the end of each timestep of year, or boost::none if this type of
+       *  schedule cannot be evaluated. Every other object the values are read from is added to sources, so that
+       *  the cached ScheduleAnnualProfile is cleared when one of them changes. */
+      virtual boost::optional<std::vector<double>> annualValues(int year, int numberOfTimestepsPerHour,
+                                                                std::vector<ModelObject>& sources) const;
+
+      /** Returns the timestep values of daySchedules, which holds one ScheduleDay per day of the year. Days
+       *  without a ScheduleDay are zero. */
+      static std::vector<double> annualValuesFromDaySchedules(const std::vector<boost::optional<ScheduleDay>>& daySchedules,
+                                                             int numberOfTimestepsPerHour);
+
+      void clearCachedAnnualProfile();
+
      private:
       REGISTER_LOGGER("openstudio.model.Schedule");
+
+      void onAnnualProfileSourceRemoved(const Handle& handle);
+
+      mutable boost::optional<ScheduleAnnualProfile> m_cachedAnnualProfile;
+      mutable std::vector<std::weak_ptr<ModelObject_Impl>> m_annualProfileSources;
     };
 
   }  // namespace detail
@@ -110,6 +110,7 @@
 #include "../utilities/core/ContainersMove.hpp"
 
 #include "../utilities/core/Assert.hpp"
+#include "../utilities/core/ParallelFor.hpp"
 
 #undef BOOST_UBLAS_TYPE_CHECK
 #if defined(_MSC_VER)
@@ -126,9 +127,14 @@
 #  pragma warning(pop)
 #endif
 
+#include <boost/lexical_cast.hpp>
+
 #include <algorithm>
+#include <array>
 #include <cmath>
+#include <exception>
 #include <iterator>
+#include <set>
 
 #include <fmt/core.h>
 
@@ -806,26 +812,47 @@ namespace model {
       return result;
     }
 
-    double Space_Impl::exteriorArea() const {
-      double result = 0;
-      for (const Surface& surface : this->surfaces()) {
-        if (istringEqual(surface.outsideBoundaryCondition(), "Outdoors")) {
-          result += surface.grossArea();
+    template <typename Compute>
+    double Space_Impl::cachedAggregate(boost::optional<double>& cachedValue, Compute compute) const {
+      const unsigned changeVersion = model().getImpl<Model_Impl>()->changeVersion();
+      if (changeVersion != m_cachedAggregatesVersion) {
+        for (boost::optional<double>* cache :
+             {&m_cachedFloorArea, &m_cachedVolume, &m_cachedExteriorArea, &m_cachedExteriorWallArea, &m_cachedNumberOfPeople,
+              &m_cachedLightingPower, &m_cachedElectricEquipmentPower, &m_cachedGasEquipmentPower, &m_cachedInfiltrationDesignFlowRate}) {
+          cache->reset();
         }
+        m_cachedAggregatesVersion = changeVersion;
       }
-      return result;
+      if (!cachedValue) {
+        cachedValue = compute();
+      }
+      return *cachedValue;
     }
 
-    double Space_Impl::exteriorWallArea() const {
-      double result = 0;
-      for (const Surface& surface : this->surfaces()) {
-        if (istringEqual(surface.outsideBoundaryCondition(), "Outdoors")) {
-          if (istringEqual(surface.surfaceType(), "Wall")) {
+    double Space_Impl::exteriorArea() const {
+      return cachedAggregate(m_cachedExteriorArea, [this]() {
+        double result = 0;
+        for (const Surface& surface : this->surfaces()) {
+          if (istringEqual(surface.outsideBoundaryCondition(), "Outdoors")) {
             result += surface.grossArea();
           }
         }
-      }
-      return result;
+        return result;
+      });
+    }
+
+    double Space_Impl::exteriorWallArea() const {
+      return cachedAggregate(m_cachedExteriorWallArea, [this]() {
+        double result = 0;
+        for (const Surface& surface : this->surfaces()) {
+          if (istringEqual(surface.outsideBoundaryCondition(), "Outdoors")) {
+            if (istringEqual(surface.surfaceType(), "Wall")) {
+              result += surface.grossArea();
+            }
+          }
+        }
+        return result;
+      });
     }
 
     Polyhedron Space_Impl::polyhedron() const {
@@ -1022,33 +1049,38 @@ namespace model {
     }
 
     double Space_Impl::volume() const {
-      boost::optional<double> value = getDouble(OS_SpaceFields::Volume, true);
-      if (value) {
-        return value.get();
-      }
+      return cachedAggregate(m_cachedVolume, [this]() {
+        boost::optional<double> value = getDouble(OS_SpaceFields::Volume, true);
+        if (value) {
+          return value.get();
+        }
 
-      auto volumePoly = this->polyhedron();
+        auto volumePoly = this->polyhedron();
 
-      if (volumePoly.isEnclosedVolume()) {
-        if (volumePoly.isCompletelyInsideOut()) {
-          const double volume = volumePoly.polyhedronVolume();
-          LOG(Error, briefDescription() << " has all of its Surfaces that are inside-out. Call Space::fixSurfacesWithIncorrectOrientation().");
-          return -volume;
-        } else if (!volumePoly.hasAnySurfaceWithIncorrectOrientation()) {
-          return volumePoly.polyhedronVolume();
+        if (volumePoly.isEnclosedVolume()) {
+          if (volumePoly.isCompletelyInsideOut()) {
+            const double volume = volumePoly.polyhedronVolume();
+            LOG(Error,
+                briefDescription() << " has all of its Surfaces that are inside-out. Call Space::fixSurfacesWithIncorrectOrientation().");
+            return -volume;
+          } else if (!volumePoly.hasAnySurfaceWithIncorrectOrientation()) {
+            return volumePoly.polyhedronVolume();
+          } else {
+            LOG(Warn, briefDescription() << " has some Surfaces with incorrection orientation. "
+                                            "Call Space::fixSurfacesWithIncorrectOrientation(). "
+                                            "Falling back to ceilingHeight * floorArea. "
+                                            "Volume calculation will be potentially inaccurate.");
+          }
         } else {
-          LOG(Warn, briefDescription() << " has some Surfaces with incorrection orientation. Call Space::fixSurfacesWithIncorrectOrientation(). "
+          LOG(Warn, briefDescription() << " is not enclosed, there are " << volumePoly.edgesNotTwo().size()
+                                       << " edges that aren't used exactly twice. "
                                           "Falling back to ceilingHeight * floorArea. Volume calculation will be potentially inaccurate.");
         }
-      } else {
-        LOG(Warn, briefDescription() << " is not enclosed, there are " << volumePoly.edgesNotTwo().size()
-                                     << " edges that aren't used exactly twice. "
-                                        "Falling back to ceilingHeight * floorArea. Volume calculation will be potentially inaccurate.");
-      }
 
-      const double result = this->ceilingHeight() * this->floorArea();
+        const double result = this->ceilingHeight() * this->floorArea();
 
-      return result;
+        return result;
+      });
     }
 
     bool Space_Impl::isVolumeDefaulted() const {
@@ -1065,21 +1097,23 @@ namespace model {
     }
 
     double Space_Impl::floorArea() const {
-      boost::optional<double> value = getDouble(OS_SpaceFields::FloorArea, true);
-      if (value) {
-        return value.get();
-      }
+      return cachedAggregate(m_cachedFloorArea, [this]() {
+        boost::optional<double> value = getDouble(OS_SpaceFields::FloorArea, true);
+        if (value) {
+          return value.get();
+        }
 
-      double result = 0;
-      for (const Surface& surface : this->surfaces()) {
-        if (istringEqual(surface.surfaceType(), "Floor")) {
-          if (surface.isAirWall()) {
-            continue;
+        double result = 0;
+        for (const Surface& surface : this->surfaces()) {
+          if (istringEqual(surface.surfaceType(), "Floor")) {
+            if (surface.isAirWall()) {
+              continue;
+            }
+            result += surface.grossArea();
           }
-          result += surface.grossArea();
         }
-      }
-      return result;
+        return result;
+      });
     }
 
     bool Space_Impl::isFloorAreaDefaulted() const {
@@ -1096,20 +1130,22 @@ namespace model {
     }
 
     double Space_Impl::numberOfPeople() const {
-      double result = 0.0;
-      const double area = floorArea();
+      return cachedAggregate(m_cachedNumberOfPeople, [this]() {
+        double result = 0.0;
+        const double area = floorArea();
 
-      for (const People& person : this->people()) {
-        result += person.getNumberOfPeople(area);
-      }
-
-      if (OptionalSpaceType st = spaceType()) {
-        for (const People& person : st->people()) {
+        for (const People& person : this->people()) {
           result += person.getNumberOfPeople(area);
         }
-      }
 
-      return result;
+        if (OptionalSpaceType st = spaceType()) {
+          for (const People& person : st->people()) {
+            result += person.getNumberOfPeople(area);
+          }
+        }
+
+        return result;
+      });
     }
 
     bool Space_Impl::setNumberOfPeople(double numberOfPeople) {
@@ -1314,27 +1350,29 @@ namespace model {
     }
 
     double Space_Impl::lightingPower() const {
-      double result(0.0);
-      double area = floorArea();
-      double numPeople = numberOfPeople();
-
-      for (const Lights& light : lights()) {
-        result += light.getLightingPower(area, numPeople);
-      }
-      for (const Luminaire& luminaire : luminaires()) {
-        result += luminaire.lightingPower();
-      }
+      return cachedAggregate(m_cachedLightingPower, [this]() {
+        double result(0.0);
+        double area = floorArea();
+        double numPeople = numberOfPeople();
 
-      if (OptionalSpaceType spaceType = this->spaceType()) {
-        for (const Lights& light : spaceType->lights()) {
+        for (const Lights& light : lights()) {
           result += light.getLightingPower(area, numPeople);
         }
-        for (const Luminaire& luminaire : spaceType->luminaires()) {
+        for (const Luminaire& luminaire : luminaires()) {
           result += luminaire.lightingPower();
         }
-      }
 
-      return result;
+        if (OptionalSpaceType spaceType = this->spaceType()) {
+          for (const Lights& light : spaceType->lights()) {
+            result += light.getLightingPower(area, numPeople);
+          }
+          for (const Luminaire& luminaire : spaceType->luminaires()) {
+            result += luminaire.lightingPower();
+          }
+        }
+
+        return result;
+      });
     }
 
     bool Space_Impl::setLightingPower(double lightingPower) {
@@ -1593,21 +1631,23 @@ namespace model {
     }
 
     double Space_Impl::electricEquipmentPower() const {
-      double result(0.0);
-      double area = floorArea();
-      double numPeople = numberOfPeople();
-
-      for (const ElectricEquipment& equipment : electricEquipment()) {
-        result += equipment.getDesignLevel(area, numPeople);
-      }
+      return cachedAggregate(m_cachedElectricEquipmentPower, [this]() {
+        double result(0.0);
+        double area = floorArea();
+        double numPeople = numberOfPeople();
 
-      if (OptionalSpaceType spaceType = this->spaceType()) {
-        for (const ElectricEquipment& equipment : spaceType->electricEquipment()) {
+        for (const ElectricEquipment& equipment : electricEquipment()) {
           result += equipment.getDesignLevel(area, numPeople);
         }
-      }
 
-      return result;
+        if (OptionalSpaceType spaceType = this->spaceType()) {
+          for (const ElectricEquipment& equipment : spaceType->electricEquipment()) {
+            result += equipment.getDesignLevel(area, numPeople);
+          }
+        }
+
+        return result;
+      });
     }
 
     double Space_Impl::electricEquipmentITEAirCooledPower() const {
@@ -1863,21 +1903,23 @@ namespace model {
     }
 
     double Space_Impl::gasEquipmentPower() const {
-      double result(0.0);
-      double area = floorArea();
-      double numPeople = numberOfPeople();
-
-      for (const GasEquipment& equipment : gasEquipment()) {
-        result += equipment.getDesignLevel(area, numPeople);
-      }
+      return cachedAggregate(m_cachedGasEquipmentPower, [this]() {
+        double result(0.0);
+        double area = floorArea();
+        double numPeople = numberOfPeople();
 
-      if (OptionalSpaceType spaceType = this->spaceType()) {
-        for (const GasEquipment& equipment : spaceType->gasEquipment()) {
+        for (const GasEquipment& equipment : gasEquipment()) {
           result += equipment.getDesignLevel(area, numPeople);
         }
-      }
 
-      return result;
+        if (OptionalSpaceType spaceType = this->spaceType()) {
+          for (const GasEquipment& equipment : spaceType->gasEquipment()) {
+            result += equipment.getDesignLevel(area, numPeople);
+          }
+        }
+
+        return result;
+      });
     }
 
     bool Space_Impl::setGasEquipmentPower(double gasEquipmentPower) {
@@ -2098,23 +2140,25 @@ namespace model {
     }
 
     double Space_Impl::infiltrationDesignFlowRate() const {
-      double result(0.0);
-      double floorArea = this->floorArea();
-      double exteriorSurfaceArea = this->exteriorArea();
-      double exteriorWallArea = this->exteriorWallArea();
-      double airVolume = volume();
-
-      for (const SpaceInfiltrationDesignFlowRate& idfr : spaceInfiltrationDesignFlowRates()) {
-        result += idfr.getDesignFlowRate(floorArea, exteriorSurfaceArea, exteriorWallArea, airVolume);
-      }
-
-      if (OptionalSpaceType st = spaceType()) {
-        for (const SpaceInfiltrationDesignFlowRate& idfr : st->spaceInfiltrationDesignFlowRates()) {
+      return cachedAggregate(m_cachedInfiltrationDesignFlowRate, [this]() {
+        double result(0.0);
+        double floorArea = this->floorArea();
+        double exteriorSurfaceArea = this->exteriorArea();
+        double exteriorWallArea = this->exteriorWallArea();
+        double airVolume = volume();
+
+        for (const SpaceInfiltrationDesignFlowRate& idfr : spaceInfiltrationDesignFlowRates()) {
           result += idfr.getDesignFlowRate(floorArea, exteriorSurfaceArea, exteriorWallArea, airVolume);
         }
-      }
 
-      return result;
+        if (OptionalSpaceType st = spaceType()) {
+          for (const SpaceInfiltrationDesignFlowRate& idfr : st->spaceInfiltrationDesignFlowRates()) {
+            result += idfr.getDesignFlowRate(floorArea, exteriorSurfaceArea, exteriorWallArea, airVolume);
+          }
+        }
+
+        return result;
+      });
     }
 
     double Space_Impl::infiltrationDesignFlowPerSpaceFloorArea() const {
@@ -2340,6 +2384,24 @@ namespace model {
       // transform from other to this coordinates
       Transformation transformation = this->transformation().inverse() * other.transformation();
 
+      // other surfaces in this coordinates, computed once rather than for every surface
+      struct OtherSurface
+      {
+        Surface surface;
+        std::vector<Point3d> vertices;
+        Vector3d outwardNormal;
+        BoundingBox bounds;
+      };
+      std::vector<OtherSurface> otherSurfaces;
+      for (Surface& otherSurface : other.surfaces()) {
+        std::vector<Point3d> otherVertices = transformation * otherSurface.vertices();
+        if (boost::optional<Vector3d> otherOutwardNormal = getOutwardNormal(otherVertices)) {
+          BoundingBox otherBounds;
+          otherBounds.addPoints(otherVertices);
+          otherSurfaces.push_back(OtherSurface{otherSurface, std::move(otherVertices), *otherOutwardNormal, otherBounds});
+        }
+      }
+
       for (Surface& surface : this->surfaces()) {
         if (surface.adjacentSurface()) {
           continue;
@@ -2349,23 +2411,27 @@ namespace model {
         if (!outwardNormal) {
           continue;
         }
+        BoundingBox bounds;
+        bounds.addPoints(vertices);
 
-        for (Surface& otherSurface : other.surfaces()) {
-          if (otherSurface.adjacentSurface()) {
-            continue;
-          }
-          std::vector<Point3d> otherVertices = transformation * otherSurface.vertices();
-          boost::optional<Vector3d> otherOutwardNormal = getOutwardNormal(otherVertices);
-          if (!otherOutwardNormal) {
+        for (OtherSurface& candidate : otherSurfaces) {
+          // surfaces with matching vertices have matching bounds
+          if (!bounds.intersects(candidate.bounds, tol)) {
             continue;
           }
 
-          double dot = outwardNormal->dot(*otherOutwardNormal);
+          double dot = outwardNormal->dot(candidate.outwardNormal);
 
           if (dot > -0.98) {
             continue;
           }
 
+          Surface& otherSurface = candidate.surface;
+          if (otherSurface.adjacentSurface()) {
+            continue;
+          }
+
+          std::vector<Point3d> otherVertices = candidate.vertices;
           std::reverse(otherVertices.begin(), otherVertices.end());
 
           if (circularEqual(vertices, otherVertices, tol)) {
@@ -2416,6 +2482,23 @@ namespace model {
       std::map<std::string, bool> hasAdjacentSurfaceMap;
       std::set<std::string> completedIntersections;
 
+      // Bounds of each surface in building coordinates, dropped when the surface is intersected. Surface::computeIntersection
+      // only merges vertices within 1 cm of each other, surfaces whose bounds are further apart than a few cm can not intersect.
+      constexpr double boundsTol = 0.05;
+      Transformation transformation = this->transformation();
+      Transformation otherTransformation = other.transformation();
+      std::map<std::string, BoundingBox> boundsMap;
+      auto surfaceBounds = [&boundsMap](const Surface& surface, const std::string& surfaceHandle,
+                                        const Transformation& spaceTransformation) -> const BoundingBox& {
+        auto it = boundsMap.find(surfaceHandle);
+        if (it == boundsMap.end()) {
+          BoundingBox bounds;
+          bounds.addPoints(spaceTransformation * surface.vertices());
+          it = boundsMap.emplace(surfaceHandle, bounds).first;
+        }
+        return it->second;
+      };
+
       bool anyNewSurfaces = true;
       while (anyNewSurfaces) {
 
@@ -2456,9 +2539,17 @@ namespace model {
             }
             completedIntersections.insert(intersectionKey);
 
+            if (!surfaceBounds(surface, surfaceHandle, transformation)
+                   .intersects(surfaceBounds(otherSurface, otherSurfaceHandle, otherTransformation), boundsTol)) {
+              continue;
+            }
+
             // number of surfaces in each space will only increase in intersect
             boost::optional<SurfaceIntersection> intersection = surface.computeIntersection(otherSurface);
             if (intersection) {
+              boundsMap.erase(surfaceHandle);
+              boundsMap.erase(otherSurfaceHandle);
+
               std::vector<Surface> newSurfaces1 = intersection->newSurfaces1();
               std::vector<Surface> newSurfaces2 = intersection->newSurfaces2();
 
@@ -3669,6 +3760,217 @@ namespace model {
   Space::Space(std::shared_ptr<detail::Space_Impl> impl) : PlanarSurfaceGroup(std::move(impl)) {}
   /// @endcond
 
+  namespace {
+
+    /** Returns all pairs (i, j), i < j, of intersecting bounds, in the order of a nested loop over i and j. Sweeps the
+     *  bounds along x, so that only bounds overlapping in x are tested against each other. */
+    std::vector<std::pair<unsigned, unsigned>> intersectingPairs(const std::vector<BoundingBox>& bounds) {
+      constexpr double tol = 0.01;  // default tolerance of BoundingBox::intersects
+
+      std::vector<unsigned> order;
+      order.reserve(bounds.size());
+      for (unsigned i = 0; i < bounds.size(); ++i) {
+        if (!bounds[i].isEmpty()) {
+          order.push_back(i);
+        }
+      }
+      std::sort(order.begin(), order.end(), [&bounds](unsigned a, unsigned b) { return bounds[a].minX().get() < bounds[b].minX().get(); });
+
+      std::vector<std::pair<unsigned, unsigned>> result;
+      std::vector<unsigned> active;
+      for (unsigned i : order) {
+        // bounds that end before these start can not intersect these or any later ones
+        const double minX = bounds[i].minX().get();
+        std::erase_if(active, [&bounds, minX](unsigned j) { return minX > bounds[j].maxX().get() + tol; });
+        for (unsigned j : active) {
+          if (bounds[i].intersects(bounds[j], tol)) {
+            result.emplace_back(std::min(i, j), std::max(i, j));
+          }
+        }
+        active.push_back(i);
+      }
+
+      std::sort(result.begin(), result.end());
+      return result;
+    }
+
+    /** Replays Space_Impl::intersectSurfaces for a pair of spaces on a detached copy of their surfaces, without touching the
+     *  model, then applies the recorded intersections to the model in the order Space_Impl::intersectSurfaces would have. The
+     *  copy is taken and the intersections are applied on the calling thread, compute can run on any thread. */
+    class SpacePairIntersection
+    {
+     public:
+      SpacePairIntersection(const Space& space, const Space& otherSpace)
+        : m_spaces{space, otherSpace}, m_transformations{space.transformation(), otherSpace.transformation()} {
+        for (unsigned side = 0; side < 2; ++side) {
+          std::vector<Surface> surfaces = m_spaces[side].surfaces();
+          std::sort(surfaces.begin(), surfaces.end(), [](const Surface& a, const Surface& b) -> bool { return a.grossArea() > b.grossArea(); });
+          for (const Surface& surface : surfaces) {
+            bool eligible = surface.subSurfaces().empty() && !surface.adjacentSurface();
+            m_states[side].push_back(SurfaceState{surface.vertices(), surface.nameString(), eligible, boost::none});
+          }
+          m_surfaces[side] = std::move(surfaces);
+        }
+      }
+
+      void compute() {
+        // see Space_Impl::intersectSurfaces
+        constexpr double boundsTol = 0.05;
+        std::set<std::pair<unsigned, unsigned>> completedIntersections;
+
+        bool anyNewSurfaces = true;
+        while (anyNewSurfaces) {
+          // surfaces created in this pass are only intersected in the next one
+          const unsigned n = m_states[0].size();
+          const unsigned otherN = m_states[1].size();
+
+          for (unsigned i = 0; i < n; ++i) {
+            if (!m_states[0][i].eligible) {
+              continue;
+            }
+            for (unsigned j = 0; j < otherN; ++j) {
+              if (!m_states[1][j].eligible) {
+                continue;
+              }
+              if (!completedIntersections.emplace(i, j).second) {
+                continue;
+              }
+              if (!bounds(0, i).intersects(bounds(1, j), boundsTol)) {
+                continue;
+              }
+
+              boost::optional<detail::SurfaceIntersectionGeometry> geometry = detail::Surface_Impl::computeIntersectionGeometry(
+                m_states[0][i].vertices, m_transformations[0], m_states[0][i].name, m_states[1][j].vertices, m_transformations[1],
+                m_states[1][j].name);
+              if (!geometry) {
+                continue;
+              }
+
+              setVertices(0, i, geometry->vertices1);
+              setVertices(1, j, geometry->vertices2);
+              std::vector<unsigned> ineligible{i};
+              std::vector<unsigned> ineligibleOther{j};
+              for (const std::vector<Point3d>& newVertices : geometry->newVertices1) {
+                ineligible.push_back(addSurface(0, i, newVertices));
+              }
+              for (const std::vector<Point3d>& newVertices : geometry->newVertices2) {
+                ineligibleOther.push_back(addSurface(1, j, newVertices));
+              }
+
+              // surfaces involved in this intersection are ineligible to be re-intersected with other surfaces in this intersection
+              for (unsigned k : ineligible) {
+                for (unsigned l : ineligibleOther) {
+                  completedIntersections.emplace(k, l);
+                }
+              }
+
+              m_intersections.push_back(Intersection{i, j, std::move(*geometry)});
+            }
+          }
+
+          anyNewSurfaces = (m_states[0].size() > n) || (m_states[1].size() > otherN);
+        }
+      }
+
+      void apply() {
+        Model model = m_spaces[0].model();
+        for (const Intersection& intersection : m_intersections) {
+          Surface& surface = m_surfaces[0][intersection.index];
+          Surface& otherSurface = m_surfaces[1][intersection.otherIndex];
+          surface.setVertices(intersection.geometry.vertices1);
+          otherSurface.setVertices(intersection.geometry.vertices2);
+
+          std::vector<Surface> newSurfaces;
+          for (const std::vector<Point3d>& newVertices : intersection.geometry.newVertices1) {
+            Surface newSurface(newVertices, model);
+            newSurface.setSpace(m_spaces[0]);
+            newSurfaces.push_back(newSurface);
+          }
+          std::vector<Surface> newOtherSurfaces;
+          for (const std::vector<Point3d>& newOtherVertices : intersection.geometry.newVertices2) {
+            Surface newOtherSurface(newOtherVertices, model);
+            newOtherSurface.setSpace(m_spaces[1]);
+            newOtherSurfaces.push_back(newOtherSurface);
+          }
+          m_surfaces[0].insert(m_surfaces[0].end(), newSurfaces.begin(), newSurfaces.end());
+          m_surfaces[1].insert(m_surfaces[1].end(), newOtherSurfaces.begin(), newOtherSurfaces.end());
+
+          SurfaceIntersection result(surface, otherSurface, newSurfaces, newOtherSurfaces);
+          LOG(Info, "Intersection of '" << surface.nameString() << "' with '" << otherSurface.nameString() << "' results in " << result);
+        }
+        m_intersections.clear();
+      }
+
+     private:
+      REGISTER_LOGGER("openstudio.model.Space");
+
+      struct SurfaceState
+      {
+        std::vector<Point3d> vertices;
+        std::string name;  // for log messages, new surfaces go by the name of the surface they were split from
+        bool eligible;     // no sub surfaces and no adjacent surface
+        boost::optional<BoundingBox> bounds;
+      };
+
+      struct Intersection
+      {
+        unsigned index;
+        unsigned otherIndex;
+        detail::SurfaceIntersectionGeometry geometry;
+      };
+
+      // vertices as read back from the model after PlanarSurface::setVertices, which stores coordinates as strings
+      static std::vector<Point3d> storedVertices(const std::vector<Point3d>& vertices) {
+        std::vector<Point3d> result;
+        for (const Point3d& vertex : vertices) {
+          try {
+            result.emplace_back(boost::lexical_cast<double>(toString(vertex.x())), boost::lexical_cast<double>(toString(vertex.y())),
+                                boost::lexical_cast<double>(toString(vertex.z())));
+          } catch (const std::exception&) {
+          }
+        }
+        return result;
+      }
+
+      // bounds in building coordinates
+      const BoundingBox& bounds(unsigned side, unsigned index) {
+        SurfaceState& state = m_states[side][index];
+        if (!state.bounds) {
+          state.bounds = BoundingBox();
+          state.bounds->addPoints(m_transformations[side] * state.vertices);
+        }
+        return *state.bounds;
+      }
+
+      void setVertices(unsigned side, unsigned index, const std::vector<Point3d>& vertices) {
+        // PlanarSurface::setVertices leaves the surface alone if the vertices do not define a plane
+        if (vertices.size() < 3) {
+          return;
+        }
+        try {
+          Plane plane(vertices);
+        } catch (const std::exception&) {
+          return;
+        }
+        m_states[side][index].vertices = storedVertices(vertices);
+        m_states[side][index].bounds.reset();
+      }
+
+      unsigned addSurface(unsigned side, unsigned splitFrom, const std::vector<Point3d>& vertices) {
+        std::string name = m_states[side][splitFrom].name;
+        m_states[side].push_back(SurfaceState{storedVertices(vertices), std::move(name), true, boost::none});
+        return m_states[side].size() - 1;
+      }
+
+      std::array<Space, 2> m_spaces;
+      std::array<Transformation, 2> m_transformations;
+      std::array<std::vector<Surface>, 2> m_surfaces;
+      std::array<std::vector<SurfaceState>, 2> m_states;
+      std::vector<Intersection> m_intersections;
+    };
+
+  }  // namespace
+
   void intersectSurfaces(std::vector<Space>& t_spaces) {
     std::vector<Space> spaces(t_spaces);
     std::sort(spaces.begin(), spaces.end(), [](const Space& a, const Space& b) -> bool { return a.floorArea() < b.floorArea(); });
@@ -3678,12 +3980,51 @@ namespace model {
       bounds.push_back(space.transformation() * space.boundingBox());
     }
 
-    for (unsigned i = 0; i < spaces.size(); ++i) {
-      for (unsigned j = i + 1; j < spaces.size(); ++j) {
-        if (!bounds[i].intersects(bounds[j])) {
-          continue;
-        }
-        spaces[i].intersectSurfaces(spaces[j]);
+    for (const auto& [i, j] : intersectingPairs(bounds)) {
+      spaces[i].intersectSurfaces(spaces[j]);
+    }
+  }
+
+  void intersectSurfacesParallel(std::vector<Space>& t_spaces, unsigned numThreads) {
+    std::vector<Space> spaces(t_spaces);
+    std::sort(spaces.begin(), spaces.end(), [](const Space& a, const Space& b) -> bool { return a.floorArea() < b.floorArea(); });
+
+    std::vector<BoundingBox> bounds;
+    for (const Space& space : spaces) {
+      bounds.push_back(space.transformation() * space.boundingBox());
+    }
+
+    // Each pair goes one level past the last level of a pair sharing one of its spaces, so that the pairs in a level are
+    // independent of each other, and see their spaces exactly as intersectSurfaces leaves them after the preceding pairs.
+    std::vector<std::vector<std::pair<unsigned, unsigned>>> levels;
+    std::map<Handle, unsigned> spaceLevels;
+    for (const auto& [i, j] : intersectingPairs(bounds)) {
+      if (spaces[i].handle() == spaces[j].handle()) {
+        continue;
+      }
+      unsigned& level = spaceLevels[spaces[i].handle()];
+      unsigned& otherLevel = spaceLevels[spaces[j].handle()];
+      level = otherLevel = std::max(level, otherLevel) + 1;
+      if (levels.size() < level) {
+        levels.resize(level);
+      }
+      levels[level - 1].emplace_back(i, j);
+    }
+
+    for (const std::vector<std::pair<unsigned, unsigned>>& pairs : levels) {
+      std::vector<SpacePairIntersection> intersections;
+      intersections.reserve(pairs.size());
+      for (const auto& [i, j] : pairs) {
+        intersections.emplace_back(spaces[i], spaces[j]);
+      }
+
+      // compute the level on the thread pool
+      parallelForChunks(intersections.size(), numThreads, 1,
+                        [&intersections](unsigned /*threadIndex*/, std::size_t i) { intersections[i].compute(); });
+
+      // commit the level serially, in pair order
+      for (SpacePairIntersection& intersection : intersections) {
+        intersection.apply();
       }
     }
   }
@@ -3694,13 +4035,8 @@ namespace model {
       bounds.push_back(space.transformation() * space.boundingBox());
     }
 
-    for (unsigned i = 0; i < spaces.size(); ++i) {
-      for (unsigned j = i + 1; j < spaces.size(); ++j) {
-        if (!bounds[i].intersects(bounds[j])) {
-          continue;
-        }
-        spaces[i].matchSurfaces(spaces[j]);
-      }
+    for (const auto& [i, j] : intersectingPairs(bounds)) {
+      spaces[i].matchSurfaces(spaces[j]);
     }
   }
 
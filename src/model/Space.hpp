@@ -660,6 +660,13 @@ namespace model {
   /** Intersect surfaces within spaces. */
   MODEL_API void intersectSurfaces(std::vector<Space>& spaces);
 
+  /** Intersect surfaces within spaces, as intersectSurfaces does. Pairs of spaces that do not share a space are intersected
+   *  concurrently on numThreads threads (0 uses all available cores), without touching the model, and the resulting geometry
+   *  is then applied to the model serially in a fixed order. The resulting geometry is that of intersectSurfaces, and the
+   *  resulting model does not depend on numThreads, though new surfaces may be created in a different order than with
+   *  intersectSurfaces. */
+  MODEL_API void intersectSurfacesParallel(std::vector<Space>& spaces, unsigned numThreads = 0);
+
   /** Match surfaces and sub surfaces within spaces. */
   MODEL_API void matchSurfaces(std::vector<Space>& spaces);
 
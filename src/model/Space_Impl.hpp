@@ -560,6 +560,21 @@ namespace model {
       mutable boost::optional<std::vector<Surface>> m_cachedNonConvexSurfaces;
       mutable boost::optional<bool> m_cachedIsConvex;
       mutable boost::optional<bool> m_cachedIsEnclosed;
+
+      // returns cachedValue, computing it first if the model changed since the aggregates were last cached
+      template <typename Compute>
+      double cachedAggregate(boost::optional<double>& cachedValue, Compute compute) const;
+
+      mutable unsigned m_cachedAggregatesVersion = 0;
+      mutable boost::optional<double> m_cachedFloorArea;
+      mutable boost::optional<double> m_cachedVolume;
+      mutable boost::optional<double> m_cachedExteriorArea;
+      mutable boost::optional<double> m_cachedExteriorWallArea;
+      mutable boost::optional<double> m_cachedNumberOfPeople;
+      mutable boost::optional<double> m_cachedLightingPower;
+      mutable boost::optional<double> m_cachedElectricEquipmentPower;
+      mutable boost::optional<double> m_cachedGasEquipmentPower;
+      mutable boost::optional<double> m_cachedInfiltrationDesignFlowRate;
     };
 
   }  // namespace detail
@@ -991,50 +991,31 @@ namespace model {
       return intersection.has_value();
     }
 
-    boost::optional<SurfaceIntersection> Surface_Impl::computeIntersection(Surface& otherSurface) {
+    boost::optional<SurfaceIntersectionGeometry>
+      Surface_Impl::computeIntersectionGeometry(const std::vector<Point3d>& vertices, const Transformation& spaceTransformation,
+                                                const std::string& name, const std::vector<Point3d>& otherVertices,
+                                                const Transformation& otherSpaceTransformation, const std::string& otherName) {
       double tol = 0.01;       //  1 cm tolerance
       double areaTol = 0.001;  // 10 cm2 tolerance
 
       constexpr bool extraLogging = false;
 
-      boost::optional<Space> space = this->space();
-      boost::optional<Space> otherSpace = otherSurface.space();
-
-      if (!space || !otherSpace || space->handle() == otherSpace->handle()) {
-        LOG(Error, "Cannot find spaces for each surface in intersection or surfaces in same space.");
-        return boost::none;
-      }
-
-      if (!this->subSurfaces().empty() || !otherSurface.subSurfaces().empty()) {
-        LOG(Error, "Subsurfaces are not allowed in intersection");
-        return boost::none;
-      }
-
-      if (this->adjacentSurface() || otherSurface.adjacentSurface()) {
-        LOG(Error, "Adjacent surfaces are not allowed in intersection");
-        return boost::none;
-      }
-
-      // goes from local system to building coordinates
-      Transformation spaceTransformation = space->transformation();
-      Transformation otherSpaceTransformation = otherSpace->transformation();
-
       // do the intersection in building coordinates
 
-      Plane plane = spaceTransformation * this->plane();
-      Plane otherPlane = otherSpaceTransformation * otherSurface.plane();
+      Plane plane = spaceTransformation * Plane(vertices);
+      Plane otherPlane = otherSpaceTransformation * Plane(otherVertices);
 
       if (!plane.reverseEqual(otherPlane)) {
-        //LOG(Info, "Planes are not reverse equal, intersection of '" << this->name().get() << "' with '" << otherSurface.name().get() << "' fails");
+        //LOG(Info, "Planes are not reverse equal, intersection of '" << name << "' with '" << otherName << "' fails");
         return boost::none;
       }
 
       // get vertices in building coordinates
-      std::vector<Point3d> buildingVertices = spaceTransformation * this->vertices();
-      std::vector<Point3d> otherBuildingVertices = otherSpaceTransformation * otherSurface.vertices();
+      std::vector<Point3d> buildingVertices = spaceTransformation * vertices;
+      std::vector<Point3d> otherBuildingVertices = otherSpaceTransformation * otherVertices;
 
       if ((buildingVertices.size() < 3) || (otherBuildingVertices.size() < 3)) {
-        LOG(Error, "Fewer than 3 vertices, intersection of '" << this->name().get() << "' with '" << otherSurface.name().get() << "' fails");
+        LOG(Error, "Fewer than 3 vertices, intersection of '" << name << "' with '" << otherName << "' fails");
         return boost::none;
       }
 
@@ -1045,7 +1026,7 @@ namespace model {
         faceTransformation = Transformation::alignFace(buildingVertices);
         faceTransformationInverse = faceTransformation.inverse();
       } catch (const std::exception&) {
-        LOG(Error, "Cannot compute face transform, intersection of '" << this->name().get() << "' with '" << otherSurface.name().get() << "' fails");
+        LOG(Error, "Cannot compute face transform, intersection of '" << name << "' with '" << otherName << "' fails");
         return boost::none;
       }
 
@@ -1057,7 +1038,7 @@ namespace model {
       std::reverse(faceVertices.begin(), faceVertices.end());
       //std::reverse(otherFaceVertices.begin(), otherFaceVertices.end());
 
-      //LOG(Info, "Trying intersection of '" << this->name().get() << "' with '" << otherSurface.name().get());
+      //LOG(Info, "Trying intersection of '" << name << "' with '" << otherName);
       if constexpr (extraLogging) {
         Point3dVectorVector tmp{faceVertices, otherFaceVertices};
         LOG(Debug, tmp);
@@ -1084,7 +1065,7 @@ namespace model {
       boost::optional<double> area2 = getArea(otherFaceVertices);
       if (area1) {
         if (std::abs(area1.get() - intersection->area1()) > areaTol) {
-          LOG(Error, "Initial area of surface '" << this->nameString() << "' " << area1.get() << " does not equal post intersection area "
+          LOG(Error, "Initial area of surface '" << name << "' " << area1.get() << " does not equal post intersection area "
                                                  << intersection->area1());
           if constexpr (extraLogging) {
             Point3dVectorVector tmp1{faceVertices, otherFaceVertices};
@@ -1099,7 +1080,7 @@ namespace model {
       }
       if (area2) {
         if (std::abs(area2.get() - intersection->area2()) > areaTol) {
-          LOG(Error, "Initial area of other surface '" << otherSurface.nameString() << "' " << area2.get()
+          LOG(Error, "Initial area of other surface '" << otherName << "' " << area2.get()
                                                        << " does not equal post intersection area " << intersection->area2());
           if constexpr (extraLogging) {
             Point3dVectorVector tmp1{faceVertices, otherFaceVertices};
@@ -1113,82 +1094,87 @@ namespace model {
         }
       }
 
-      // non-zero intersection
-      // could match here but will save that for other discrete operation
-      Surface surface(std::dynamic_pointer_cast<Surface_Impl>(this->shared_from_this()));
-      std::vector<Surface> newSurfaces;
-      std::vector<Surface> newOtherSurfaces;
-
-      //LOG(Debug, "Before intersection");
-      //LOG(Debug, surface);
-      //LOG(Debug, otherSurface);
+      SurfaceIntersectionGeometry result;
 
       // goes from building coordinates to local system
       Transformation spaceTransformationInverse = spaceTransformation.inverse();
       Transformation otherSpaceTransformationInverse = otherSpaceTransformation.inverse();
 
-      std::vector<std::vector<Point3d>> newPolygons1 = intersection->newPolygons1();
-      std::vector<std::vector<Point3d>> newPolygons2 = intersection->newPolygons2();
-
-      // modify vertices for surface in this space
-      std::vector<Point3d> newBuildingVertices = faceTransformation * intersection->polygon1();
-      std::vector<Point3d> newVertices = spaceTransformationInverse * newBuildingVertices;
-      std::reverse(newVertices.begin(), newVertices.end());
-      newVertices = reorderULC(newVertices);
-      this->setVertices(newVertices);
-      //this->setAdjacentSurface(otherSurface);
-
-      // modify vertices for surface in other space
-      std::vector<Point3d> newOtherBuildingVertices = faceTransformation * intersection->polygon2();
-      std::vector<Point3d> newOtherVertices = otherSpaceTransformationInverse * newOtherBuildingVertices;
-      newOtherVertices = reorderULC(newOtherVertices);
-      otherSurface.setVertices(newOtherVertices);
-      //otherSurface.setAdjacentSurface(surface);
-
-      if (newPolygons1.empty() && newPolygons2.empty()) {
-        // both surfaces intersect perfectly, no-op
-      } else {
-        // new surfaces are created
-        // create new surfaces in this space
-        for (unsigned i = 0; i < newPolygons1.size(); ++i) {
-
-          // new surface in this space
-          newBuildingVertices = faceTransformation * newPolygons1[i];
-          newVertices = spaceTransformationInverse * newBuildingVertices;
-          std::reverse(newVertices.begin(), newVertices.end());
-          newVertices = reorderULC(newVertices);
-          Surface newSurface(newVertices, this->model());
-          newSurface.setSpace(*space);
-          newSurfaces.push_back(newSurface);
-        }
+      // new vertices for surface in this space
+      result.vertices1 = spaceTransformationInverse * (faceTransformation * intersection->polygon1());
+      std::reverse(result.vertices1.begin(), result.vertices1.end());
+      result.vertices1 = reorderULC(result.vertices1);
 
-        // create new surfaces in other space
-        for (unsigned i = 0; i < newPolygons2.size(); ++i) {
+      // new vertices for surface in other space
+      result.vertices2 = reorderULC(otherSpaceTransformationInverse * (faceTransformation * intersection->polygon2()));
 
-          // new surface in other space
-          newOtherBuildingVertices = faceTransformation * newPolygons2[i];
-          newOtherVertices = otherSpaceTransformationInverse * newOtherBuildingVertices;
-          newOtherVertices = reorderULC(newOtherVertices);
-          Surface newOtherSurface(newOtherVertices, this->model());
-          newOtherSurface.setSpace(*otherSpace);
-          newOtherSurfaces.push_back(newOtherSurface);
-        }
+      // new surfaces in this space
+      for (const std::vector<Point3d>& newPolygon : intersection->newPolygons1()) {
+        std::vector<Point3d> newVertices = spaceTransformationInverse * (faceTransformation * newPolygon);
+        std::reverse(newVertices.begin(), newVertices.end());
+        result.newVertices1.push_back(reorderULC(newVertices));
+      }
+
+      // new surfaces in other space
+      for (const std::vector<Point3d>& newPolygon : intersection->newPolygons2()) {
+        result.newVertices2.push_back(reorderULC(otherSpaceTransformationInverse * (faceTransformation * newPolygon)));
+      }
+
+      return result;
+    }
+
+    boost::optional<SurfaceIntersection> Surface_Impl::computeIntersection(Surface& otherSurface) {
+      boost::optional<Space> space = this->space();
+      boost::optional<Space> otherSpace = otherSurface.space();
+
+      if (!space || !otherSpace || space->handle() == otherSpace->handle()) {
+        LOG(Error, "Cannot find spaces for each surface in intersection or surfaces in same space.");
+        return boost::none;
+      }
+
+      if (!this->subSurfaces().empty() || !otherSurface.subSurfaces().empty()) {
+        LOG(Error, "Subsurfaces are not allowed in intersection");
+        return boost::none;
+      }
+
+      if (this->adjacentSurface() || otherSurface.adjacentSurface()) {
+        LOG(Error, "Adjacent surfaces are not allowed in intersection");
+        return boost::none;
+      }
+
+      boost::optional<SurfaceIntersectionGeometry> geometry =
+        computeIntersectionGeometry(this->vertices(), space->transformation(), this->nameString(), otherSurface.vertices(),
+                                    otherSpace->transformation(), otherSurface.nameString());
+      if (!geometry) {
+        return boost::none;
+      }
+
+      // non-zero intersection
+      // could match here but will save that for other discrete operation
+      Surface surface(std::dynamic_pointer_cast<Surface_Impl>(this->shared_from_this()));
+      std::vector<Surface> newSurfaces;
+      std::vector<Surface> newOtherSurfaces;
+
+      // modify vertices for surfaces in this space and in other space
+      this->setVertices(geometry->vertices1);
+      otherSurface.setVertices(geometry->vertices2);
+
+      // create new surfaces in this space and in other space, none if both surfaces intersect perfectly
+      for (const std::vector<Point3d>& newVertices : geometry->newVertices1) {
+        Surface newSurface(newVertices, this->model());
+        newSurface.setSpace(*space);
+        newSurfaces.push_back(newSurface);
+      }
+      for (const std::vector<Point3d>& newOtherVertices : geometry->newVertices2) {
+        Surface newOtherSurface(newOtherVertices, this->model());
+        newOtherSurface.setSpace(*otherSpace);
+        newOtherSurfaces.push_back(newOtherSurface);
       }
 
       SurfaceIntersection result(surface, otherSurface, newSurfaces, newOtherSurfaces);
 
       LOG(Info, "Intersection of '" << this->name().get() << "' with '" << otherSurface.name().get() << "' results in " << result);
 
-      //LOG(Debug, "After intersection");
-      //LOG(Debug, surface);
-      //LOG(Debug, otherSurface);
-      //for (const Surface& s : newSurfaces){
-      //  LOG(Debug, s);
-      //}
-      //for (const Surface& s : newOtherSurfaces){
-      //  LOG(Debug, s);
-      //}
-
       return result;
     }
 
@@ -11,6 +11,7 @@
 
 namespace openstudio {
 class Polygon3d;
+class Transformation;
 namespace model {
 
   class AirflowNetworkSurface;
@@ -31,6 +32,19 @@ namespace model {
 
   namespace detail {
 
+    /** Geometry resulting from the intersection of two surfaces, see Surface_Impl::computeIntersectionGeometry. All vertices
+     *  are in the coordinates of the space of the respective surface. */
+    struct SurfaceIntersectionGeometry
+    {
+      /// new vertices of the first and second surface
+      std::vector<Point3d> vertices1;
+      std::vector<Point3d> vertices2;
+
+      /// vertices of the new surfaces to create in the first and second space
+      std::vector<std::vector<Point3d>> newVertices1;
+      std::vector<std::vector<Point3d>> newVertices2;
+    };
+
     /** Surface_Impl is a PlanarSurface_Impl that is the implementation class for Surface.*/
     class MODEL_API Surface_Impl : public PlanarSurface_Impl
     {
@@ -201,6 +215,13 @@ namespace model {
       bool intersect(Surface& otherSurface);
       boost::optional<SurfaceIntersection> computeIntersection(Surface& otherSurface);
 
+      /** Geometric part of computeIntersection, intersects surface vertices given in the coordinates of their spaces without
+       *  touching the model. Names are only used in log messages. Safe to call concurrently. */
+      static boost::optional<SurfaceIntersectionGeometry>
+        computeIntersectionGeometry(const std::vector<Point3d>& vertices, const Transformation& spaceTransformation, const std::string& name,
+                                    const std::vector<Point3d>& otherVertices, const Transformation& otherSpaceTransformation,
+                                    const std::string& otherName);
+
       boost::optional<Surface> createAdjacentSurface(const Space& otherSpace);
 
       bool isPartOfEnvelope() const;
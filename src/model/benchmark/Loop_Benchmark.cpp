@@ -0,0 +1,57 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#include <benchmark/benchmark.h>
+
+#include "../Model.hpp"
+
+#include "../AirLoopHVAC.hpp"
+#include "../AirLoopHVAC_Impl.hpp"
+#include "../AirTerminalSingleDuctConstantVolumeNoReheat.hpp"
+#include "../Schedule.hpp"
+#include "../ThermalZone.hpp"
+#include "../../utilities/core/Assert.hpp"
+
+using namespace openstudio;
+using namespace openstudio::model;
+
+model::Model makeModelWithNZonesOnAirLoop(size_t nZones) {
+
+  Model m;
+
+  AirLoopHVAC airLoopHVAC(m);
+  Schedule s = m.alwaysOnDiscreteSchedule();
+  AirTerminalSingleDuctConstantVolumeNoReheat terminal(m, s);
+
+  for (size_t i = 0; i < nZones; ++i) {
+    ThermalZone z(m);
+    if (i == 0) {
+      airLoopHVAC.addBranchForZone(z, terminal);
+    } else {
+      // This clones the last terminal
+      airLoopHVAC.addBranchForZone(z);
+    }
+  }
+
+  OS_ASSERT(airLoopHVAC.thermalZones().size() == nZones);
+
+  return m;
+}
+
+static void BM_DemandComponents(benchmark::State& state) {
+
+  Model m = makeModelWithNZonesOnAirLoop(state.range(0));
+  AirLoopHVAC airLoopHVAC = m.getConcreteModelObjects<AirLoopHVAC>()[0];
+
+  // Code inside this loop is measured repeatedly
+  for (auto _ : state) {
+    auto comps = airLoopHVAC.demandComponents();
+    benchmark::DoNotOptimize(comps);
+  }
+
+  state.SetComplexityN(state.range(0));
+}
+
+BENCHMARK(BM_DemandComponents)->Unit(benchmark::kMillisecond)->RangeMultiplier(4)->Range(1, 1024)->Complexity();
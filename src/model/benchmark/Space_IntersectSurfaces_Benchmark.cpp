@@ -0,0 +1,85 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#include <benchmark/benchmark.h>
+
+#include "../Model.hpp"
+
+#include "../Space.hpp"
+#include "../../utilities/geometry/Point3d.hpp"
+#include "../../utilities/core/Assert.hpp"
+
+using namespace openstudio;
+using namespace openstudio::model;
+
+// nSide x nSide grid of single story spaces, every other column shifted by half a space so that walls need intersecting
+std::vector<Space> makeGridOfSpaces(Model& m, int nSide) {
+
+  std::vector<Space> spaces;
+  for (int i = 0; i < nSide; ++i) {
+    double yOffset = (i % 2) * 5.0;
+    for (int j = 0; j < nSide; ++j) {
+      Point3dVector pts{
+        {10.0 * i, 10.0 * j + yOffset + 10.0, 0.0},
+        {10.0 * i + 10.0, 10.0 * j + yOffset + 10.0, 0.0},
+        {10.0 * i + 10.0, 10.0 * j + yOffset, 0.0},
+        {10.0 * i, 10.0 * j + yOffset, 0.0},
+      };
+      auto space_ = Space::fromFloorPrint(pts, 3.0, m);
+      OS_ASSERT(space_);
+      spaces.push_back(*space_);
+    }
+  }
+
+  return spaces;
+}
+
+static void BM_IntersectSurfaces(benchmark::State& state) {
+
+  for (auto _ : state) {
+
+    state.PauseTiming();
+    Model m;
+    std::vector<Space> spaces = makeGridOfSpaces(m, state.range(0));
+    state.ResumeTiming();
+
+    intersectSurfaces(spaces);
+  }
+
+  state.SetComplexityN(state.range(0) * state.range(0));
+}
+
+static void BM_IntersectSurfacesParallel(benchmark::State& state) {
+
+  for (auto _ : state) {
+
+    state.PauseTiming();
+    Model m;
+    std::vector<Space> spaces = makeGridOfSpaces(m, 16);
+    state.ResumeTiming();
+
+    intersectSurfacesParallel(spaces, static_cast<unsigned>(state.range(0)));
+  }
+}
+
+static void BM_MatchSurfaces(benchmark::State& state) {
+
+  for (auto _ : state) {
+
+    state.PauseTiming();
+    Model m;
+    std::vector<Space> spaces = makeGridOfSpaces(m, state.range(0));
+    intersectSurfaces(spaces);
+    state.ResumeTiming();
+
+    matchSurfaces(spaces);
+  }
+
+  state.SetComplexityN(state.range(0) * state.range(0));
+}
+
+BENCHMARK(BM_IntersectSurfaces)->Unit(benchmark::kMillisecond)->RangeMultiplier(2)->Range(2, 32)->Complexity();
+BENCHMARK(BM_IntersectSurfacesParallel)->Unit(benchmark::kMillisecond)->RangeMultiplier(2)->Range(1, 16);
+BENCHMARK(BM_MatchSurfaces)->Unit(benchmark::kMillisecond)->RangeMultiplier(2)->Range(2, 32)->Complexity();
@@ -762,3 +762,96 @@ TEST_F(ModelFixture, Building_clone_SurfaceMatching) {
   auto nMatchedClone = std::count_if(surfaceClones.cbegin(), surfaceClones.cend(), [](const auto& s) { return s.adjacentSurface(); });
   EXPECT_EQ(nMatched, nMatchedClone);
 }
+
+TEST_F(ModelFixture, Building_CachedAggregates) {
+  Model model;
+
+  Building building = model.getUniqueModelObject<Building>();
+
+  // floor
+  Point3dVector points{
+    {0, 10, 0},
+    {10, 10, 0},
+    {10, 0, 0},
+    {0, 0, 0},
+  };
+  boost::optional<Space> space = Space::fromFloorPrint(points, 3, model);
+  ASSERT_TRUE(space);
+  EXPECT_NEAR(100, space->floorArea(), 0.0001);
+  EXPECT_NEAR(300, space->volume(), 0.0001);
+  EXPECT_NEAR(120, space->exteriorWallArea(), 0.0001);
+  EXPECT_NEAR(100, building.floorArea(), 0.0001);
+  EXPECT_NEAR(300, building.airVolume(), 0.0001);
+
+  LightsDefinition lightsDefinition(model);
+  EXPECT_TRUE(lightsDefinition.setWattsperSpaceFloorArea(10));
+  Lights light(lightsDefinition);
+  EXPECT_TRUE(light.setSpace(*space));
+  EXPECT_NEAR(1000, building.lightingPower(), 0.0001);
+  EXPECT_NEAR(10, building.lightingPowerPerFloorArea(), 0.0001);
+
+  // repeated queries return the same values
+  EXPECT_NEAR(100, building.floorArea(), 0.0001);
+  EXPECT_NEAR(1000, building.lightingPower(), 0.0001);
+
+  // moving a vertex changes the floor area, and the loads defined per floor area
+  std::vector<Surface> floors;
+  for (const Surface& surface : space->surfaces()) {
+    if (surface.surfaceType() == "Floor") {
+      floors.push_back(surface);
+    }
+  }
+  ASSERT_EQ(1u, floors.size());
+  Point3dVector floorVertices = floors[0].vertices();
+  ASSERT_EQ(4u, floorVertices.size());
+  EXPECT_TRUE(floors[0].setVertices(Point3dVector{{0, 0, 0}, {0, 5, 0}, {10, 5, 0}, {10, 0, 0}}));
+  EXPECT_NEAR(50, space->floorArea(), 0.0001);
+  EXPECT_NEAR(50, building.floorArea(), 0.0001);
+  EXPECT_NEAR(500, building.lightingPower(), 0.0001);
+  EXPECT_TRUE(floors[0].setVertices(floorVertices));
+  EXPECT_NEAR(100, building.floorArea(), 0.0001);
+
+  // changing a definition or adding a space type with loads
+  EXPECT_TRUE(lightsDefinition.setWattsperSpaceFloorArea(5));
+  EXPECT_NEAR(500, building.lightingPower(), 0.0001);
+
+  SpaceType spaceType(model);
+  PeopleDefinition peopleDefinition(model);
+  EXPECT_TRUE(peopleDefinition.setPeopleperSpaceFloorArea(0.1));
+  People people(peopleDefinition);
+  EXPECT_TRUE(people.setSpaceType(spaceType));
+  EXPECT_NEAR(0, building.numberOfPeople(), 0.0001);
+  EXPECT_TRUE(space->setSpaceType(spaceType));
+  EXPECT_NEAR(10, space->numberOfPeople(), 0.0001);
+  EXPECT_NEAR(10, building.numberOfPeople(), 0.0001);
+  EXPECT_NEAR(10, building.floorAreaPerPerson(), 0.0001);
+
+  // fixing the floor area on the space
+  EXPECT_TRUE(space->setFloorArea(200));
+  EXPECT_NEAR(200, building.floorArea(), 0.0001);
+  EXPECT_NEAR(20, building.numberOfPeople(), 0.0001);
+  space->resetFloorArea();
+  EXPECT_NEAR(100, building.floorArea(), 0.0001);
+
+  // excluding the space from the floor area
+  EXPECT_TRUE(space->setPartofTotalFloorArea(false));
+  EXPECT_NEAR(0, building.floorArea(), 0.0001);
+  EXPECT_TRUE(space->setPartofTotalFloorArea(true));
+  EXPECT_NEAR(100, building.floorArea(), 0.0001);
+
+  // adding and removing spaces
+  boost::optional<Space> space2 = Space::fromFloorPrint(points, 3, model);
+  ASSERT_TRUE(space2);
+  EXPECT_NEAR(200, building.floorArea(), 0.0001);
+  EXPECT_NEAR(600, building.airVolume(), 0.0001);
+  EXPECT_NEAR(500, building.lightingPower(), 0.0001);
+  space2->remove();
+  EXPECT_NEAR(100, building.floorArea(), 0.0001);
+
+  // removing loads
+  light.remove();
+  EXPECT_NEAR(0, building.lightingPower(), 0.0001);
+  floors[0].remove();
+  EXPECT_NEAR(0, space->floorArea(), 0.0001);
+  EXPECT_NEAR(0, building.floorArea(), 0.0001);
+}
@@ -23,6 +23,12 @@
 #include "../FanConstantVolume.hpp"
 #include "../CoilHeatingElectric.hpp"
 #include "../CoilCoolingDXSingleSpeed.hpp"
+#include "../AirTerminalSingleDuctConstantVolumeNoReheat.hpp"
+#include "../ThermalZone.hpp"
+#include "../AirLoopHVACZoneSplitter.hpp"
+#include "../AirLoopHVACZoneMixer.hpp"
+#include "../Connection.hpp"
+#include "../Connection_Impl.hpp"
 
 using namespace openstudio::model;
 
@@ -92,3 +98,100 @@ TEST_F(ModelFixture, Loop_DeleteUnitaryVAVChangeoverBypassAirLoopHVAC) {
   inletComponents = airLoopHVAC.supplyComponents(supplyInletNode, supplyOutletNode);
   EXPECT_EQ(3, inletComponents.size());
 }
+
+TEST_F(ModelFixture, Loop_demandComponents_ManyZones) {
+  Model model;
+
+  AirLoopHVAC airLoopHVAC(model);
+  Schedule s = model.alwaysOnDiscreteSchedule();
+  AirTerminalSingleDuctConstantVolumeNoReheat terminal(model, s);
+
+  constexpr unsigned numZones = 50;
+  std::vector<ThermalZone> zones;
+  for (unsigned i = 0; i < numZones; ++i) {
+    zones.emplace_back(model);
+    if (i == 0) {
+      EXPECT_TRUE(airLoopHVAC.addBranchForZone(zones.back(), terminal));
+    } else {
+      // This clones the last terminal
+      EXPECT_TRUE(airLoopHVAC.addBranchForZone(zones.back()));
+    }
+  }
+
+  // Inlet Node, splitter, mixer, outlet node
+  // and for each zone: ATU inlet Node, ATU, TZ inlet Node, Thermal Zone, TZ outlet Node
+  std::vector<ModelObject> demandComponents = airLoopHVAC.demandComponents();
+  ASSERT_EQ(4u + 5u * numZones, demandComponents.size());
+
+  // The first path comes first, then the branches not on it
+  EXPECT_EQ(airLoopHVAC.demandInletNode(), demandComponents[0]);
+  EXPECT_EQ(airLoopHVAC.zoneSplitter(), demandComponents[1]);
+  EXPECT_EQ(airLoopHVAC.zoneMixer(), demandComponents[7]);
+  EXPECT_EQ(airLoopHVAC.demandOutletNode(), demandComponents[8]);
+  for (const ThermalZone& zone : zones) {
+    EXPECT_NE(demandComponents.end(), std::find(demandComponents.begin(), demandComponents.end(), zone));
+  }
+  EXPECT_EQ(numZones, airLoopHVAC.demandComponents(ThermalZone::iddObjectType()).size());
+
+  // From the splitter to one of the zones
+  std::vector<ModelObject> branchComponents = airLoopHVAC.demandComponents(airLoopHVAC.zoneSplitter(), zones[10]);
+  ASSERT_EQ(5u, branchComponents.size());
+  EXPECT_EQ(airLoopHVAC.zoneSplitter(), branchComponents.front());
+  EXPECT_EQ(zones[10], branchComponents.back());
+
+  // The cached topology follows connection changes
+  EXPECT_TRUE(airLoopHVAC.removeBranchForZone(zones[10]));
+  demandComponents = airLoopHVAC.demandComponents();
+  EXPECT_EQ(4u + 5u * (numZones - 1), demandComponents.size());
+  EXPECT_EQ(demandComponents.end(), std::find(demandComponents.begin(), demandComponents.end(), zones[10]));
+
+  EXPECT_TRUE(airLoopHVAC.addBranchForZone(zones[10]));
+  EXPECT_EQ(4u + 5u * numZones, airLoopHVAC.demandComponents().size());
+
+  Node supplyInletNode = airLoopHVAC.supplyInletNode();
+  EXPECT_EQ(2u, airLoopHVAC.supplyComponents().size());
+  FanConstantVolume fan(model, s);
+  EXPECT_TRUE(fan.addToNode(supplyInletNode));
+  EXPECT_EQ(4u, airLoopHVAC.supplyComponents().size());
+  fan.remove();
+  EXPECT_EQ(2u, airLoopHVAC.supplyComponents().size());
+}
+
+TEST_F(ModelFixture, Loop_supplyComponents_DirectConnectionEdit) {
+  Model model;
+
+  AirLoopHVAC airLoopHVAC(model);
+  Node supplyInletNode = airLoopHVAC.supplyInletNode();
+  Node supplyOutletNode = airLoopHVAC.supplyOutletNode();
+  ASSERT_EQ(2u, airLoopHVAC.supplyComponents().size());
+
+  // Put a node between the supply inlet and outlet nodes by editing the connections and ports directly, without connect or disconnect
+  boost::optional<Connection> inletConnection = supplyInletNode.getModelObjectTarget<Connection>(supplyInletNode.outletPort());
+  ASSERT_TRUE(inletConnection);
+  Node node(model);
+  EXPECT_TRUE(inletConnection->setTargetObject(node));
+  EXPECT_TRUE(inletConnection->setTargetObjectPort(node.inletPort()));
+  EXPECT_TRUE(node.setPointer(node.inletPort(), inletConnection->handle()));
+
+  Connection outletConnection(model);
+  EXPECT_TRUE(outletConnection.setSourceObject(node));
+  EXPECT_TRUE(outletConnection.setSourceObjectPort(node.outletPort()));
+  EXPECT_TRUE(outletConnection.setTargetObject(supplyOutletNode));
+  EXPECT_TRUE(outletConnection.setTargetObjectPort(supplyOutletNode.inletPort()));
+  EXPECT_TRUE(node.setPointer(node.outletPort(), outletConnection.handle()));
+  EXPECT_TRUE(supplyOutletNode.setPointer(supplyOutletNode.inletPort(), outletConnection.handle()));
+
+  std::vector<ModelObject> supplyComponents = airLoopHVAC.supplyComponents();
+  ASSERT_EQ(3u, supplyComponents.size());
+  EXPECT_EQ(supplyInletNode, supplyComponents[0]);
+  EXPECT_EQ(node, supplyComponents[1]);
+  EXPECT_EQ(supplyOutletNode, supplyComponents[2]);
+
+  // Retarget the connection of the inlet node back to the outlet node, through the Connection setters only
+  EXPECT_TRUE(inletConnection->setTargetObject(supplyOutletNode));
+  EXPECT_TRUE(inletConnection->setTargetObjectPort(supplyOutletNode.inletPort()));
+  supplyComponents = airLoopHVAC.supplyComponents();
+  ASSERT_EQ(2u, supplyComponents.size());
+  EXPECT_EQ(supplyInletNode, supplyComponents[0]);
+  EXPECT_EQ(supplyOutletNode, supplyComponents[1]);
+}
@@ -0,0 +1,188 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "ModelFixture.hpp"
+#include "../ScheduleAnnualProfile.hpp"
+#include "../ScheduleRuleset.hpp"
+#include "../ScheduleRule.hpp"
+#include "../ScheduleDay.hpp"
+#include "../ScheduleConstant.hpp"
+#include "../ScheduleCompact.hpp"
+#include "../ScheduleFixedInterval.hpp"
+#include "../Timestep.hpp"
+#include "../YearDescription.hpp"
+
+#include "../../utilities/idf/IdfExtensibleGroup.hpp"
+#include "../../utilities/data/TimeSeries.hpp"
+#include "../../utilities/data/Vector.hpp"
+#include "../../utilities/time/Date.hpp"
+#include "../../utilities/time/Time.hpp"
+
+using namespace openstudio::model;
+using namespace openstudio;
+
+TEST_F(ModelFixture, ScheduleAnnualProfile_ScheduleRuleset) {
+  Model model;
+
+  // 2009 starts on a Thursday
+  model::YearDescription yd = model.getUniqueModelObject<model::YearDescription>();
+  yd.setCalendarYear(2009);
+
+  ScheduleRuleset schedule(model);
+  ScheduleDay weekday = schedule.defaultDaySchedule();
+  EXPECT_TRUE(weekday.addValue(Time(0, 8, 0), 0.0));
+  EXPECT_TRUE(weekday.addValue(Time(0, 18, 0), 1.0));
+  EXPECT_TRUE(weekday.addValue(Time(0, 24, 0), 0.0));
+
+  ScheduleRule weekendRule(schedule);
+  EXPECT_TRUE(weekendRule.setApplySaturday(true));
+  EXPECT_TRUE(weekendRule.setApplySunday(true));
+  EXPECT_TRUE(weekendRule.daySchedule().addValue(Time(0, 24, 0), 0.25));
+
+  boost::optional<ScheduleAnnualProfile> profile = schedule.annualProfile(4);
+  ASSERT_TRUE(profile);
+  EXPECT_EQ(2009, profile->year());
+  EXPECT_EQ(4, profile->numberOfTimestepsPerHour());
+  EXPECT_EQ(365u, profile->numberOfDays());
+  EXPECT_EQ(365u * 24u * 4u, profile->values().size());
+
+  // Thursday
+  EXPECT_DOUBLE_EQ(0.0, profile->value(Date(MonthOfYear::Jan, 1), Time(0, 7, 59)));
+  EXPECT_DOUBLE_EQ(0.0, profile->value(Date(MonthOfYear::Jan, 1), Time(0, 8, 0)));
+  EXPECT_DOUBLE_EQ(1.0, profile->value(Date(MonthOfYear::Jan, 1), Time(0, 8, 1)));
+  EXPECT_DOUBLE_EQ(1.0, profile->value(Date(MonthOfYear::Jan, 1), Time(0, 18, 0)));
+  EXPECT_DOUBLE_EQ(0.0, profile->value(Date(MonthOfYear::Jan, 1), Time(0, 18, 1)));
+  // Saturday
+  EXPECT_DOUBLE_EQ(0.25, profile->value(Date(MonthOfYear::Jan, 3), Time(0, 12, 0)));
+  EXPECT_DOUBLE_EQ(0.25, profile->value(DateTime(Date(MonthOfYear::Dec, 27), Time(0, 0, 0))));
+  // Wednesday
+  EXPECT_DOUBLE_EQ(1.0, profile->value(Date(MonthOfYear::Dec, 30), Time(0, 12, 0)));
+
+  // agrees with the day schedules in effect
+  for (const Date& date : {Date(MonthOfYear::Jan, 1), Date(MonthOfYear::Mar, 14), Date(MonthOfYear::Jul, 6), Date(MonthOfYear::Dec, 31)}) {
+    ScheduleDay daySchedule = schedule.getDaySchedules(date, date)[0];
+    std::vector<double> dailyValues = profile->dailyValues(date);
+    ASSERT_EQ(96u, dailyValues.size());
+    for (unsigned j = 0; j < dailyValues.size(); ++j) {
+      EXPECT_DOUBLE_EQ(daySchedule.getValue(Time(0, 0, 15 * (j + 1))), dailyValues[j]);
+    }
+  }
+
+  // 261 weekdays at full load for 10 hours and 104 weekend days at a quarter load all day
+  EXPECT_DOUBLE_EQ(0.0, profile->minimumValue());
+  EXPECT_DOUBLE_EQ(1.0, profile->maximumValue());
+  EXPECT_DOUBLE_EQ(261 * 10.0 + 104 * 6.0, profile->equivalentFullLoadHours());
+
+  TimeSeries timeSeries = profile->timeSeries();
+  EXPECT_EQ(profile->values().size(), timeSeries.values().size());
+  EXPECT_EQ(DateTime(Date(MonthOfYear::Jan, 1, 2009), Time(0, 0, 15)), timeSeries.firstReportDateTime());
+
+  // the model timestep is used by default
+  Timestep timestep = model.getUniqueModelObject<Timestep>();
+  EXPECT_TRUE(timestep.setNumberOfTimestepsPerHour(6));
+  profile = schedule.annualProfile();
+  ASSERT_TRUE(profile);
+  EXPECT_EQ(6, profile->numberOfTimestepsPerHour());
+  EXPECT_EQ(365u * 24u * 6u, profile->values().size());
+
+  EXPECT_FALSE(schedule.annualProfile(0));
+  EXPECT_FALSE(schedule.annualProfile(7));
+  EXPECT_FALSE(schedule.annualProfile(120));
+}
+
+TEST_F(ModelFixture, ScheduleAnnualProfile_Cache) {
+  Model model;
+
+  model::YearDescription yd = model.getUniqueModelObject<model::YearDescription>();
+  yd.setCalendarYear(2009);
+
+  ScheduleRuleset schedule(model, 1.0);
+
+  boost::optional<ScheduleAnnualProfile> profile = schedule.annualProfile(1);
+  ASSERT_TRUE(profile);
+  EXPECT_DOUBLE_EQ(8760.0, profile->equivalentFullLoadHours());
+
+  // changing a day schedule clears the cached profile
+  EXPECT_TRUE(schedule.defaultDaySchedule().addValue(Time(0, 12, 0), 0.0));
+  profile = schedule.annualProfile(1);
+  ASSERT_TRUE(profile);
+  EXPECT_DOUBLE_EQ(0.0, profile->value(Date(MonthOfYear::Jan, 1), Time(0, 6, 0)));
+  EXPECT_DOUBLE_EQ(1.0, profile->value(Date(MonthOfYear::Jan, 1), Time(0, 18, 0)));
+  EXPECT_DOUBLE_EQ(4380.0, profile->equivalentFullLoadHours());
+
+  // so does adding a rule, and then changing its day schedule
+  ScheduleRule fridayRule(schedule);
+  EXPECT_TRUE(fridayRule.setApplyFriday(true));
+  EXPECT_TRUE(fridayRule.daySchedule().addValue(Time(0, 24, 0), 0.5));
+  profile = schedule.annualProfile(1);
+  ASSERT_TRUE(profile);
+  EXPECT_DOUBLE_EQ(0.5, profile->value(Date(MonthOfYear::Jan, 2), Time(0, 6, 0)));
+
+  EXPECT_TRUE(fridayRule.daySchedule().addValue(Time(0, 24, 0), 0.75));
+  profile = schedule.annualProfile(1);
+  ASSERT_TRUE(profile);
+  EXPECT_DOUBLE_EQ(0.75, profile->value(Date(MonthOfYear::Jan, 2), Time(0, 6, 0)));
+
+  // and removing it
+  fridayRule.remove();
+  profile = schedule.annualProfile(1);
+  ASSERT_TRUE(profile);
+  EXPECT_DOUBLE_EQ(0.0, profile->value(Date(MonthOfYear::Jan, 2), Time(0, 6, 0)));
+
+  // changing the year recomputes the profile
+  yd.setCalendarYear(2012);
+  profile = schedule.annualProfile(1);
+  ASSERT_TRUE(profile);
+  EXPECT_EQ(2012, profile->year());
+  EXPECT_EQ(366u * 24u, profile->values().size());
+}
+
+TEST_F(ModelFixture, ScheduleAnnualProfile_OtherSchedules) {
+  Model model;
+
+  model::YearDescription yd = model.getUniqueModelObject<model::YearDescription>();
+  yd.setCalendarYear(2009);
+
+  ScheduleConstant constant(model);
+  EXPECT_TRUE(constant.setValue(0.5));
+  boost::optional<ScheduleAnnualProfile> profile = constant.annualProfile(2);
+  ASSERT_TRUE(profile);
+  EXPECT_DOUBLE_EQ(0.5, profile->minimumValue());
+  EXPECT_DOUBLE_EQ(0.5, profile->maximumValue());
+  EXPECT_DOUBLE_EQ(4380.0, profile->equivalentFullLoadHours());
+
+  ScheduleCompact compact(model);
+  compact.pushExtensibleGroup(std::vector<std::string>{"Through: 12/31"});
+  compact.pushExtensibleGroup(std::vector<std::string>{"For: Weekdays SummerDesignDay"});
+  compact.pushExtensibleGroup(std::vector<std::string>{"Until: 08:00"});
+  compact.pushExtensibleGroup(std::vector<std::string>{"0.0"});
+  compact.pushExtensibleGroup(std::vector<std::string>{"Until: 24:00"});
+  compact.pushExtensibleGroup(std::vector<std::string>{"1.0"});
+  compact.pushExtensibleGroup(std::vector<std::string>{"For: AllOtherDays"});
+  compact.pushExtensibleGroup(std::vector<std::string>{"Until: 24:00"});
+  compact.pushExtensibleGroup(std::vector<std::string>{"0.5"});
+  profile = compact.annualProfile(4);
+  ASSERT_TRUE(profile);
+  EXPECT_DOUBLE_EQ(0.0, profile->value(Date(MonthOfYear::Jan, 1), Time(0, 8, 0)));
+  EXPECT_DOUBLE_EQ(1.0, profile->value(Date(MonthOfYear::Jan, 1), Time(0, 8, 15)));
+  EXPECT_DOUBLE_EQ(0.5, profile->value(Date(MonthOfYear::Jan, 3), Time(0, 8, 15)));
+  EXPECT_DOUBLE_EQ(261 * 16.0 + 104 * 12.0, profile->equivalentFullLoadHours());
+
+  ScheduleFixedInterval fixedInterval(model);
+  Vector values(8760);
+  for (unsigned i = 0; i < values.size(); ++i) {
+    values[i] = i % 24;
+  }
+  EXPECT_TRUE(fixedInterval.setTimeSeries(TimeSeries(Date(MonthOfYear::Jan, 1), Time(0, 0, 60), values, "")));
+  profile = fixedInterval.annualProfile(4);
+  ASSERT_TRUE(profile);
+  EXPECT_DOUBLE_EQ(0.0, profile->value(Date(MonthOfYear::Jan, 1), Time(0, 0, 15)));
+  EXPECT_DOUBLE_EQ(10.0, profile->value(Date(MonthOfYear::Jan, 1), Time(0, 10, 30)));
+  EXPECT_DOUBLE_EQ(23.0, profile->value(Date(MonthOfYear::Dec, 31), Time(0, 23, 45)));
+  EXPECT_DOUBLE_EQ(0.0, profile->minimumValue());
+  EXPECT_DOUBLE_EQ(23.0, profile->maximumValue());
+}
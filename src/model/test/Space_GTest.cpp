@@ -56,6 +56,7 @@
 #include <algorithm>
 #include <iostream>
 #include <iterator>
+#include <sstream>
 #include <string>
 #include <vector>
 
@@ -1576,6 +1577,127 @@ TEST_F(ModelFixture, Space_hardApplySpaceType_Plenum2) {
   ASSERT_NE(s1.spaceType().get().handle(), s2.spaceType().get().handle());
 }
 
+TEST_F(ModelFixture, Space_intersectSurfaces_BroadPhase) {
+  // the broad phase of intersectSurfaces and matchSurfaces should give the same results as testing every pair of spaces
+  auto makeSpaces = [](Model& model) {
+    std::vector<Space> spaces;
+    for (int i = 0; i < 4; ++i) {
+      // every other column is shifted by half a space, so that walls partially overlap
+      double yOffset = (i % 2) * 5.0;
+      for (int j = 0; j < 3; ++j) {
+        Point3dVector floorPrint{
+          {10.0 * i, 10.0 * j + yOffset + 10.0, 0.0},
+          {10.0 * i + 10.0, 10.0 * j + yOffset + 10.0, 0.0},
+          {10.0 * i + 10.0, 10.0 * j + yOffset, 0.0},
+          {10.0 * i, 10.0 * j + yOffset, 0.0},
+        };
+        spaces.push_back(Space::fromFloorPrint(floorPrint, 3.0 + i, model).get());
+      }
+    }
+    // far away from everything else
+    Point3dVector floorPrint{{1000, 10, 0}, {1010, 10, 0}, {1010, 0, 0}, {1000, 0, 0}};
+    spaces.push_back(Space::fromFloorPrint(floorPrint, 3.0, model).get());
+    return spaces;
+  };
+
+  auto describe = [](const std::vector<Space>& spaces) {
+    std::vector<std::string> result;
+    for (const Space& space : spaces) {
+      for (const Surface& surface : space.surfaces()) {
+        std::stringstream ss;
+        ss << space.nameString() << " " << surface.nameString() << " " << surface.vertices().size() << " " << surface.grossArea();
+        if (boost::optional<Surface> adjacentSurface = surface.adjacentSurface()) {
+          ss << " " << adjacentSurface->nameString();
+        }
+        result.push_back(ss.str());
+      }
+    }
+    std::sort(result.begin(), result.end());
+    return result;
+  };
+
+  Model model1;
+  std::vector<Space> spaces1 = makeSpaces(model1);
+  intersectSurfaces(spaces1);
+  matchSurfaces(spaces1);
+
+  Model model2;
+  std::vector<Space> spaces2 = makeSpaces(model2);
+  std::vector<Space> sorted2(spaces2);
+  std::sort(sorted2.begin(), sorted2.end(), [](const Space& a, const Space& b) -> bool { return a.floorArea() < b.floorArea(); });
+  for (unsigned i = 0; i < sorted2.size(); ++i) {
+    for (unsigned j = i + 1; j < sorted2.size(); ++j) {
+      sorted2[i].intersectSurfaces(sorted2[j]);
+    }
+  }
+  for (unsigned i = 0; i < spaces2.size(); ++i) {
+    for (unsigned j = i + 1; j < spaces2.size(); ++j) {
+      spaces2[i].matchSurfaces(spaces2[j]);
+    }
+  }
+
+  EXPECT_GT(model1.getConcreteModelObjects<Surface>().size(), 13u * 6u);
+  EXPECT_EQ(model2.getConcreteModelObjects<Surface>().size(), model1.getConcreteModelObjects<Surface>().size());
+  EXPECT_EQ(describe(spaces2), describe(spaces1));
+}
+
+TEST_F(ModelFixture, Space_intersectSurfacesParallel) {
+  // the parallel intersection should give the same geometry as intersectSurfaces, whatever the number of threads
+  auto makeSpaces = [](Model& model) {
+    std::vector<Space> spaces;
+    for (int i = 0; i < 4; ++i) {
+      double yOffset = (i % 2) * 5.0;
+      for (int j = 0; j < 4; ++j) {
+        Point3dVector floorPrint{
+          {10.0 * i, 10.0 * j + yOffset + 10.0, 0.0},
+          {10.0 * i + 10.0, 10.0 * j + yOffset + 10.0, 0.0},
+          {10.0 * i + 10.0, 10.0 * j + yOffset, 0.0},
+          {10.0 * i, 10.0 * j + yOffset, 0.0},
+        };
+        Space space = Space::fromFloorPrint(floorPrint, 3.0, model).get();
+        space.setName(fmt::format("Space {} {}", i, j));
+        spaces.push_back(space);
+      }
+    }
+    // a second story, offset so that floors and ceilings partially overlap
+    for (int i = 0; i < 2; ++i) {
+      Point3dVector floorPrint{{20.0 * i + 5.0, 30.0, 3.0}, {20.0 * i + 25.0, 30.0, 3.0}, {20.0 * i + 25.0, 5.0, 3.0}, {20.0 * i + 5.0, 5.0, 3.0}};
+      Space space = Space::fromFloorPrint(floorPrint, 3.0, model).get();
+      space.setName(fmt::format("Upper Space {}", i));
+      spaces.push_back(space);
+    }
+    return spaces;
+  };
+
+  auto describe = [](const Model& model) {
+    std::vector<std::string> result;
+    for (const Surface& surface : model.getConcreteModelObjects<Surface>()) {
+      std::stringstream ss;
+      ss << surface.space()->nameString() << " " << surface.surfaceType() << " " << surface.grossArea() << " " << surface.centroid();
+      if (boost::optional<Surface> adjacentSurface = surface.adjacentSurface()) {
+        ss << " " << adjacentSurface->space()->nameString();
+      }
+      result.push_back(ss.str());
+    }
+    std::sort(result.begin(), result.end());
+    return result;
+  };
+
+  Model model;
+  std::vector<Space> spaces = makeSpaces(model);
+  intersectSurfaces(spaces);
+  matchSurfaces(spaces);
+  EXPECT_GT(model.getConcreteModelObjects<Surface>().size(), 18u * 6u);
+
+  for (unsigned numThreads : {1u, 2u, 4u, 0u}) {
+    Model parallelModel;
+    std::vector<Space> parallelSpaces = makeSpaces(parallelModel);
+    intersectSurfacesParallel(parallelSpaces, numThreads);
+    matchSurfaces(parallelSpaces);
+    EXPECT_EQ(describe(model), describe(parallelModel)) << "numThreads = " << numThreads;
+  }
+}
+
 TEST_F(ModelFixture, Space_intersectSurfaces_degenerate1) {
   Model m;
   std::vector<Point3d> vertices;
@@ -27,12 +27,14 @@
 #include "../utilities/idf/ValidityReport.hpp"
 #include "../utilities/core/PathHelpers.hpp"
 #include "../utilities/core/Containers.hpp"
+#include "../utilities/core/StringHelpers.hpp"
 #include "../utilities/core/Compare.hpp"
 #include "../utilities/core/Assert.hpp"
 #include "../utilities/plot/ProgressBar.hpp"
 #include "../utilities/units/QuantityConverter.hpp"
 #include "../utilities/math/FloatCompare.hpp"
 #include "../utilities/idf/IdfObject_Impl.hpp"
+#include "../utilities/idf/IdfTokenizer.hpp"
 #include "../utilities/core/ASCIIStrings.hpp"
 #include "../utilities/core/UUID.hpp"
 #include "../utilities/data/DataEnums.hpp"
@@ -480,37 +482,29 @@ namespace osversion {
     auto start = m_map.find(startVersion);
     if (start != m_map.end()) {
 
-      std::string translatedIdf;
+      boost::optional<UpdateStream> translatedIdf;
       VersionString lastVersion("0.0.0");
-      boost::optional<IddFileAndFactoryWrapper> oIddFile;
       for (auto it = m_updateMethods.begin(), itEnd = m_updateMethods.end(); it != itEnd; ++it) {
         // make sure map iteration is behaving as expected
         OS_ASSERT(lastVersion < it->first);
         lastVersion = it->first;
         if (startVersion < it->first) {
-          oIddFile = getIddFile(it->first);
-          translatedIdf = it->second(this, start->second, *oIddFile);
+          translatedIdf = it->second(this, start->second, getIddFile(it->first));
           break;
         }
       }
 
-      if (translatedIdf.empty()) {
+      if (!translatedIdf) {
         LOG(Error, "Unable to complete translation from " << startVersion.str() << " to " << lastVersion.str()
                                                           << ". Unable to find and execute the appropriate update method.");
         return;
       }
-      std::stringstream ss(translatedIdf);
-      OptionalIdfFile oIdfFile;
-      if (oIddFile->iddFileType() == IddFileType::UserCustom) {
-        oIdfFile = IdfFile::load(ss, oIddFile->iddFile());
-      } else {
-        oIdfFile = IdfFile::load(ss, oIddFile->iddFileType());
-      }
+      OptionalIdfFile oIdfFile = translatedIdf->idfFile();
       if (!oIdfFile) {
         LOG(Error, "Unable to complete translation from " << startVersion.str() << " to " << lastVersion.str()
                                                           << ". Could not load translated IDF using the "
                                                           << "latter version's IddFile. Translated text: " << '\n'
-                                                          << translatedIdf);
+                                                          << translatedIdf->str());
         return;
       }
       IdfFile idfFile = *oIdfFile;
@@ -518,6 +512,10 @@ namespace osversion {
         updateComponentData(idfFile);
       }
       m_map[oIdfFile->version()] = idfFile;
+      // only the latest version is needed from here on
+      if (start->first != oIdfFile->version()) {
+        m_map.erase(start);
+      }
       LOG(Debug, "Translation to " << lastVersion.str() << " model has " << oIdfFile->numObjects() << " objects.");
     }
   }
@@ -563,9 +561,160 @@ namespace osversion {
     }
   }
 
-  std::string VersionTranslator::defaultUpdate(const IdfFile& idf, const IddFileAndFactoryWrapper& targetIdd) {
-    // use for version increments with no IDD changes
+  VersionTranslator::UpdateStream::UpdateStream(const IddFileAndFactoryWrapper& targetIdd)
+    : m_targetIdd(targetIdd), m_started(false), m_text(false) {}
+
+  VersionTranslator::UpdateStream& VersionTranslator::UpdateStream::operator<<(const std::string& text) {
+    if (!m_text && !m_started) {
+      m_header += text;
+      return *this;
+    }
+    switchToText();
+    m_ss << text;
+    return *this;
+  }
+
+  VersionTranslator::UpdateStream& VersionTranslator::UpdateStream::operator<<(const char* text) {
+    return *this << std::string(text);
+  }
+
+  VersionTranslator::UpdateStream& VersionTranslator::UpdateStream::operator<<(char c) {
+    return *this << std::string(1, c);
+  }
+
+  VersionTranslator::UpdateStream& VersionTranslator::UpdateStream::operator<<(const IdfObject& object) {
+    if (!m_started) {
+      m_started = true;
+      if (!loadHeader()) {
+        switchToText();
+      }
+    }
+    if (m_text || !addObject(object)) {
+      switchToText();
+      m_ss << object;
+    }
+    return *this;
+  }
+
+  VersionTranslator::UpdateStream::operator std::ostream&() {
+    m_started = true;
+    switchToText();
+    return m_ss;
+  }
+
+  boost::optional<IdfFile> VersionTranslator::UpdateStream::idfFile() {
+    bool userCustom = (m_targetIdd.iddFileType() == IddFileType::UserCustom);
+    if (m_text) {
+      if (userCustom) {
+        return IdfFile::load(m_ss, m_targetIdd.iddFile());
+      }
+      return IdfFile::load(m_ss, m_targetIdd.iddFileType());
+    }
+
+    // same result as IdfFile::load of the printed objects
+    IdfFile result = userCustom ? IdfFile(m_targetIdd.iddFile()) : IdfFile(m_targetIdd.iddFileType());
+    if (m_headerComment) {
+      result.setHeader(*m_headerComment);
+    }
+    if (std::none_of(m_objects.begin(), m_objects.end(), [](const IdfObject& object) { return object.iddObject().type() != IddObjectType::Catchall; })) {
+      LOG(Error, "Could not parse a single valid object in file.");
+      return boost::none;
+    }
+    if (std::any_of(m_objects.begin(), m_objects.end(), [](const IdfObject& object) { return object.iddObject().isVersionObject(); })) {
+      result.removeObject(result.versionObject().get());
+    }
+    result.addObjects(m_objects);
+    return result;
+  }
+
+  std::string VersionTranslator::UpdateStream::str() const {
+    if (m_text) {
+      return m_ss.str();
+    }
     std::stringstream ss;
+    ss << m_header;
+    for (const IdfObject& object : m_objects) {
+      ss << object;
+    }
+    return ss.str();
+  }
+
+  bool VersionTranslator::UpdateStream::loadHeader() {
+    // IdfFile::load takes a single comment block, followed by a blank line, as the header
+    if (!m_header.empty() && !m_header.ends_with("\n\n")) {
+      return false;
+    }
+    detail::IdfTokenizer tokenizer(m_header);
+    detail::IdfTokenizer::TokenType tokenType = tokenizer.next();
+    if (tokenType == detail::IdfTokenizer::TokenType::CommentBlock) {
+      m_headerComment = std::string(tokenizer.commentBlock());
+      tokenType = tokenizer.next();
+    }
+    return (tokenType == detail::IdfTokenizer::TokenType::End);
+  }
+
+  bool VersionTranslator::UpdateStream::addObject(const IdfObject& object) {
+    std::string objectType = object.iddObject().name();
+
+    if (object.iddObject().type() == IddObjectType::CommentOnly) {
+      // printed as a bare comment block, which IdfFile::load trims and wraps in a new comment only object
+      const std::string comment = object.comment();
+      if (comment.empty()) {
+        return true;
+      }
+      OptionalIddObject commentOnlyIddObject = m_targetIdd.getObject(IddObjectType::CommentOnly);
+      if (!commentOnlyIddObject) {
+        return false;
+      }
+      if ((comment.find_first_of("\r\f\v") != std::string::npos) || (comment.back() == '\n')) {
+        return false;
+      }
+      for (std::string_view line : splitString(comment, '\n')) {
+        std::size_t bang = line.find_first_not_of(" \t");
+        if ((bang == std::string_view::npos) || (line[bang] != '!')) {
+          return false;
+        }
+      }
+      OptionalIdfObject result = IdfObject::load(commentOnlyIddObject->name() + ";" + std::string(ascii_trim(comment)), *commentOnlyIddObject);
+      if (!result) {
+        return false;
+      }
+      m_objects.push_back(*result);
+      return true;
+    }
+
+    auto it = m_iddObjects.find(objectType);
+    if (it == m_iddObjects.end()) {
+      OptionalIddObject iddObject = m_targetIdd.getObject(objectType);
+      it = m_iddObjects.emplace(objectType, iddObject ? *iddObject : IddObject()).first;
+    }
+    if (it->second.type() == IddObjectType::Catchall) {
+      LOG(Warn, "Cannot find object type '" + objectType + "' in Idd. Placing data in Catchall object.");
+    }
+
+    OptionalIdfObject result = IdfObject::load(object, it->second);
+    if (!result) {
+      return false;
+    }
+    m_objects.push_back(*result);
+    return true;
+  }
+
+  void VersionTranslator::UpdateStream::switchToText() {
+    if (m_text) {
+      return;
+    }
+    m_text = true;
+    m_ss << m_header;
+    for (const IdfObject& object : m_objects) {
+      m_ss << object;
+    }
+    m_objects.clear();
+  }
+
+  VersionTranslator::UpdateStream VersionTranslator::defaultUpdate(const IdfFile& idf, const IddFileAndFactoryWrapper& targetIdd) {
+    // use for version increments with no IDD changes
+    UpdateStream ss(targetIdd);
 
     ss << idf.header() << '\n' << '\n';
 
@@ -578,12 +727,13 @@ namespace osversion {
       ss << object;
     }
 
-    return ss.str();
+    return ss;
   }
 
-  std::string VersionTranslator::update_0_7_1_to_0_7_2(const IdfFile& idf_0_7_1, const IddFileAndFactoryWrapper& idd_0_7_2) {
+  VersionTranslator::UpdateStream VersionTranslator::update_0_7_1_to_0_7_2(const IdfFile& idf_0_7_1,
+                                                                           const IddFileAndFactoryWrapper& idd_0_7_2) {
     // Url field refinements
-    std::stringstream ss;
+    UpdateStream ss(idd_0_7_2);
 
     ss << idf_0_7_1.header() << '\n' << '\n';
 
@@ -605,7 +755,7 @@ namespace osversion {
       ss << toPrint;
     }
 
-    return ss.str();
+    return ss;
   }
 
   IdfObject VersionTranslator::updateUrlField_0_7_1_to_0_7_2(const IdfObject& object, unsigned index) {
@@ -628,9 +778,10 @@ namespace osversion {
     return result;
   }
 
-  std::string VersionTranslator::update_0_7_2_to_0_7_3(const IdfFile& idf_0_7_2, const IddFileAndFactoryWrapper& idd_0_7_3) {
+  VersionTranslator::UpdateStream VersionTranslator::update_0_7_2_to_0_7_3(const IdfFile& idf_0_7_2,
+                                                                           const IddFileAndFactoryWrapper& idd_0_7_3) {
     // use for version increments with no IDD changes
-    std::stringstream ss;
+    UpdateStream ss(idd_0_7_3);
 
     ss << idf_0_7_2.header() << '\n' << '\n';
 
@@ -648,11 +799,12 @@ namespace osversion {
       ss << object;
     }
 
-    return ss.str();
+    return ss;
   }
 
-  std::string VersionTranslator::update_0_7_3_to_0_7_4(const IdfFile& idf_0_7_3, const IddFileAndFactoryWrapper& idd_0_7_4) {
-    std::stringstream ss;
+  VersionTranslator::UpdateStream VersionTranslator::update_0_7_3_to_0_7_4(const IdfFile& idf_0_7_3,
+                                                                           const IddFileAndFactoryWrapper& idd_0_7_4) {
+    UpdateStream ss(idd_0_7_4);
     IddObject componentDataIdd = idd_0_7_4.getObject("OS:ComponentData").get();
     IdfObject componentDataIdf(componentDataIdd);
     int fs = IdfObject::printedFieldSpace();
@@ -859,7 +1011,7 @@ namespace osversion {
       ss << objectSS.str();
     }
 
-    return ss.str();
+    return ss;
   }
 
   std::vector<std::shared_ptr<VersionTranslator::InterobjectIssueInformation>>
@@ -1234,9 +1386,10 @@ namespace osversion {
     }
   }
 
-  std::string VersionTranslator::update_0_9_1_to_0_9_2(const IdfFile& idf_0_9_1, const IddFileAndFactoryWrapper& idd_0_9_2) {
+  VersionTranslator::UpdateStream VersionTranslator::update_0_9_1_to_0_9_2(const IdfFile& idf_0_9_1,
+                                                                           const IddFileAndFactoryWrapper& idd_0_9_2) {
     // use for version increments with no IDD changes
-    std::stringstream ss;
+    UpdateStream ss(idd_0_9_2);
 
     ss << idf_0_9_1.header() << '\n' << '\n';
 
@@ -1419,10 +1572,11 @@ namespace osversion {
       }
     }
 
-    return ss.str();
+    return ss;
   }
 
-  std::string VersionTranslator::update_0_9_5_to_0_9_6(const IdfFile& idf_0_9_5, const IddFileAndFactoryWrapper& idd_0_9_6) {
+  VersionTranslator::UpdateStream VersionTranslator::update_0_9_5_to_0_9_6(const IdfFile& idf_0_9_5,
+                                                                           const IddFileAndFactoryWrapper& idd_0_9_6) {
     // if multiple OS:RunPeriod objects remove them all
     bool skipRunPeriods = false;
     unsigned numRunPeriods = 0;
@@ -1439,7 +1593,7 @@ namespace osversion {
     }
 
     // use for version increments with no IDD changes
-    std::stringstream ss;
+    UpdateStream ss(idd_0_9_6);
 
     ss << idf_0_9_5.header() << '\n' << '\n';
 
@@ -1490,11 +1644,12 @@ namespace osversion {
       }
     }
 
-    return ss.str();
+    return ss;
   }
 
-  std::string VersionTranslator::update_0_9_6_to_0_10_0(const IdfFile& idf_0_9_6, const IddFileAndFactoryWrapper& idd_0_10_0) {
-    std::stringstream ss;
+  VersionTranslator::UpdateStream VersionTranslator::update_0_9_6_to_0_10_0(const IdfFile& idf_0_9_6,
+                                                                            const IddFileAndFactoryWrapper& idd_0_10_0) {
+    UpdateStream ss(idd_0_10_0);
 
     ss << idf_0_9_6.header() << '\n' << '\n';
 
@@ -1521,12 +1676,13 @@ namespace osversion {
       }
     }
 
-    return ss.str();
+    return ss;
   }
 
-  std::string VersionTranslator::update_0_11_0_to_0_11_1(const IdfFile& idf_0_11_0, const IddFileAndFactoryWrapper& idd_0_11_1) {
+  VersionTranslator::UpdateStream VersionTranslator::update_0_11_0_to_0_11_1(const IdfFile& idf_0_11_0,
+                                                                             const IddFileAndFactoryWrapper& idd_0_11_1) {
     // use for version increments with no IDD changes
-    std::stringstream ss;
+    UpdateStream ss(idd_0_11_1);
 
     ss << idf_0_11_0.header() << '\n' << '\n';
 
@@ -1600,15 +1756,16 @@ namespace osversion {
       }
     }
 
-    return ss.str();
+    return ss;
   }
 
-  std::string VersionTranslator::update_0_11_1_to_0_11_2(const IdfFile& idf_0_11_1, const IddFileAndFactoryWrapper& idd_0_11_2) {
+  VersionTranslator::UpdateStream VersionTranslator::update_0_11_1_to_0_11_2(const IdfFile& idf_0_11_1,
+                                                                             const IddFileAndFactoryWrapper& idd_0_11_2) {
     // This version update has two things to do.
     // Make updates for new control related objects.
     // Make updates for component costs.
 
-    std::stringstream ss;
+    UpdateStream ss(idd_0_11_2);
 
     ss << idf_0_11_1.header() << '\n' << '\n';
 
@@ -1836,13 +1993,14 @@ namespace osversion {
       }
     }
 
-    return ss.str();
+    return ss;
   }
 
-  std::string VersionTranslator::update_0_11_4_to_0_11_5(const IdfFile& idf_0_11_4, const IddFileAndFactoryWrapper& idd_0_11_5) {
+  VersionTranslator::UpdateStream VersionTranslator::update_0_11_4_to_0_11_5(const IdfFile& idf_0_11_4,
+                                                                             const IddFileAndFactoryWrapper& idd_0_11_5) {
     // Make updates for component costs.
 
-    std::stringstream ss;
+    UpdateStream ss(idd_0_11_5);
 
     ss << idf_0_11_4.header() << '\n' << '\n';
 
@@ -1936,13 +2094,14 @@ namespace osversion {
       }
     }
 
-    return ss.str();
+    return ss;
   }
 
-  std::string VersionTranslator::update_0_11_5_to_0_11_6(const IdfFile& idf_0_11_5, const IddFileAndFactoryWrapper& idd_0_11_6) {
+  VersionTranslator::UpdateStream VersionTranslator::update_0_11_5_to_0_11_6(const IdfFile& idf_0_11_5,
+                                                                             const IddFileAndFactoryWrapper& idd_0_11_6) {
     // Update the OS:PortList object to point back to the OS:ThermalZone
 
-    std::stringstream ss;
+    UpdateStream ss(idd_0_11_6);
 
     ss << idf_0_11_5.header() << '\n' << '\n';
 
@@ -2010,11 +2169,12 @@ namespace osversion {
       }
     }
 
-    return ss.str();
+    return ss;
   }
 
-  std::string VersionTranslator::update_1_0_1_to_1_0_2(const IdfFile& idf_1_0_1, const IddFileAndFactoryWrapper& idd_1_0_2) {
-    std::stringstream ss;
+  VersionTranslator::UpdateStream VersionTranslator::update_1_0_1_to_1_0_2(const IdfFile& idf_1_0_1,
+                                                                           const IddFileAndFactoryWrapper& idd_1_0_2) {
+    UpdateStream ss(idd_1_0_2);
 
     ss << idf_1_0_1.header() << '\n' << '\n';
 
@@ -2063,11 +2223,12 @@ namespace osversion {
       }
     }
 
-    return ss.str();
+    return ss;
   }
 
-  std::string VersionTranslator::update_1_0_2_to_1_0_3(const IdfFile& idf_1_0_2, const IddFileAndFactoryWrapper& idd_1_0_3) {
-    std::stringstream ss;
+  VersionTranslator::UpdateStream VersionTranslator::update_1_0_2_to_1_0_3(const IdfFile& idf_1_0_2,
+                                                                           const IddFileAndFactoryWrapper& idd_1_0_3) {
+    UpdateStream ss(idd_1_0_3);
 
     ss << idf_1_0_2.header() << '\n' << '\n';
 
@@ -2099,11 +2260,12 @@ namespace osversion {
       }
     }
 
-    return ss.str();
+    return ss;
   }
 
-  std::string VersionTranslator::update_1_2_2_to_1_2_3(const IdfFile& idf_1_2_2, const IddFileAndFactoryWrapper& idd_1_2_3) {
-    std::stringstream ss;
+  VersionTranslator::UpdateStream VersionTranslator::update_1_2_2_to_1_2_3(const IdfFile& idf_1_2_2,
+                                                                           const IddFileAndFactoryWrapper& idd_1_2_3) {
+    UpdateStream ss(idd_1_2_3);
 
     ss << idf_1_2_2.header() << '\n' << '\n';
 
@@ -2239,11 +2401,12 @@ namespace osversion {
       m_refactored.emplace_back(std::move(*buildingObject), std::move(newBuildingObject));
     }
 
-    return ss.str();
+    return ss;
   }
 
-  std::string VersionTranslator::update_1_3_4_to_1_3_5(const IdfFile& idf_1_3_4, const IddFileAndFactoryWrapper& idd_1_3_5) {
-    std::stringstream ss;
+  VersionTranslator::UpdateStream VersionTranslator::update_1_3_4_to_1_3_5(const IdfFile& idf_1_3_4,
+                                                                           const IddFileAndFactoryWrapper& idd_1_3_5) {
+    UpdateStream ss(idd_1_3_5);
 
     ss << idf_1_3_4.header() << '\n' << '\n';
 
@@ -2274,11 +2437,12 @@ namespace osversion {
       }
     }
 
-    return ss.str();
+    return ss;
   }
 
-  std::string VersionTranslator::update_1_5_3_to_1_5_4(const IdfFile& idf_1_5_3, const IddFileAndFactoryWrapper& idd_1_5_4) {
-    std::stringstream ss;
+  VersionTranslator::UpdateStream VersionTranslator::update_1_5_3_to_1_5_4(const IdfFile& idf_1_5_3,
+                                                                           const IddFileAndFactoryWrapper& idd_1_5_4) {
+    UpdateStream ss(idd_1_5_4);
 
     ss << idf_1_5_3.header() << '\n' << '\n';
 
@@ -2295,11 +2459,12 @@ namespace osversion {
       }
     }
 
-    return ss.str();
+    return ss;
   }
 
-  std::string VersionTranslator::update_1_7_1_to_1_7_2(const IdfFile& idf_1_7_1, const IddFileAndFactoryWrapper& idd_1_7_2) {
-    std::stringstream ss;
+  VersionTranslator::UpdateStream VersionTranslator::update_1_7_1_to_1_7_2(const IdfFile& idf_1_7_1,
+                                                                           const IddFileAndFactoryWrapper& idd_1_7_2) {
+    UpdateStream ss(idd_1_7_2);
 
     ss << idf_1_7_1.header() << '\n' << '\n';
 
@@ -2352,11 +2517,12 @@ namespace osversion {
       }
     }
 
-    return ss.str();
+    return ss;
   }
 
-  std::string VersionTranslator::update_1_7_4_to_1_7_5(const IdfFile& idf_1_7_4, const IddFileAndFactoryWrapper& idd_1_7_5) {
-    std::stringstream ss;
+  VersionTranslator::UpdateStream VersionTranslator::update_1_7_4_to_1_7_5(const IdfFile& idf_1_7_4,
+                                                                           const IddFileAndFactoryWrapper& idd_1_7_5) {
+    UpdateStream ss(idd_1_7_5);
 
     ss << idf_1_7_4.header() << '\n' << '\n';
 
@@ -2445,11 +2611,12 @@ namespace osversion {
       }
     }
 
-    return ss.str();
+    return ss;
   }
 
-  std::string VersionTranslator::update_1_8_3_to_1_8_4(const IdfFile& idf_1_8_3, const IddFileAndFactoryWrapper& idd_1_8_4) {
-    std::stringstream ss;
+  VersionTranslator::UpdateStream VersionTranslator::update_1_8_3_to_1_8_4(const IdfFile& idf_1_8_3,
+                                                                           const IddFileAndFactoryWrapper& idd_1_8_4) {
+    UpdateStream ss(idd_1_8_4);
 
     ss << idf_1_8_3.header() << '\n' << '\n';
 
@@ -2556,11 +2723,12 @@ namespace osversion {
       }
     }
 
-    return ss.str();
+    return ss;
   }
 
-  std::string VersionTranslator::update_1_8_4_to_1_8_5(const IdfFile& idf_1_8_4, const IddFileAndFactoryWrapper& idd_1_8_5) {
-    std::stringstream ss;
+  VersionTranslator::UpdateStream VersionTranslator::update_1_8_4_to_1_8_5(const IdfFile& idf_1_8_4,
+                                                                           const IddFileAndFactoryWrapper& idd_1_8_5) {
+    UpdateStream ss(idd_1_8_5);
 
     ss << idf_1_8_4.header() << '\n' << '\n';
 
@@ -2609,11 +2777,12 @@ namespace osversion {
       }
     }
 
-    return ss.str();
+    return ss;
   }
 
-  std::string VersionTranslator::update_1_8_5_to_1_9_0(const IdfFile& idf_1_8_5, const IddFileAndFactoryWrapper& idd_1_9_0) {
-    std::stringstream ss;
+  VersionTranslator::UpdateStream VersionTranslator::update_1_8_5_to_1_9_0(const IdfFile& idf_1_8_5,
+                                                                           const IddFileAndFactoryWrapper& idd_1_9_0) {
+    UpdateStream ss(idd_1_9_0);
 
     ss << idf_1_8_5.header() << '\n' << '\n';
 
@@ -2644,11 +2813,12 @@ namespace osversion {
       }
     }
 
-    return ss.str();
+    return ss;
   }
 
-  std::string VersionTranslator::update_1_9_2_to_1_9_3(const IdfFile& idf_1_9_2, const IddFileAndFactoryWrapper& idd_1_9_3) {
-    std::stringstream ss;
+  VersionTranslator::UpdateStream VersionTranslator::update_1_9_2_to_1_9_3(const IdfFile& idf_1_9_2,
+                                                                           const IddFileAndFactoryWrapper& idd_1_9_3) {
+    UpdateStream ss(idd_1_9_3);
 
     ss << idf_1_9_2.header() << '\n' << '\n';
 
@@ -2740,11 +2910,12 @@ namespace osversion {
       }
     }
 
-    return ss.str();
+    return ss;
   }
 
-  std::string VersionTranslator::update_1_9_4_to_1_9_5(const IdfFile& idf_1_9_4, const IddFileAndFactoryWrapper& idd_1_9_5) {
-    std::stringstream ss;
+  VersionTranslator::UpdateStream VersionTranslator::update_1_9_4_to_1_9_5(const IdfFile& idf_1_9_4,
+                                                                           const IddFileAndFactoryWrapper& idd_1_9_5) {
+    UpdateStream ss(idd_1_9_5);
 
     ss << idf_1_9_4.header() << '\n' << '\n';
 
@@ -2809,11 +2980,12 @@ namespace osversion {
       }
     }
 
-    return ss.str();
+    return ss;
   }
 
-  std::string VersionTranslator::update_1_9_5_to_1_10_0(const IdfFile& idf_1_9_5, const IddFileAndFactoryWrapper& idd_1_10_0) {
-    std::stringstream ss;
+  VersionTranslator::UpdateStream VersionTranslator::update_1_9_5_to_1_10_0(const IdfFile& idf_1_9_5,
+                                                                            const IddFileAndFactoryWrapper& idd_1_10_0) {
+    UpdateStream ss(idd_1_10_0);
 
     ss << idf_1_9_5.header() << '\n' << '\n';
 
@@ -2874,12 +3046,13 @@ namespace osversion {
       }
     }
 
-    return ss.str();
+    return ss;
   }
 
-  std::string VersionTranslator::update_1_10_1_to_1_10_2(const IdfFile& idf_1_10_1, const IddFileAndFactoryWrapper& idd_1_10_2) {
+  VersionTranslator::UpdateStream VersionTranslator::update_1_10_1_to_1_10_2(const IdfFile& idf_1_10_1,
+                                                                             const IddFileAndFactoryWrapper& idd_1_10_2) {
 
-    std::stringstream ss;
+    UpdateStream ss(idd_1_10_2);
 
     ss << idf_1_10_1.header() << '\n' << '\n';
 
@@ -2978,11 +3151,12 @@ namespace osversion {
       ss << newObject;
     }
 
-    return ss.str();
+    return ss;
   }
 
-  std::string VersionTranslator::update_1_10_5_to_1_10_6(const IdfFile& idf_1_10_5, const IddFileAndFactoryWrapper& idd_1_10_6) {
-    std::stringstream ss;
+  VersionTranslator::UpdateStream VersionTranslator::update_1_10_5_to_1_10_6(const IdfFile& idf_1_10_5,
+                                                                             const IddFileAndFactoryWrapper& idd_1_10_6) {
+    UpdateStream ss(idd_1_10_6);
 
     ss << idf_1_10_5.header() << '\n' << '\n';
 
@@ -3021,11 +3195,12 @@ namespace osversion {
       }
     }
 
-    return ss.str();
+    return ss;
   }
 
-  std::string VersionTranslator::update_1_11_3_to_1_11_4(const IdfFile& idf_1_11_3, const IddFileAndFactoryWrapper& idd_1_11_4) {
-    std::stringstream ss;
+  VersionTranslator::UpdateStream VersionTranslator::update_1_11_3_to_1_11_4(const IdfFile& idf_1_11_3,
+                                                                             const IddFileAndFactoryWrapper& idd_1_11_4) {
+    UpdateStream ss(idd_1_11_4);
 
     ss << idf_1_11_3.header() << '\n' << '\n';
 
@@ -3063,11 +3238,12 @@ namespace osversion {
       }
     }
 
-    return ss.str();
+    return ss;
   }
 
-  std::string VersionTranslator::update_1_11_4_to_1_11_5(const IdfFile& idf_1_11_4, const IddFileAndFactoryWrapper& idd_1_11_5) {
-    std::stringstream ss;
+  VersionTranslator::UpdateStream VersionTranslator::update_1_11_4_to_1_11_5(const IdfFile& idf_1_11_4,
+                                                                             const IddFileAndFactoryWrapper& idd_1_11_5) {
+    UpdateStream ss(idd_1_11_5);
 
     ss << idf_1_11_4.header() << '\n' << '\n';
 
@@ -3106,11 +3282,12 @@ namespace osversion {
       }
     }
 
-    return ss.str();
+    return ss;
   }
 
-  std::string VersionTranslator::update_1_12_0_to_1_12_1(const IdfFile& idf_1_12_0, const IddFileAndFactoryWrapper& idd_1_12_1) {
-    std::stringstream ss;
+  VersionTranslator::UpdateStream VersionTranslator::update_1_12_0_to_1_12_1(const IdfFile& idf_1_12_0,
+                                                                             const IddFileAndFactoryWrapper& idd_1_12_1) {
+    UpdateStream ss(idd_1_12_1);
 
     ss << idf_1_12_0.header() << '\n' << '\n';
 
@@ -3140,11 +3317,12 @@ namespace osversion {
       }
     }
 
-    return ss.str();
+    return ss;
   }
 
-  std::string VersionTranslator::update_1_12_3_to_1_12_4(const IdfFile& idf_1_12_3, const IddFileAndFactoryWrapper& idd_1_12_4) {
-    std::stringstream ss;
+  VersionTranslator::UpdateStream VersionTranslator::update_1_12_3_to_1_12_4(const IdfFile& idf_1_12_3,
+                                                                             const IddFileAndFactoryWrapper& idd_1_12_4) {
+    UpdateStream ss(idd_1_12_4);
 
     ss << idf_1_12_3.header() << '\n' << '\n';
     IdfFile targetIdf(idd_1_12_4.iddFile());
@@ -3178,11 +3356,12 @@ namespace osversion {
       }
     }
 
-    return ss.str();
+    return ss;
   }
 
-  std::string VersionTranslator::update_2_1_0_to_2_1_1(const IdfFile& idf_2_1_0, const IddFileAndFactoryWrapper& idd_2_1_1) {
-    std::stringstream ss;
+  VersionTranslator::UpdateStream VersionTranslator::update_2_1_0_to_2_1_1(const IdfFile& idf_2_1_0,
+                                                                           const IddFileAndFactoryWrapper& idd_2_1_1) {
+    UpdateStream ss(idd_2_1_1);
 
     ss << idf_2_1_0.header() << '\n' << '\n';
     IdfFile targetIdf(idd_2_1_1.iddFile());
@@ -3244,11 +3423,12 @@ namespace osversion {
       }
     }
 
-    return ss.str();
+    return ss;
   }
 
-  std::string VersionTranslator::update_2_1_1_to_2_1_2(const IdfFile& idf_2_1_1, const IddFileAndFactoryWrapper& idd_2_1_2) {
-    std::stringstream ss;
+  VersionTranslator::UpdateStream VersionTranslator::update_2_1_1_to_2_1_2(const IdfFile& idf_2_1_1,
+                                                                           const IddFileAndFactoryWrapper& idd_2_1_2) {
+    UpdateStream ss(idd_2_1_2);
 
     ss << idf_2_1_1.header() << '\n' << '\n';
     IdfFile targetIdf(idd_2_1_2.iddFile());
@@ -3297,11 +3477,12 @@ namespace osversion {
       }
     }
 
-    return ss.str();
+    return ss;
   }
 
-  std::string VersionTranslator::update_2_3_0_to_2_3_1(const IdfFile& idf_2_3_0, const IddFileAndFactoryWrapper& idd_2_3_1) {
-    std::stringstream ss;
+  VersionTranslator::UpdateStream VersionTranslator::update_2_3_0_to_2_3_1(const IdfFile& idf_2_3_0,
+                                                                           const IddFileAndFactoryWrapper& idd_2_3_1) {
+    UpdateStream ss(idd_2_3_1);
 
     ss << idf_2_3_0.header() << '\n' << '\n';
     IdfFile targetIdf(idd_2_3_1.iddFile());
@@ -3582,11 +3763,12 @@ namespace osversion {
       }
     }
 
-    return ss.str();
+    return ss;
   }
 
-  std::string VersionTranslator::update_2_4_1_to_2_4_2(const IdfFile& idf_2_4_1, const IddFileAndFactoryWrapper& idd_2_4_2) {
-    std::stringstream ss;
+  VersionTranslator::UpdateStream VersionTranslator::update_2_4_1_to_2_4_2(const IdfFile& idf_2_4_1,
+                                                                           const IddFileAndFactoryWrapper& idd_2_4_2) {
+    UpdateStream ss(idd_2_4_2);
 
     ss << idf_2_4_1.header() << '\n' << '\n';
     IdfFile targetIdf(idd_2_4_2.iddFile());
@@ -3704,11 +3886,12 @@ namespace osversion {
       }
     }
 
-    return ss.str();
+    return ss;
   }
 
-  std::string VersionTranslator::update_2_4_3_to_2_5_0(const IdfFile& idf_2_4_3, const IddFileAndFactoryWrapper& idd_2_5_0) {
-    std::stringstream ss;
+  VersionTranslator::UpdateStream VersionTranslator::update_2_4_3_to_2_5_0(const IdfFile& idf_2_4_3,
+                                                                           const IddFileAndFactoryWrapper& idd_2_5_0) {
+    UpdateStream ss(idd_2_5_0);
 
     ss << idf_2_4_3.header() << '\n' << '\n';
     IdfFile targetIdf(idd_2_5_0.iddFile());
@@ -3761,11 +3944,12 @@ namespace osversion {
       }
     }
 
-    return ss.str();
+    return ss;
   }
 
-  std::string VersionTranslator::update_2_6_0_to_2_6_1(const IdfFile& idf_2_6_0, const IddFileAndFactoryWrapper& idd_2_6_1) {
-    std::stringstream ss;
+  VersionTranslator::UpdateStream VersionTranslator::update_2_6_0_to_2_6_1(const IdfFile& idf_2_6_0,
+                                                                           const IddFileAndFactoryWrapper& idd_2_6_1) {
+    UpdateStream ss(idd_2_6_1);
     boost::optional<std::string> value;
 
     ss << idf_2_6_0.header() << '\n' << '\n';
@@ -3852,11 +4036,12 @@ namespace osversion {
       }
     }
 
-    return ss.str();
+    return ss;
   }
 
-  std::string VersionTranslator::update_2_6_1_to_2_6_2(const IdfFile& idf_2_6_1, const IddFileAndFactoryWrapper& idd_2_6_2) {
-    std::stringstream ss;
+  VersionTranslator::UpdateStream VersionTranslator::update_2_6_1_to_2_6_2(const IdfFile& idf_2_6_1,
+                                                                           const IddFileAndFactoryWrapper& idd_2_6_2) {
+    UpdateStream ss(idd_2_6_2);
 
     ss << idf_2_6_1.header() << '\n' << '\n';
     IdfFile targetIdf(idd_2_6_2.iddFile());
@@ -3921,11 +4106,12 @@ namespace osversion {
       }
     }
 
-    return ss.str();
+    return ss;
   }
 
-  std::string VersionTranslator::update_2_6_2_to_2_7_0(const IdfFile& idf_2_6_2, const IddFileAndFactoryWrapper& idd_2_7_0) {
-    std::stringstream ss;
+  VersionTranslator::UpdateStream VersionTranslator::update_2_6_2_to_2_7_0(const IdfFile& idf_2_6_2,
+                                                                           const IddFileAndFactoryWrapper& idd_2_7_0) {
+    UpdateStream ss(idd_2_7_0);
 
     ss << idf_2_6_2.header() << '\n' << '\n';
     IdfFile targetIdf(idd_2_7_0.iddFile());
@@ -4111,11 +4297,12 @@ namespace osversion {
       }
     }
 
-    return ss.str();
+    return ss;
   }
 
-  std::string VersionTranslator::update_2_7_0_to_2_7_1(const IdfFile& idf_2_7_0, const IddFileAndFactoryWrapper& idd_2_7_1) {
-    std::stringstream ss;
+  VersionTranslator::UpdateStream VersionTranslator::update_2_7_0_to_2_7_1(const IdfFile& idf_2_7_0,
+                                                                           const IddFileAndFactoryWrapper& idd_2_7_1) {
+    UpdateStream ss(idd_2_7_1);
     boost::optional<std::string> value;
 
     ss << idf_2_7_0.header() << '\n' << '\n';
@@ -4150,11 +4337,12 @@ namespace osversion {
       }
     }
 
-    return ss.str();
+    return ss;
   }
 
-  std::string VersionTranslator::update_2_7_1_to_2_7_2(const IdfFile& idf_2_7_1, const IddFileAndFactoryWrapper& idd_2_7_2) {
-    std::stringstream ss;
+  VersionTranslator::UpdateStream VersionTranslator::update_2_7_1_to_2_7_2(const IdfFile& idf_2_7_1,
+                                                                           const IddFileAndFactoryWrapper& idd_2_7_2) {
+    UpdateStream ss(idd_2_7_2);
     boost::optional<std::string> value;
 
     ss << idf_2_7_1.header() << '\n' << '\n';
@@ -4222,11 +4410,12 @@ namespace osversion {
       }
     }
 
-    return ss.str();
+    return ss;
   }
 
-  std::string VersionTranslator::update_2_8_1_to_2_9_0(const IdfFile& idf_2_8_1, const IddFileAndFactoryWrapper& idd_2_9_0) {
-    std::stringstream ss;
+  VersionTranslator::UpdateStream VersionTranslator::update_2_8_1_to_2_9_0(const IdfFile& idf_2_8_1,
+                                                                           const IddFileAndFactoryWrapper& idd_2_9_0) {
+    UpdateStream ss(idd_2_9_0);
     boost::optional<std::string> value;
 
     ss << idf_2_8_1.header() << '\n' << '\n';
@@ -4482,11 +4671,12 @@ namespace osversion {
       }
     }
 
-    return ss.str();
+    return ss;
   }
 
-  std::string VersionTranslator::update_2_9_0_to_2_9_1(const IdfFile& idf_2_9_0, const IddFileAndFactoryWrapper& idd_2_9_1) {
-    std::stringstream ss;
+  VersionTranslator::UpdateStream VersionTranslator::update_2_9_0_to_2_9_1(const IdfFile& idf_2_9_0,
+                                                                           const IddFileAndFactoryWrapper& idd_2_9_1) {
+    UpdateStream ss(idd_2_9_1);
     boost::optional<std::string> value;
 
     ss << idf_2_9_0.header() << '\n' << '\n';
@@ -4562,11 +4752,12 @@ namespace osversion {
       }
     }
 
-    return ss.str();
+    return ss;
   }
 
-  std::string VersionTranslator::update_2_9_1_to_3_0_0(const IdfFile& idf_2_9_1, const IddFileAndFactoryWrapper& idd_3_0_0) {
-    std::stringstream ss;
+  VersionTranslator::UpdateStream VersionTranslator::update_2_9_1_to_3_0_0(const IdfFile& idf_2_9_1,
+                                                                           const IddFileAndFactoryWrapper& idd_3_0_0) {
+    UpdateStream ss(idd_3_0_0);
     boost::optional<std::string> value;
 
     ss << idf_2_9_1.header() << '\n' << '\n';
@@ -4941,11 +5132,12 @@ namespace osversion {
       }
     }
 
-    return ss.str();
+    return ss;
   }
 
-  std::string VersionTranslator::update_3_0_0_to_3_0_1(const IdfFile& idf_3_0_0, const IddFileAndFactoryWrapper& idd_3_0_1) {
-    std::stringstream ss;
+  VersionTranslator::UpdateStream VersionTranslator::update_3_0_0_to_3_0_1(const IdfFile& idf_3_0_0,
+                                                                           const IddFileAndFactoryWrapper& idd_3_0_1) {
+    UpdateStream ss(idd_3_0_1);
     boost::optional<std::string> value;
 
     ss << idf_3_0_0.header() << '\n' << '\n';
@@ -5083,12 +5275,13 @@ namespace osversion {
       }
     }
 
-    return ss.str();
+    return ss;
 
   }  // end update_3_0_0_to_3_0_1
 
-  std::string VersionTranslator::update_3_0_1_to_3_1_0(const IdfFile& idf_3_0_1, const IddFileAndFactoryWrapper& idd_3_1_0) {
-    std::stringstream ss;
+  VersionTranslator::UpdateStream VersionTranslator::update_3_0_1_to_3_1_0(const IdfFile& idf_3_0_1,
+                                                                           const IddFileAndFactoryWrapper& idd_3_1_0) {
+    UpdateStream ss(idd_3_1_0);
     boost::optional<std::string> value;
 
     ss << idf_3_0_1.header() << '\n' << '\n';
@@ -6105,12 +6298,13 @@ namespace osversion {
       }
     }
 
-    return ss.str();
+    return ss;
 
   }  // end update_3_0_1_to_3_1_0
 
-  std::string VersionTranslator::update_3_1_0_to_3_2_0(const IdfFile& idf_3_1_0, const IddFileAndFactoryWrapper& idd_3_2_0) {
-    std::stringstream ss;
+  VersionTranslator::UpdateStream VersionTranslator::update_3_1_0_to_3_2_0(const IdfFile& idf_3_1_0,
+                                                                           const IddFileAndFactoryWrapper& idd_3_2_0) {
+    UpdateStream ss(idd_3_2_0);
     boost::optional<std::string> value;
 
     ss << idf_3_1_0.header() << '\n' << '\n';
@@ -6541,12 +6735,13 @@ namespace osversion {
       }
     }
 
-    return ss.str();
+    return ss;
 
   }  // end update_3_1_0_to_3_2_0
 
-  std::string VersionTranslator::update_3_2_0_to_3_2_1(const IdfFile& idf_3_2_0, const IddFileAndFactoryWrapper& idd_3_2_1) {
-    std::stringstream ss;
+  VersionTranslator::UpdateStream VersionTranslator::update_3_2_0_to_3_2_1(const IdfFile& idf_3_2_0,
+                                                                           const IddFileAndFactoryWrapper& idd_3_2_1) {
+    UpdateStream ss(idd_3_2_1);
     boost::optional<std::string> value;
 
     ss << idf_3_2_0.header() << '\n' << '\n';
@@ -6586,12 +6781,13 @@ namespace osversion {
       }
     }
 
-    return ss.str();
+    return ss;
 
   }  // end update_3_2_0_to_3_2_1
 
-  std::string VersionTranslator::update_3_2_1_to_3_3_0(const IdfFile& idf_3_2_1, const IddFileAndFactoryWrapper& idd_3_3_0) {
-    std::stringstream ss;
+  VersionTranslator::UpdateStream VersionTranslator::update_3_2_1_to_3_3_0(const IdfFile& idf_3_2_1,
+                                                                           const IddFileAndFactoryWrapper& idd_3_3_0) {
+    UpdateStream ss(idd_3_3_0);
     boost::optional<std::string> value;
 
     ss << idf_3_2_1.header() << '\n' << '\n';
@@ -6732,12 +6928,13 @@ namespace osversion {
       }
     }
 
-    return ss.str();
+    return ss;
 
   }  // end update_3_2_1_to_3_3_0
 
-  std::string VersionTranslator::update_3_3_0_to_3_4_0(const IdfFile& idf_3_3_0, const IddFileAndFactoryWrapper& idd_3_4_0) {
-    std::stringstream ss;
+  VersionTranslator::UpdateStream VersionTranslator::update_3_3_0_to_3_4_0(const IdfFile& idf_3_3_0,
+                                                                           const IddFileAndFactoryWrapper& idd_3_4_0) {
+    UpdateStream ss(idd_3_4_0);
     boost::optional<std::string> value;
 
     ss << idf_3_3_0.header() << '\n' << '\n';
@@ -6816,12 +7013,13 @@ namespace osversion {
       }
     }
 
-    return ss.str();
+    return ss;
 
   }  // end update_3_3_0_to_3_4_0
 
-  std::string VersionTranslator::update_3_4_0_to_3_5_0(const IdfFile& idf_3_4_0, const IddFileAndFactoryWrapper& idd_3_5_0) {
-    std::stringstream ss;
+  VersionTranslator::UpdateStream VersionTranslator::update_3_4_0_to_3_5_0(const IdfFile& idf_3_4_0,
+                                                                           const IddFileAndFactoryWrapper& idd_3_5_0) {
+    UpdateStream ss(idd_3_5_0);
     boost::optional<std::string> value;
 
     ss << idf_3_4_0.header() << '\n' << '\n';
@@ -7512,12 +7710,13 @@ namespace osversion {
       }
     }
 
-    return ss.str();
+    return ss;
 
   }  // end update_3_4_0_to_3_5_0
 
-  std::string VersionTranslator::update_3_5_0_to_3_5_1(const IdfFile& idf_3_5_0, const IddFileAndFactoryWrapper& idd_3_5_1) {
-    std::stringstream ss;
+  VersionTranslator::UpdateStream VersionTranslator::update_3_5_0_to_3_5_1(const IdfFile& idf_3_5_0,
+                                                                           const IddFileAndFactoryWrapper& idd_3_5_1) {
+    UpdateStream ss(idd_3_5_1);
     boost::optional<std::string> value;
 
     ss << idf_3_5_0.header() << '\n' << '\n';
@@ -7556,12 +7755,13 @@ namespace osversion {
       }
     }
 
-    return ss.str();
+    return ss;
 
   }  // end update_3_5_0_to_3_5_1
 
-  std::string VersionTranslator::update_3_5_1_to_3_6_0(const IdfFile& idf_3_5_1, const IddFileAndFactoryWrapper& idd_3_6_0) {
-    std::stringstream ss;
+  VersionTranslator::UpdateStream VersionTranslator::update_3_5_1_to_3_6_0(const IdfFile& idf_3_5_1,
+                                                                           const IddFileAndFactoryWrapper& idd_3_6_0) {
+    UpdateStream ss(idd_3_6_0);
     boost::optional<std::string> value;
 
     ss << idf_3_5_1.header() << '\n' << '\n';
@@ -7612,7 +7812,7 @@ namespace osversion {
       }
     }
 
-    return ss.str();
+    return ss;
 
   }  // end update_3_5_1_to_3_6_0
 
@@ -7877,8 +8077,9 @@ namespace osversion {
     return result;
   }
 
-  std::string VersionTranslator::update_3_6_1_to_3_7_0(const IdfFile& idf_3_6_1, const IddFileAndFactoryWrapper& idd_3_7_0) {
-    std::stringstream ss;
+  VersionTranslator::UpdateStream VersionTranslator::update_3_6_1_to_3_7_0(const IdfFile& idf_3_6_1,
+                                                                           const IddFileAndFactoryWrapper& idd_3_7_0) {
+    UpdateStream ss(idd_3_7_0);
     boost::optional<std::string> value;
 
     ss << idf_3_6_1.header() << '\n' << '\n';
@@ -8948,12 +9149,13 @@ namespace osversion {
       }
     }
 
-    return ss.str();
+    return ss;
 
   }  // end update_3_6_1_to_3_7_0
 
-  std::string VersionTranslator::update_3_7_0_to_3_8_0(const IdfFile& idf_3_7_0, const IddFileAndFactoryWrapper& idd_3_8_0) {
-    std::stringstream ss;
+  VersionTranslator::UpdateStream VersionTranslator::update_3_7_0_to_3_8_0(const IdfFile& idf_3_7_0,
+                                                                           const IddFileAndFactoryWrapper& idd_3_8_0) {
+    UpdateStream ss(idd_3_8_0);
     boost::optional<std::string> value;
 
     ss << idf_3_7_0.header() << '\n' << '\n';
@@ -9192,7 +9394,7 @@ namespace osversion {
       }
     }
 
-    return ss.str();
+    return ss;
 
   }  // end update_3_7_0_to_3_8_0
 
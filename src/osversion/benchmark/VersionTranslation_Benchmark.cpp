@@ -7,12 +7,17 @@
 
 #include "../VersionTranslator.hpp"
 #include "../../model/Model.hpp"
+#include "../../utilities/idf/IdfFile.hpp"
 #include "../../utilities/core/Filesystem.hpp"
 
+#include <utilities/idd/IddEnums.hxx>
+
 #include <resources.hxx>
 
 #include <OpenStudio.hxx>
 
+#include <sstream>
+
 using namespace openstudio;
 
 static void BM_VT(benchmark::State& state, const std::string& testCase) {
@@ -25,6 +30,37 @@ static void BM_VT(benchmark::State& state, const std::string& testCase) {
   }
 }
 
+// One version step with no IDD changes, through text as the update methods used to do
+static void BM_VT_Step_Text(benchmark::State& state, const std::string& testCase) {
+
+  OptionalIdfFile idfFile = IdfFile::load(resourcesPath() / toPath(testCase), IddFileType::OpenStudio);
+
+  for (auto _ : state) {
+    std::stringstream ss;
+    ss << idfFile->header() << '\n' << '\n';
+    for (const IdfObject& object : idfFile->objects()) {
+      ss << object;
+    }
+    OptionalIdfFile result = IdfFile::load(ss, IddFileType::OpenStudio);
+    benchmark::DoNotOptimize(result);
+  }
+}
+
+// The same step, carrying the objects over in memory
+static void BM_VT_Step_InMemory(benchmark::State& state, const std::string& testCase) {
+
+  OptionalIdfFile idfFile = IdfFile::load(resourcesPath() / toPath(testCase), IddFileType::OpenStudio);
+
+  for (auto _ : state) {
+    IdfFile result(IddFileType::OpenStudio);
+    result.setHeader(idfFile->header());
+    for (const IdfObject& object : idfFile->objects()) {
+      result.addObject(IdfObject::load(object, object.iddObject()).get());
+    }
+    benchmark::DoNotOptimize(result);
+  }
+}
+
 BENCHMARK_CAPTURE(BM_VT, example_1_13_4, std::string("osversion/1_13_4/example.osm"))->Unit(benchmark::kMillisecond);
 BENCHMARK_CAPTURE(BM_VT, example_1_14_0, std::string("osversion/1_14_0/example.osm"))->Unit(benchmark::kMillisecond);
 BENCHMARK_CAPTURE(BM_VT, Windows_Complete, std::string("model/7-7_Windows_Complete.osm"))->Unit(benchmark::kMillisecond);
@@ -32,3 +68,8 @@ BENCHMARK_CAPTURE(BM_VT, Model12, std::string("model/15023_Model12.osm"))->Unit(
 BENCHMARK_CAPTURE(BM_VT, floorplan_school, std::string("model/floorplan_school.osm"))->Unit(benchmark::kMillisecond);
 BENCHMARK_CAPTURE(BM_VT, CONTAMTemplate, std::string("contam/CONTAMTemplate.osm"))->Unit(benchmark::kMillisecond);
 BENCHMARK_CAPTURE(BM_VT, seb, std::string("Examples/compact_osw/files/seb.osm"))->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_VT, RefBldgLargeHotel_3_0_0, std::string("model/RefBldgLargeHotelNew2004_Chicago.osm"))->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_VT, ParkUnder_Retail_Office_3_3_0, std::string("model/ParkUnder_Retail_Office_C2.osm"))->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(BM_VT_Step_Text, Model12, std::string("model/15023_Model12.osm"))->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_VT_Step_InMemory, Model12, std::string("model/15023_Model12.osm"))->Unit(benchmark::kMillisecond);
@@ -8339,12 +8339,6 @@ namespace sdd {
   }
 
   pugi::xml_node ReverseTranslator::findZnSysElement(const pugi::xml_node& znSysRefElement) {
-    pugi::xml_node projectElement = getProjectElement(znSysRefElement);
-    // TODO: perhaps we should rely on the makeVectorOfChildrenRecursive instead (uses Xpath instead of having to harcoded the path)
-    // Not sure about speed penalties
-    // makeVectorOfChildrenRecursive("ZnSys") would work, regardless of which level 'ZnSys' is at
-    // Proj > Bldg > [ZnSys]
-    std::vector<pugi::xml_node> znSysElements = makeVectorOfChildren(projectElement.child("Bldg"), "ZnSys");
     std::string znSysName = znSysRefElement.text().as_string();
 
     if (znSysName.empty()) {
@@ -8352,13 +8346,9 @@ namespace sdd {
       OS_ASSERT(false);
     }
 
-    for (std::vector<pugi::xml_node>::size_type i = 0; i < znSysElements.size(); i++) {
-      pugi::xml_node znSysElement = znSysElements[i];
-      std::string znSysElementName = znSysElement.child("Name").text().as_string();
-
-      if (openstudio::istringEqual(znSysElementName, znSysName)) {
-        return znSysElement;
-      }
+    auto it = m_znSysElements.find(znSysName);
+    if (it != m_znSysElements.end()) {
+      return it->second;
     }
 
     LOG(Debug, "Couldn't locate the ZnSys element with name '" << znSysName << "'.");
@@ -8366,26 +8356,15 @@ namespace sdd {
   }
 
   pugi::xml_node ReverseTranslator::findTrmlUnitElementForZone(const pugi::xml_node& znNameElement) {
-    pugi::xml_node projectElement = getProjectElement(znNameElement);
-    // Proj > Bldg > [AirSys]
-    std::vector<pugi::xml_node> airSystemElements = makeVectorOfChildren(projectElement.child("Bldg"), "AirSys");
     std::string zoneName = znNameElement.text().as_string();
     if (zoneName.empty()) {
       LOG(Error, "findTrmlUnitElementForZone called with an empty zoneName");
       OS_ASSERT(false);
     }
 
-    for (std::vector<pugi::xml_node>::size_type i = 0; i < airSystemElements.size(); i++) {
-      pugi::xml_node airSystemElement = airSystemElements[i];
-      std::vector<pugi::xml_node> terminalElements = makeVectorOfChildren(airSystemElement, "TrmlUnit");
-      for (std::vector<pugi::xml_node>::size_type j = 0; j < terminalElements.size(); j++) {
-        pugi::xml_node terminalElement = terminalElements[j];
-        std::string zoneServedElementName = terminalElement.child("ZnServedRef").text().as_string();
-
-        if (openstudio::istringEqual(zoneName, zoneServedElementName)) {
-          return terminalElement;
-        }
-      }
+    auto it = m_trmlUnitElementsByZone.find(zoneName);
+    if (it != m_trmlUnitElementsByZone.end()) {
+      return it->second;
     }
 
     LOG(Debug, "Couldn't locate the TrmlUnit element for zoneName '" << zoneName << "'.");
@@ -8410,16 +8389,9 @@ namespace sdd {
       OS_ASSERT(false);
     }
 
-    // Proj > Bldg > [AirSys]
-    std::vector<pugi::xml_node> airSystemElements = makeVectorOfChildren(projectElement.child("Bldg"), "AirSys");
-
-    for (std::vector<pugi::xml_node>::size_type i = 0; i < airSystemElements.size(); i++) {
-      pugi::xml_node airSystemElement = airSystemElements[i];
-      std::string airSystemElementName = airSystemElement.child("Name").text().as_string();
-
-      if (openstudio::istringEqual(airSysName, airSystemElementName)) {
-        return airSystemElement;
-      }
+    auto it = m_airSysElements.find(airSysName);
+    if (it != m_airSysElements.end()) {
+      return it->second;
     }
 
     LOG(Debug, "Couldn't locate the AirSys element for airSysName '" << airSysName << "'.");
@@ -211,6 +211,8 @@ namespace sdd {
       m_isInputXML = false;
     }
 
+    indexElements(projectElement);
+
     result = openstudio::model::Model();
     result->setFastNaming(true);
 
@@ -1870,7 +1872,6 @@ namespace sdd {
 
   pugi::xml_node ReverseTranslator::supplySegment(const pugi::xml_node& fluidSegInRefElement) {
 
-    pugi::xml_node projectElement = getProjectElement(fluidSegInRefElement);
     std::string fluidSegmentName = fluidSegInRefElement.text().as_string();
 
     if (fluidSegmentName.empty()) {
@@ -1878,19 +1879,42 @@ namespace sdd {
       OS_ASSERT(false);
     }
 
+    auto it = m_supplySegmentElements.find(fluidSegmentName);
+    if (it != m_supplySegmentElements.end()) {
+      return it->second;
+    }
+
+    return {};
+  }
+
+  void ReverseTranslator::indexElements(const pugi::xml_node& projectElement) {
+    m_znSysElements.clear();
+    m_airSysElements.clear();
+    m_trmlUnitElementsByZone.clear();
+    m_supplySegmentElements.clear();
+
+    // Proj > Bldg > [ZnSys]
+    for (auto& znSysElement : projectElement.child("Bldg").children("ZnSys")) {
+      m_znSysElements.emplace(znSysElement.child("Name").text().as_string(), znSysElement);
+    }
+
+    // Proj > Bldg > [AirSys] > [TrmlUnit]
+    for (auto& airSystemElement : projectElement.child("Bldg").children("AirSys")) {
+      m_airSysElements.emplace(airSystemElement.child("Name").text().as_string(), airSystemElement);
+      for (auto& terminalElement : airSystemElement.children("TrmlUnit")) {
+        m_trmlUnitElementsByZone.emplace(terminalElement.child("ZnServedRef").text().as_string(), terminalElement);
+      }
+    }
+
+    // Proj > [FluidSys] > [FluidSeg]
     for (auto& fluidSysElement : projectElement.children("FluidSys")) {
       for (auto& fluidSegmentElement : fluidSysElement.children("FluidSeg")) {
-        auto nameElement = fluidSegmentElement.child("Name");
-        auto typeElement = fluidSegmentElement.child("Type");
-
-        if ((istringEqual(typeElement.text().as_string(), "SECONDARYSUPPLY") || istringEqual(typeElement.text().as_string(), "PRIMARYSUPPLY"))
-            && istringEqual(nameElement.text().as_string(), fluidSegmentName)) {
-          return fluidSegmentElement;
+        std::string type = fluidSegmentElement.child("Type").text().as_string();
+        if (istringEqual(type, "SECONDARYSUPPLY") || istringEqual(type, "PRIMARYSUPPLY")) {
+          m_supplySegmentElements.emplace(fluidSegmentElement.child("Name").text().as_string(), fluidSegmentElement);
         }
       }
     }
-
-    return {};
   }
 
   boost::optional<model::PlantLoop> ReverseTranslator::loopForSupplySegment(const pugi::xml_node& fluidSegInRefElement,
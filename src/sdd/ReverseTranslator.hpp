@@ -12,6 +12,7 @@
 #include "../utilities/core/Optional.hpp"
 #include "../utilities/core/Logger.hpp"
 #include "../utilities/core/StringStreamLogSink.hpp"
+#include "../utilities/core/Compare.hpp"
 
 #include "../model/Schedule.hpp"
 #include "../model/AvailabilityManagerOptimumStart.hpp"
@@ -147,6 +148,17 @@ namespace sdd {
     // Return the "TrmlUnit" element serving a zone named znNameElement.text().as_string()
     pugi::xml_node findTrmlUnitElementForZone(const pugi::xml_node& znNameElement);
 
+    // Fills the registries below from projectElement, so the find methods above resolve a name without scanning the project.
+    // Where names repeat, the first element in document order is kept, as the scans did.
+    void indexElements(const pugi::xml_node& projectElement);
+
+    // ZnSys and AirSys elements by name, TrmlUnit elements by the name of the zone they serve,
+    // and PRIMARYSUPPLY or SECONDARYSUPPLY FluidSeg elements by name
+    std::map<std::string, pugi::xml_node, IstringCompare> m_znSysElements;
+    std::map<std::string, pugi::xml_node, IstringCompare> m_airSysElements;
+    std::map<std::string, pugi::xml_node, IstringCompare> m_trmlUnitElementsByZone;
+    std::map<std::string, pugi::xml_node, IstringCompare> m_supplySegmentElements;
+
     model::Schedule defaultDeckTempSchedule(openstudio::model::Model& model);
     boost::optional<model::Schedule> m_defaultDeckTempSchedule;
 
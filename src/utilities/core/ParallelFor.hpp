@@ -0,0 +1,77 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#ifndef UTILITIES_CORE_PARALLELFOR_HPP
+#define UTILITIES_CORE_PARALLELFOR_HPP
+
+#include "Assert.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <thread>
+#include <vector>
+
+namespace openstudio {
+
+/** Returns the number of threads parallelForChunks runs n items on, handed out chunkSize at a time. This is numThreads, or
+ *  std::thread::hardware_concurrency() if numThreads is 0, but never more than there are chunks and never less than 1. chunkSize must
+ *  be at least 1. */
+inline unsigned parallelThreadCount(std::size_t n, unsigned numThreads, std::size_t chunkSize) {
+  OS_ASSERT(chunkSize > 0);
+  if (numThreads == 0) {
+    numThreads = std::max(1u, std::thread::hardware_concurrency());
+  }
+  const std::size_t numChunks = (n + chunkSize - 1) / chunkSize;
+  return static_cast<unsigned>(std::max<std::size_t>(1, std::min<std::size_t>(numThreads, numChunks)));
+}
+
+/** Calls fn(threadIndex, i) for each i in [0, n), on parallelThreadCount(n, numThreads, chunkSize) threads taking the next
+ *  chunkSize items in turn. With a single thread, the items are done in order on the calling thread. Otherwise they are all done on
+ *  new threads, threadIndex in [0, number of threads) telling them apart. An exception stops the thread that threw it, and the first
+ *  one (by threadIndex) is rethrown here once all the threads are joined. */
+template <typename Function>
+void parallelForChunks(std::size_t n, unsigned numThreads, std::size_t chunkSize, Function&& fn) {
+  numThreads = parallelThreadCount(n, numThreads, chunkSize);
+  if (numThreads == 1) {
+    for (std::size_t i = 0; i < n; ++i) {
+      fn(0u, i);
+    }
+    return;
+  }
+
+  std::atomic<std::size_t> next(0);
+  std::vector<std::exception_ptr> errors(numThreads);
+  auto work = [n, chunkSize, &fn, &next, &errors](unsigned threadIndex) {
+    try {
+      for (std::size_t begin = next.fetch_add(chunkSize); begin < n; begin = next.fetch_add(chunkSize)) {
+        for (std::size_t i = begin, end = std::min(begin + chunkSize, n); i < end; ++i) {
+          fn(threadIndex, i);
+        }
+      }
+    } catch (...) {
+      errors[threadIndex] = std::current_exception();
+    }
+  };
+
+  std::vector<std::thread> threads;
+  threads.reserve(numThreads);
+  for (unsigned t = 0; t < numThreads; ++t) {
+    threads.emplace_back(work, t);
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+  for (const std::exception_ptr& error : errors) {
+    if (error) {
+      std::rethrow_exception(error);
+    }
+  }
+}
+
+}  // namespace openstudio
+
+#endif  // UTILITIES_CORE_PARALLELFOR_HPP
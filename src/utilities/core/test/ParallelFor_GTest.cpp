@@ -0,0 +1,52 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "CoreFixture.hpp"
+
+#include "../ParallelFor.hpp"
+
+#include <stdexcept>
+#include <vector>
+
+using openstudio::parallelForChunks;
+using openstudio::parallelThreadCount;
+
+TEST_F(CoreFixture, ParallelFor_ThreadCount) {
+  EXPECT_EQ(1u, parallelThreadCount(0, 4, 64));
+  EXPECT_EQ(1u, parallelThreadCount(64, 4, 64));
+  EXPECT_EQ(2u, parallelThreadCount(65, 4, 64));
+  EXPECT_EQ(4u, parallelThreadCount(1000, 4, 64));
+  EXPECT_EQ(3u, parallelThreadCount(3, 4, 1));
+  EXPECT_LE(1u, parallelThreadCount(1000, 0, 1));
+}
+
+TEST_F(CoreFixture, ParallelFor_Chunks) {
+  for (unsigned numThreads : {1u, 2u, 4u}) {
+    std::vector<int> visits(1000, 0);
+    std::vector<unsigned> threadIndices(1000, 0);
+    parallelForChunks(visits.size(), numThreads, 64, [&visits, &threadIndices](unsigned threadIndex, std::size_t i) {
+      ++visits[i];
+      threadIndices[i] = threadIndex;
+    });
+    for (std::size_t i = 0; i < visits.size(); ++i) {
+      EXPECT_EQ(1, visits[i]);
+      EXPECT_LT(threadIndices[i], numThreads);
+    }
+  }
+}
+
+TEST_F(CoreFixture, ParallelFor_Exception) {
+  for (unsigned numThreads : {1u, 4u}) {
+    EXPECT_THROW(parallelForChunks(1000, numThreads, 64,
+                                   [](unsigned, std::size_t i) {
+                                     if (i == 500) {
+                                       throw std::runtime_error("item 500");
+                                     }
+                                   }),
+                 std::runtime_error);
+  }
+}
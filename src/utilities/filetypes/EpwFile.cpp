@@ -13,6 +13,7 @@
 
 #include <fmt/format.h>
 #include <cmath>
+#include <limits>
 
 namespace openstudio {
 
@@ -306,6 +307,120 @@ double AirState::R() {
   return 8314.472 / 28.966;  // eqn 1 from ASHRAE Fundamentals 2009 Ch. 1
 }
 
+namespace detail {
+
+  namespace {
+
+    constexpr std::uint8_t decimalsMask = 0x0F;
+    constexpr std::uint8_t pointFlag = 0x10;
+    constexpr std::uint8_t noIntegerDigitsFlag = 0x20;
+
+    bool isDigit(char c) {
+      return (c >= '0') && (c <= '9');
+    }
+
+    // Returns the format of text if EpwNumber::text() can rewrite it exactly, EpwNumber::verbatimFormat otherwise. That is
+    // an optional '-', an integer part without leading zeros, an optional '.' and fraction part, and at most 15 digits so
+    // that the digits survive the trip through a double.
+    std::uint8_t numberFormat(const std::string& text) {
+      const std::size_t n = text.size();
+      std::size_t i = 0;
+      if ((i < n) && (text[i] == '-')) {
+        ++i;
+      }
+      const std::size_t integerBegin = i;
+      while ((i < n) && isDigit(text[i])) {
+        ++i;
+      }
+      const std::size_t integerDigits = i - integerBegin;
+      if ((integerDigits > 1) && (text[integerBegin] == '0')) {
+        return EpwNumber::verbatimFormat;
+      }
+
+      std::uint8_t format = 0;
+      std::size_t decimals = 0;
+      if ((i < n) && (text[i] == '.')) {
+        format |= pointFlag;
+        const std::size_t fractionBegin = ++i;
+        while ((i < n) && isDigit(text[i])) {
+          ++i;
+        }
+        decimals = i - fractionBegin;
+      }
+
+      if ((i != n) || (integerDigits + decimals == 0) || (integerDigits + decimals > 15)) {
+        return EpwNumber::verbatimFormat;
+      }
+      if (integerDigits == 0) {
+        format |= noIntegerDigitsFlag;
+      }
+      return format | static_cast<std::uint8_t>(decimals);
+    }
+
+  }  // namespace
+
+  EpwNumber::EpwNumber(const std::string& text) : EpwNumber(text, std::numeric_limits<double>::quiet_NaN()) {
+    // text that is not a number does not have a format, and is kept verbatim
+    try {
+      m_value = std::stod(text);
+    } catch (const std::exception&) {
+    }
+  }
+
+  EpwNumber::EpwNumber(const char* text) : EpwNumber(std::string(text)) {}
+
+  EpwNumber::EpwNumber(const std::string& text, double value) : m_value(value), m_format(numberFormat(text)) {
+    if (m_format == verbatimFormat) {
+      m_verbatimText = std::make_shared<const std::string>(text);
+    }
+  }
+
+  EpwNumber::EpwNumber(double value, std::uint8_t format, std::shared_ptr<const std::string> verbatimText)
+    : m_value(value), m_format(format), m_verbatimText(std::move(verbatimText)) {
+    OS_ASSERT((m_format == verbatimFormat) == static_cast<bool>(m_verbatimText));
+  }
+
+  std::string EpwNumber::text() const {
+    if (m_format == verbatimFormat) {
+      return *m_verbatimText;
+    }
+    const int decimals = m_format & decimalsMask;
+    std::string result = fmt::format("{:.{}f}", m_value, decimals);
+    if ((m_format & noIntegerDigitsFlag) != 0) {
+      // ".999" rather than "0.999"
+      result.erase(result.find('0'), 1);
+    }
+    if (((m_format & pointFlag) != 0) && (decimals == 0)) {
+      result.push_back('.');
+    }
+    return result;
+  }
+
+  bool EpwNumber::operator==(const EpwNumber& other) const {
+    if (m_format != other.m_format) {
+      return false;
+    }
+    if (m_format == verbatimFormat) {
+      return *m_verbatimText == *other.m_verbatimText;
+    }
+    return (m_value == other.m_value) && (std::signbit(m_value) == std::signbit(other.m_value));
+  }
+
+  bool EpwNumber::operator!=(const EpwNumber& other) const {
+    return !(*this == other);
+  }
+
+}  // namespace detail
+
+// Missing value markers, compared against the text of a field
+static const detail::EpwNumber missing99("99");
+static const detail::EpwNumber missing99pt9("99.9");
+static const detail::EpwNumber missing999("999");
+static const detail::EpwNumber missingPt999(".999");
+static const detail::EpwNumber missing9999("9999");
+static const detail::EpwNumber missing99999("99999");
+static const detail::EpwNumber missing999999("999999");
+
 EpwDataPoint::EpwDataPoint()
   : m_year(1),
     m_month(1),
@@ -313,35 +428,35 @@ EpwDataPoint::EpwDataPoint()
     m_hour(1),
     m_minute(0),
     m_dataSourceandUncertaintyFlags(""),
-    m_dryBulbTemperature("99.9"),
-    m_dewPointTemperature("99.9"),
-    m_relativeHumidity("999"),
-    m_atmosphericStationPressure("999999"),
-    m_extraterrestrialHorizontalRadiation("9999"),
-    m_extraterrestrialDirectNormalRadiation("9999"),
-    m_horizontalInfraredRadiationIntensity("9999"),
-    m_globalHorizontalRadiation("9999"),
-    m_directNormalRadiation("9999"),
-    m_diffuseHorizontalRadiation("9999"),
-    m_globalHorizontalIlluminance("999999"),
-    m_directNormalIlluminance("999999"),
-    m_diffuseHorizontalIlluminance("999999"),
-    m_zenithLuminance("9999"),
-    m_windDirection("999"),
-    m_windSpeed("999"),
+    m_dryBulbTemperature(missing99pt9),
+    m_dewPointTemperature(missing99pt9),
+    m_relativeHumidity(missing999),
+    m_atmosphericStationPressure(missing999999),
+    m_extraterrestrialHorizontalRadiation(missing9999),
+    m_extraterrestrialDirectNormalRadiation(missing9999),
+    m_horizontalInfraredRadiationIntensity(missing9999),
+    m_globalHorizontalRadiation(missing9999),
+    m_directNormalRadiation(missing9999),
+    m_diffuseHorizontalRadiation(missing9999),
+    m_globalHorizontalIlluminance(missing999999),
+    m_directNormalIlluminance(missing999999),
+    m_diffuseHorizontalIlluminance(missing999999),
+    m_zenithLuminance(missing9999),
+    m_windDirection(missing999),
+    m_windSpeed(missing999),
     m_totalSkyCover(99),
     m_opaqueSkyCover(99),
-    m_visibility("9999"),
-    m_ceilingHeight("99999"),
+    m_visibility(missing9999),
+    m_ceilingHeight(missing99999),
     m_presentWeatherObservation(0),
     m_presentWeatherCodes(0),
-    m_precipitableWater("999"),
-    m_aerosolOpticalDepth(".999"),
-    m_snowDepth("999"),
-    m_daysSinceLastSnowfall("99"),
-    m_albedo("999"),
-    m_liquidPrecipitationDepth("999"),
-    m_liquidPrecipitationQuantity("99") {}
+    m_precipitableWater(missing999),
+    m_aerosolOpticalDepth(missingPt999),
+    m_snowDepth(missing999),
+    m_daysSinceLastSnowfall(missing99),
+    m_albedo(missing999),
+    m_liquidPrecipitationDepth(missing999),
+    m_liquidPrecipitationQuantity(missing99) {}
 
 EpwDataPoint::EpwDataPoint(int year, int month, int day, int hour, int minute, const std::string& dataSourceandUncertaintyFlags,
                            double dryBulbTemperature, double dewPointTemperature, double relativeHumidity, double atmosphericStationPressure,
@@ -762,38 +877,84 @@ std::vector<std::string> EpwDataPoint::toEpwStrings() const {
   list.push_back(std::to_string(m_hour));
   list.push_back(std::to_string(m_minute));
   list.push_back(m_dataSourceandUncertaintyFlags);
-  list.push_back(m_dryBulbTemperature);
-  list.push_back(m_dewPointTemperature);
-  list.push_back(m_relativeHumidity);
-  list.push_back(m_atmosphericStationPressure);
-  list.push_back(m_extraterrestrialHorizontalRadiation);
-  list.push_back(m_extraterrestrialDirectNormalRadiation);
-  list.push_back(m_horizontalInfraredRadiationIntensity);
-  list.push_back(m_globalHorizontalRadiation);
-  list.push_back(m_directNormalRadiation);
-  list.push_back(m_diffuseHorizontalRadiation);
-  list.push_back(m_globalHorizontalIlluminance);
-  list.push_back(m_directNormalIlluminance);
-  list.push_back(m_diffuseHorizontalIlluminance);
-  list.push_back(m_zenithLuminance);
-  list.push_back(m_windDirection);
-  list.push_back(m_windSpeed);
+  list.push_back(m_dryBulbTemperature.text());
+  list.push_back(m_dewPointTemperature.text());
+  list.push_back(m_relativeHumidity.text());
+  list.push_back(m_atmosphericStationPressure.text());
+  list.push_back(m_extraterrestrialHorizontalRadiation.text());
+  list.push_back(m_extraterrestrialDirectNormalRadiation.text());
+  list.push_back(m_horizontalInfraredRadiationIntensity.text());
+  list.push_back(m_globalHorizontalRadiation.text());
+  list.push_back(m_directNormalRadiation.text());
+  list.push_back(m_diffuseHorizontalRadiation.text());
+  list.push_back(m_globalHorizontalIlluminance.text());
+  list.push_back(m_directNormalIlluminance.text());
+  list.push_back(m_diffuseHorizontalIlluminance.text());
+  list.push_back(m_zenithLuminance.text());
+  list.push_back(m_windDirection.text());
+  list.push_back(m_windSpeed.text());
   list.push_back(std::to_string(m_totalSkyCover));
   list.push_back(std::to_string(m_opaqueSkyCover));
-  list.push_back(m_visibility);
-  list.push_back(m_ceilingHeight);
+  list.push_back(m_visibility.text());
+  list.push_back(m_ceilingHeight.text());
   list.push_back(std::to_string(m_presentWeatherObservation));
   list.push_back(std::to_string(m_presentWeatherCodes));
-  list.push_back(m_precipitableWater);
-  list.push_back(m_aerosolOpticalDepth);
-  list.push_back(m_snowDepth);
-  list.push_back(m_daysSinceLastSnowfall);
-  list.push_back(m_albedo);
-  list.push_back(m_liquidPrecipitationDepth);
-  list.push_back(m_liquidPrecipitationQuantity);
+  list.push_back(m_precipitableWater.text());
+  list.push_back(m_aerosolOpticalDepth.text());
+  list.push_back(m_snowDepth.text());
+  list.push_back(m_daysSinceLastSnowfall.text());
+  list.push_back(m_albedo.text());
+  list.push_back(m_liquidPrecipitationDepth.text());
+  list.push_back(m_liquidPrecipitationQuantity.text());
   return list;
 }
 
+const std::vector<std::pair<int, detail::EpwNumber EpwDataPoint::*>>& EpwDataPoint::numberMembers() {
+  static const std::vector<std::pair<int, detail::EpwNumber EpwDataPoint::*>> members{
+    {EpwDataField::DryBulbTemperature, &EpwDataPoint::m_dryBulbTemperature},
+    {EpwDataField::DewPointTemperature, &EpwDataPoint::m_dewPointTemperature},
+    {EpwDataField::RelativeHumidity, &EpwDataPoint::m_relativeHumidity},
+    {EpwDataField::AtmosphericStationPressure, &EpwDataPoint::m_atmosphericStationPressure},
+    {EpwDataField::ExtraterrestrialHorizontalRadiation, &EpwDataPoint::m_extraterrestrialHorizontalRadiation},
+    {EpwDataField::ExtraterrestrialDirectNormalRadiation, &EpwDataPoint::m_extraterrestrialDirectNormalRadiation},
+    {EpwDataField::HorizontalInfraredRadiationIntensity, &EpwDataPoint::m_horizontalInfraredRadiationIntensity},
+    {EpwDataField::GlobalHorizontalRadiation, &EpwDataPoint::m_globalHorizontalRadiation},
+    {EpwDataField::DirectNormalRadiation, &EpwDataPoint::m_directNormalRadiation},
+    {EpwDataField::DiffuseHorizontalRadiation, &EpwDataPoint::m_diffuseHorizontalRadiation},
+    {EpwDataField::GlobalHorizontalIlluminance, &EpwDataPoint::m_globalHorizontalIlluminance},
+    {EpwDataField::DirectNormalIlluminance, &EpwDataPoint::m_directNormalIlluminance},
+    {EpwDataField::DiffuseHorizontalIlluminance, &EpwDataPoint::m_diffuseHorizontalIlluminance},
+    {EpwDataField::ZenithLuminance, &EpwDataPoint::m_zenithLuminance},
+    {EpwDataField::WindDirection, &EpwDataPoint::m_windDirection},
+    {EpwDataField::WindSpeed, &EpwDataPoint::m_windSpeed},
+    {EpwDataField::Visibility, &EpwDataPoint::m_visibility},
+    {EpwDataField::CeilingHeight, &EpwDataPoint::m_ceilingHeight},
+    {EpwDataField::PrecipitableWater, &EpwDataPoint::m_precipitableWater},
+    {EpwDataField::AerosolOpticalDepth, &EpwDataPoint::m_aerosolOpticalDepth},
+    {EpwDataField::SnowDepth, &EpwDataPoint::m_snowDepth},
+    {EpwDataField::DaysSinceLastSnowfall, &EpwDataPoint::m_daysSinceLastSnowfall},
+    {EpwDataField::Albedo, &EpwDataPoint::m_albedo},
+    {EpwDataField::LiquidPrecipitationDepth, &EpwDataPoint::m_liquidPrecipitationDepth},
+    {EpwDataField::LiquidPrecipitationQuantity, &EpwDataPoint::m_liquidPrecipitationQuantity},
+  };
+  return members;
+}
+
+const std::vector<std::pair<int, int EpwDataPoint::*>>& EpwDataPoint::integerMembers() {
+  static const std::vector<std::pair<int, int EpwDataPoint::*>> members{
+    {EpwDataField::Year, &EpwDataPoint::m_year},
+    {EpwDataField::Month, &EpwDataPoint::m_month},
+    {EpwDataField::Day, &EpwDataPoint::m_day},
+    {EpwDataField::Hour, &EpwDataPoint::m_hour},
+    {EpwDataField::Minute, &EpwDataPoint::m_minute},
+    {EpwDataField::TotalSkyCover, &EpwDataPoint::m_totalSkyCover},
+    {EpwDataField::OpaqueSkyCover, &EpwDataPoint::m_opaqueSkyCover},
+    {EpwDataField::PresentWeatherObservation, &EpwDataPoint::m_presentWeatherObservation},
+    {EpwDataField::PresentWeatherCodes, &EpwDataPoint::m_presentWeatherCodes},
+  };
+  return members;
+}
+
 boost::optional<std::string> EpwDataPoint::getUnitsByName(const std::string& name) {
   EpwDataField id;
   try {
@@ -1504,17 +1665,17 @@ boost::optional<std::string> EpwDataPoint::toWthString() const {
     return boost::none;
   }
   double p = value.get();
-  string += '\t' + m_atmosphericStationPressure;
+  string += '\t' + m_atmosphericStationPressure.text();
   if (!windSpeed()) {
     LOG_FREE(Error, "openstudio.EpwFile", "Missing wind speed on " << date << " at " << hms);
     return boost::none;
   }
-  string += '\t' + m_windSpeed;
+  string += '\t' + m_windSpeed.text();
   if (!windDirection()) {
     LOG_FREE(Error, "openstudio.EpwFile", "Missing wind direction on " << date << " at " << hms);
     return boost::none;
   }
-  string += '\t' + m_windDirection;
+  string += '\t' + m_windDirection.text();
   double pw;
   value = relativeHumidity();
   if (!value) {  // Don't have relative humidity - this has not been tested
@@ -1716,10 +1877,10 @@ void EpwDataPoint::setDataSourceandUncertaintyFlags(const std::string& dataSourc
 }
 
 boost::optional<double> EpwDataPoint::dryBulbTemperature() const {
-  if (m_dryBulbTemperature == "99.9") {
+  if (m_dryBulbTemperature == missing99pt9) {
     return boost::none;
   }
-  return boost::optional<double>(std::stod(m_dryBulbTemperature));
+  return boost::optional<double>(m_dryBulbTemperature.value());
 }
 
 bool EpwDataPoint::setDryBulbTemperature(double value) {
@@ -1734,20 +1895,20 @@ bool EpwDataPoint::setDryBulbTemperature(const std::string& dryBulbTemperature)
   bool ok;
   double value = stringToDouble(dryBulbTemperature, &ok);
   if (!ok) {
-    m_dryBulbTemperature = "99.9";
+    m_dryBulbTemperature = missing99pt9;
     return false;
   } else if (-70 >= value || 70 <= value) {
     LOG_FREE(Warn, "openstudio.EpwFile", "DryBulbTemperature value '" << value << "' not within the expected limits");
   }
-  m_dryBulbTemperature = dryBulbTemperature;
+  m_dryBulbTemperature = detail::EpwNumber(dryBulbTemperature, value);
   return true;
 }
 
 boost::optional<double> EpwDataPoint::dewPointTemperature() const {
-  if (m_dewPointTemperature == "99.9") {
+  if (m_dewPointTemperature == missing99pt9) {
     return boost::none;
   }
-  return boost::optional<double>(std::stod(m_dewPointTemperature));
+  return boost::optional<double>(m_dewPointTemperature.value());
 }
 
 bool EpwDataPoint::setDewPointTemperature(double value) {
@@ -1762,25 +1923,25 @@ bool EpwDataPoint::setDewPointTemperature(const std::string& dewPointTemperature
   bool ok;
   double value = stringToDouble(dewPointTemperature, &ok);
   if (!ok) {
-    m_dewPointTemperature = "99.9";
+    m_dewPointTemperature = missing99pt9;
     return false;
   } else if (-70 >= value || 70 <= value) {
     LOG_FREE(Warn, "openstudio.EpwFile", "DewPointTemperature value '" << value << "' not within the expected limits");
   }
-  m_dewPointTemperature = dewPointTemperature;
+  m_dewPointTemperature = detail::EpwNumber(dewPointTemperature, value);
   return true;
 }
 
 boost::optional<double> EpwDataPoint::relativeHumidity() const {
-  if (m_relativeHumidity == "999") {
+  if (m_relativeHumidity == missing999) {
     return boost::none;
   }
-  return boost::optional<double>(std::stod(m_relativeHumidity));
+  return boost::optional<double>(m_relativeHumidity.value());
 }
 
 bool EpwDataPoint::setRelativeHumidity(double value) {
   if (0 > value) {
-    m_relativeHumidity = "999";
+    m_relativeHumidity = missing999;
     return false;
   } else if (110 < value) {
     LOG_FREE(Warn, "openstudio.EpwFile", "RelativeHumidity value '" << value << "' not within the expected limits");
@@ -1793,20 +1954,20 @@ bool EpwDataPoint::setRelativeHumidity(const std::string& relativeHumidity) {
   bool ok;
   double value = stringToDouble(relativeHumidity, &ok);
   if (!ok || 0 > value) {
-    m_relativeHumidity = "999";
+    m_relativeHumidity = missing999;
     return false;
   } else if (110 < value) {
     LOG_FREE(Warn, "openstudio.EpwFile", "RelativeHumidity value '" << value << "' not within the expected limits");
   }
-  m_relativeHumidity = relativeHumidity;
+  m_relativeHumidity = detail::EpwNumber(relativeHumidity, value);
   return true;
 }
 
 boost::optional<double> EpwDataPoint::atmosphericStationPressure() const {
-  if (m_atmosphericStationPressure == "999999") {
+  if (m_atmosphericStationPressure == missing999999) {
     return boost::none;
   }
-  return boost::optional<double>(std::stod(m_atmosphericStationPressure));
+  return boost::optional<double>(m_atmosphericStationPressure.value());
 }
 
 bool EpwDataPoint::setAtmosphericStationPressure(double value) {
@@ -1821,25 +1982,25 @@ bool EpwDataPoint::setAtmosphericStationPressure(const std::string& atmosphericS
   bool ok;
   double value = stringToDouble(atmosphericStationPressure, &ok);
   if (!ok) {
-    m_atmosphericStationPressure = "999999";
+    m_atmosphericStationPressure = missing999999;
     return false;
   } else if (31000 >= value || 120000 <= value) {
     LOG_FREE(Warn, "openstudio.EpwFile", "AtmosphericStationPressure value '" << value << "' not within the expected limits");
   }
-  m_atmosphericStationPressure = atmosphericStationPressure;
+  m_atmosphericStationPressure = detail::EpwNumber(atmosphericStationPressure, value);
   return true;
 }
 
 boost::optional<double> EpwDataPoint::extraterrestrialHorizontalRadiation() const {
-  if (m_extraterrestrialHorizontalRadiation == "9999") {
+  if (m_extraterrestrialHorizontalRadiation == missing9999) {
     return boost::none;
   }
-  return boost::optional<double>(std::stod(m_extraterrestrialHorizontalRadiation));
+  return boost::optional<double>(m_extraterrestrialHorizontalRadiation.value());
 }
 
 bool EpwDataPoint::setExtraterrestrialHorizontalRadiation(double value) {
   if (0 > value || value == 9999) {
-    m_extraterrestrialHorizontalRadiation = "9999";
+    m_extraterrestrialHorizontalRadiation = missing9999;
     return false;
   }
   m_extraterrestrialHorizontalRadiation = std::to_string(value);
@@ -1850,23 +2011,23 @@ bool EpwDataPoint::setExtraterrestrialHorizontalRadiation(const std::string& ext
   bool ok;
   double value = stringToDouble(extraterrestrialHorizontalRadiation, &ok);
   if (!ok || 0 > value || value == 9999) {
-    m_extraterrestrialHorizontalRadiation = "9999";
+    m_extraterrestrialHorizontalRadiation = missing9999;
     return false;
   }
-  m_extraterrestrialHorizontalRadiation = extraterrestrialHorizontalRadiation;
+  m_extraterrestrialHorizontalRadiation = detail::EpwNumber(extraterrestrialHorizontalRadiation, value);
   return true;
 }
 
 boost::optional<double> EpwDataPoint::extraterrestrialDirectNormalRadiation() const {
-  if (m_extraterrestrialDirectNormalRadiation == "9999") {
+  if (m_extraterrestrialDirectNormalRadiation == missing9999) {
     return boost::none;
   }
-  return boost::optional<double>(std::stod(m_extraterrestrialDirectNormalRadiation));
+  return boost::optional<double>(m_extraterrestrialDirectNormalRadiation.value());
 }
 
 bool EpwDataPoint::setExtraterrestrialDirectNormalRadiation(double value) {
   if (0 > value || value == 9999) {
-    m_extraterrestrialDirectNormalRadiation = "9999";
+    m_extraterrestrialDirectNormalRadiation = missing9999;
     return false;
   }
   m_extraterrestrialDirectNormalRadiation = std::to_string(value);
@@ -1877,23 +2038,23 @@ bool EpwDataPoint::setExtraterrestrialDirectNormalRadiation(const std::string& e
   bool ok;
   double value = stringToDouble(extraterrestrialDirectNormalRadiation, &ok);
   if (!ok || 0 > value || value == 9999) {
-    m_extraterrestrialDirectNormalRadiation = "9999";
+    m_extraterrestrialDirectNormalRadiation = missing9999;
     return false;
   }
-  m_extraterrestrialDirectNormalRadiation = extraterrestrialDirectNormalRadiation;
+  m_extraterrestrialDirectNormalRadiation = detail::EpwNumber(extraterrestrialDirectNormalRadiation, value);
   return true;
 }
 
 boost::optional<double> EpwDataPoint::horizontalInfraredRadiationIntensity() const {
-  if (m_horizontalInfraredRadiationIntensity == "9999") {
+  if (m_horizontalInfraredRadiationIntensity == missing9999) {
     return boost::none;
   }
-  return boost::optional<double>(std::stod(m_horizontalInfraredRadiationIntensity));
+  return boost::optional<double>(m_horizontalInfraredRadiationIntensity.value());
 }
 
 bool EpwDataPoint::setHorizontalInfraredRadiationIntensity(double value) {
   if (0 > value || value == 9999) {
-    m_horizontalInfraredRadiationIntensity = "9999";
+    m_horizontalInfraredRadiationIntensity = missing9999;
     return false;
   }
   m_horizontalInfraredRadiationIntensity = std::to_string(value);
@@ -1904,23 +2065,23 @@ bool EpwDataPoint::setHorizontalInfraredRadiationIntensity(const std::string& ho
   bool ok;
   double value = stringToDouble(horizontalInfraredRadiationIntensity, &ok);
   if (!ok || 0 > value || value == 9999) {
-    m_horizontalInfraredRadiationIntensity = "9999";
+    m_horizontalInfraredRadiationIntensity = missing9999;
     return false;
   }
-  m_horizontalInfraredRadiationIntensity = horizontalInfraredRadiationIntensity;
+  m_horizontalInfraredRadiationIntensity = detail::EpwNumber(horizontalInfraredRadiationIntensity, value);
   return true;
 }
 
 boost::optional<double> EpwDataPoint::globalHorizontalRadiation() const {
-  if (m_globalHorizontalRadiation == "9999") {
+  if (m_globalHorizontalRadiation == missing9999) {
     return boost::none;
   }
-  return boost::optional<double>(std::stod(m_globalHorizontalRadiation));
+  return boost::optional<double>(m_globalHorizontalRadiation.value());
 }
 
 bool EpwDataPoint::setGlobalHorizontalRadiation(double value) {
   if (0 > value || value == 9999) {
-    m_globalHorizontalRadiation = "9999";
+    m_globalHorizontalRadiation = missing9999;
     return false;
   }
   m_globalHorizontalRadiation = std::to_string(value);
@@ -1931,22 +2092,22 @@ bool EpwDataPoint::setGlobalHorizontalRadiation(const std::string& globalHorizon
   bool ok;
   double value = stringToDouble(globalHorizontalRadiation, &ok);
   if (!ok || 0 > value || value == 9999) {
-    m_globalHorizontalRadiation = "9999";
+    m_globalHorizontalRadiation = missing9999;
     return false;
   }
   return setGlobalHorizontalRadiation(value);
 }
 
 boost::optional<double> EpwDataPoint::directNormalRadiation() const {
-  if (m_directNormalRadiation == "9999") {
+  if (m_directNormalRadiation == missing9999) {
     return boost::none;
   }
-  return boost::optional<double>(std::stod(m_directNormalRadiation));
+  return boost::optional<double>(m_directNormalRadiation.value());
 }
 
 bool EpwDataPoint::setDirectNormalRadiation(double value) {
   if (0 > value || value == 9999) {
-    m_directNormalRadiation = "9999";
+    m_directNormalRadiation = missing9999;
     return false;
   }
   m_directNormalRadiation = std::to_string(value);
@@ -1957,23 +2118,23 @@ bool EpwDataPoint::setDirectNormalRadiation(const std::string& directNormalRadia
   bool ok;
   double value = stringToDouble(directNormalRadiation, &ok);
   if (!ok || 0 > value || value == 9999) {
-    m_directNormalRadiation = "9999";
+    m_directNormalRadiation = missing9999;
     return false;
   }
-  m_directNormalRadiation = directNormalRadiation;
+  m_directNormalRadiation = detail::EpwNumber(directNormalRadiation, value);
   return true;
 }
 
 boost::optional<double> EpwDataPoint::diffuseHorizontalRadiation() const {
-  if (m_diffuseHorizontalRadiation == "9999") {
+  if (m_diffuseHorizontalRadiation == missing9999) {
     return boost::none;
   }
-  return boost::optional<double>(std::stod(m_diffuseHorizontalRadiation));
+  return boost::optional<double>(m_diffuseHorizontalRadiation.value());
 }
 
 bool EpwDataPoint::setDiffuseHorizontalRadiation(double value) {
   if (0 > value || value == 9999) {
-    m_diffuseHorizontalRadiation = "9999";
+    m_diffuseHorizontalRadiation = missing9999;
     return false;
   }
   m_diffuseHorizontalRadiation = std::to_string(value);
@@ -1984,23 +2145,23 @@ bool EpwDataPoint::setDiffuseHorizontalRadiation(const std::string& diffuseHoriz
   bool ok;
   double value = stringToDouble(diffuseHorizontalRadiation, &ok);
   if (!ok || 0 > value || value == 9999) {
-    m_diffuseHorizontalRadiation = "9999";
+    m_diffuseHorizontalRadiation = missing9999;
     return false;
   }
-  m_diffuseHorizontalRadiation = diffuseHorizontalRadiation;
+  m_diffuseHorizontalRadiation = detail::EpwNumber(diffuseHorizontalRadiation, value);
   return true;
 }
 
 boost::optional<double> EpwDataPoint::globalHorizontalIlluminance() const {
-  if (m_globalHorizontalIlluminance == "999999") {
+  if (m_globalHorizontalIlluminance == missing999999) {
     return boost::none;
   }
-  return boost::optional<double>(std::stod(m_globalHorizontalIlluminance));
+  return boost::optional<double>(m_globalHorizontalIlluminance.value());
 }
 
 bool EpwDataPoint::setGlobalHorizontalIlluminance(double value) {
   if (0 > value || 999900 < value) {
-    m_globalHorizontalIlluminance = "999999";
+    m_globalHorizontalIlluminance = missing999999;
     return false;
   }
   m_globalHorizontalIlluminance = std::to_string(value);
@@ -2011,23 +2172,23 @@ bool EpwDataPoint::setGlobalHorizontalIlluminance(const std::string& globalHoriz
   bool ok;
   double value = stringToDouble(globalHorizontalIlluminance, &ok);
   if (!ok || 0 > value || 999900 < value) {
-    m_globalHorizontalIlluminance = "999999";
+    m_globalHorizontalIlluminance = missing999999;
     return false;
   }
-  m_globalHorizontalIlluminance = globalHorizontalIlluminance;
+  m_globalHorizontalIlluminance = detail::EpwNumber(globalHorizontalIlluminance, value);
   return true;
 }
 
 boost::optional<double> EpwDataPoint::directNormalIlluminance() const {
-  if (m_directNormalIlluminance == "999999") {
+  if (m_directNormalIlluminance == missing999999) {
     return boost::none;
   }
-  return boost::optional<double>(std::stod(m_directNormalIlluminance));
+  return boost::optional<double>(m_directNormalIlluminance.value());
 }
 
 bool EpwDataPoint::setDirectNormalIlluminance(double value) {
   if (0 > value || 999900 < value) {
-    m_directNormalIlluminance = "999999";
+    m_directNormalIlluminance = missing999999;
     return false;
   }
   m_directNormalIlluminance = std::to_string(value);
@@ -2038,23 +2199,23 @@ bool EpwDataPoint::setDirectNormalIlluminance(const std::string& directNormalIll
   bool ok;
   double value = stringToDouble(directNormalIlluminance, &ok);
   if (!ok || 0 > value || 999900 < value) {
-    m_directNormalIlluminance = "999999";
+    m_directNormalIlluminance = missing999999;
     return false;
   }
-  m_directNormalIlluminance = directNormalIlluminance;
+  m_directNormalIlluminance = detail::EpwNumber(directNormalIlluminance, value);
   return true;
 }
 
 boost::optional<double> EpwDataPoint::diffuseHorizontalIlluminance() const {
-  if (m_diffuseHorizontalIlluminance == "999999") {
+  if (m_diffuseHorizontalIlluminance == missing999999) {
     return boost::none;
   }
-  return boost::optional<double>(std::stod(m_diffuseHorizontalIlluminance));
+  return boost::optional<double>(m_diffuseHorizontalIlluminance.value());
 }
 
 bool EpwDataPoint::setDiffuseHorizontalIlluminance(double value) {
   if (0 > value || 999900 < value) {
-    m_diffuseHorizontalIlluminance = "999999";
+    m_diffuseHorizontalIlluminance = missing999999;
     return false;
   }
   m_diffuseHorizontalIlluminance = std::to_string(value);
@@ -2065,23 +2226,23 @@ bool EpwDataPoint::setDiffuseHorizontalIlluminance(const std::string& diffuseHor
   bool ok;
   double value = stringToDouble(diffuseHorizontalIlluminance, &ok);
   if (!ok || 0 > value || 999900 < value) {
-    m_diffuseHorizontalIlluminance = "999999";
+    m_diffuseHorizontalIlluminance = missing999999;
     return false;
   }
-  m_diffuseHorizontalIlluminance = diffuseHorizontalIlluminance;
+  m_diffuseHorizontalIlluminance = detail::EpwNumber(diffuseHorizontalIlluminance, value);
   return true;
 }
 
 boost::optional<double> EpwDataPoint::zenithLuminance() const {
-  if (m_zenithLuminance == "9999") {
+  if (m_zenithLuminance == missing9999) {
     return boost::none;
   }
-  return boost::optional<double>(std::stod(m_zenithLuminance));
+  return boost::optional<double>(m_zenithLuminance.value());
 }
 
 bool EpwDataPoint::setZenithLuminance(double value) {
   if (0 > value || 9999 <= value) {
-    m_zenithLuminance = "9999";
+    m_zenithLuminance = missing9999;
     return false;
   }
   m_zenithLuminance = std::to_string(value);
@@ -2092,23 +2253,23 @@ bool EpwDataPoint::setZenithLuminance(const std::string& zenithLuminance) {
   bool ok;
   double value = stringToDouble(zenithLuminance, &ok);
   if (!ok || 0 > value || 9999 <= value) {
-    m_zenithLuminance = "9999";
+    m_zenithLuminance = missing9999;
     return false;
   }
-  m_zenithLuminance = zenithLuminance;
+  m_zenithLuminance = detail::EpwNumber(zenithLuminance, value);
   return true;
 }
 
 boost::optional<double> EpwDataPoint::windDirection() const {
-  if (m_windDirection == "999") {
+  if (m_windDirection == missing999) {
     return boost::none;
   }
-  return boost::optional<double>(std::stod(m_windDirection));
+  return boost::optional<double>(m_windDirection.value());
 }
 
 bool EpwDataPoint::setWindDirection(double value) {
   if (0 > value || 360 < value) {
-    m_windDirection = "999";
+    m_windDirection = missing999;
     return false;
   }
   m_windDirection = std::to_string(value);
@@ -2119,23 +2280,23 @@ bool EpwDataPoint::setWindDirection(const std::string& windDirection) {
   bool ok;
   double value = stringToDouble(windDirection, &ok);
   if (!ok || 0 > value || 360 < value) {
-    m_windDirection = "999";
+    m_windDirection = missing999;
     return false;
   }
-  m_windDirection = windDirection;
+  m_windDirection = detail::EpwNumber(windDirection, value);
   return true;
 }
 
 boost::optional<double> EpwDataPoint::windSpeed() const {
-  if (m_windSpeed == "999") {
+  if (m_windSpeed == missing999) {
     return boost::none;
   }
-  return boost::optional<double>(std::stod(m_windSpeed));
+  return boost::optional<double>(m_windSpeed.value());
 }
 
 bool EpwDataPoint::setWindSpeed(double value) {
   if (0 > value) {
-    m_windSpeed = "999";
+    m_windSpeed = missing999;
     return false;
   } else if (40 < value) {
     LOG_FREE(Warn, "openstudio.EpwFile", "WindSpeed value '" << value << "' not within the expected limits");
@@ -2148,7 +2309,7 @@ bool EpwDataPoint::setWindSpeed(const std::string& windSpeed) {
   bool ok;
   double value = stringToDouble(windSpeed, &ok);
   if (!ok || 0 > value) {
-    m_windSpeed = "999";
+    m_windSpeed = missing999;
     return false;
   } else if (40 < value) {
     LOG_FREE(Warn, "openstudio.EpwFile", "WindSpeed value '" << value << "' not within the expected limits");
@@ -2203,15 +2364,15 @@ bool EpwDataPoint::setOpaqueSkyCover(const std::string& opaqueSkyCover) {
 }
 
 boost::optional<double> EpwDataPoint::visibility() const {
-  if (m_visibility == "9999") {
+  if (m_visibility == missing9999) {
     return boost::none;
   }
-  return boost::optional<double>(std::stod(m_visibility));
+  return boost::optional<double>(m_visibility.value());
 }
 
 bool EpwDataPoint::setVisibility(double value) {
   if (value == 9999) {
-    m_visibility = "9999";
+    m_visibility = missing9999;
     return false;
   }
   m_visibility = std::to_string(value);
@@ -2222,18 +2383,18 @@ bool EpwDataPoint::setVisibility(const std::string& visibility) {
   bool ok;
   double value = stringToDouble(visibility, &ok);
   if (!ok || value == 9999) {
-    m_visibility = "9999";
+    m_visibility = missing9999;
     return false;
   }
-  m_visibility = visibility;
+  m_visibility = detail::EpwNumber(visibility, value);
   return true;
 }
 
 boost::optional<double> EpwDataPoint::ceilingHeight() const {
-  if (m_ceilingHeight == "99999") {
+  if (m_ceilingHeight == missing99999) {
     return boost::none;
   }
-  return boost::optional<double>(std::stod(m_ceilingHeight));
+  return boost::optional<double>(m_ceilingHeight.value());
 }
 
 void EpwDataPoint::setCeilingHeight(double ceilingHeight) {
@@ -2244,10 +2405,10 @@ bool EpwDataPoint::setCeilingHeight(const std::string& ceilingHeight) {
   bool ok;
   double value = stringToDouble(ceilingHeight, &ok);
   if (!ok || value == 99999) {
-    m_ceilingHeight = "99999";
+    m_ceilingHeight = missing99999;
     return false;
   }
-  m_ceilingHeight = ceilingHeight;
+  m_ceilingHeight = detail::EpwNumber(ceilingHeight, value);
   return true;
 }
 
@@ -2288,10 +2449,10 @@ bool EpwDataPoint::setPresentWeatherCodes(const std::string& presentWeatherCodes
 }
 
 boost::optional<double> EpwDataPoint::precipitableWater() const {
-  if (m_precipitableWater == "999") {
+  if (m_precipitableWater == missing999) {
     return boost::none;
   }
-  return boost::optional<double>(std::stod(m_precipitableWater));
+  return boost::optional<double>(m_precipitableWater.value());
 }
 
 void EpwDataPoint::setPrecipitableWater(double precipitableWater) {
@@ -2302,18 +2463,18 @@ bool EpwDataPoint::setPrecipitableWater(const std::string& precipitableWater) {
   bool ok;
   double value = stringToDouble(precipitableWater, &ok);
   if (!ok || value == 999) {
-    m_precipitableWater = "999";
+    m_precipitableWater = missing999;
     return false;
   }
-  m_precipitableWater = precipitableWater;
+  m_precipitableWater = detail::EpwNumber(precipitableWater, value);
   return true;
 }
 
 boost::optional<double> EpwDataPoint::aerosolOpticalDepth() const {
-  if (m_aerosolOpticalDepth == ".999") {
+  if (m_aerosolOpticalDepth == missingPt999) {
     return boost::none;
   }
-  return boost::optional<double>(std::stod(m_aerosolOpticalDepth));
+  return boost::optional<double>(m_aerosolOpticalDepth.value());
 }
 
 void EpwDataPoint::setAerosolOpticalDepth(double aerosolOpticalDepth) {
@@ -2324,18 +2485,18 @@ bool EpwDataPoint::setAerosolOpticalDepth(const std::string& aerosolOpticalDepth
   bool ok;
   double value = stringToDouble(aerosolOpticalDepth, &ok);
   if (!ok || value == 0.999) {
-    m_aerosolOpticalDepth = ".999";
+    m_aerosolOpticalDepth = missingPt999;
     return false;
   }
-  m_aerosolOpticalDepth = aerosolOpticalDepth;
+  m_aerosolOpticalDepth = detail::EpwNumber(aerosolOpticalDepth, value);
   return true;
 }
 
 boost::optional<double> EpwDataPoint::snowDepth() const {
-  if (m_snowDepth == "999") {
+  if (m_snowDepth == missing999) {
     return boost::none;
   }
-  return boost::optional<double>(std::stod(m_snowDepth));
+  return boost::optional<double>(m_snowDepth.value());
 }
 
 void EpwDataPoint::setSnowDepth(double snowDepth) {
@@ -2346,18 +2507,18 @@ bool EpwDataPoint::setSnowDepth(const std::string& snowDepth) {
   bool ok;
   double value = stringToDouble(snowDepth, &ok);
   if (!ok || value == 999) {
-    m_snowDepth = "999";
+    m_snowDepth = missing999;
     return false;
   }
-  m_snowDepth = snowDepth;
+  m_snowDepth = detail::EpwNumber(snowDepth, value);
   return true;
 }
 
 boost::optional<double> EpwDataPoint::daysSinceLastSnowfall() const {
-  if (m_daysSinceLastSnowfall == "99") {
+  if (m_daysSinceLastSnowfall == missing99) {
     return boost::none;
   }
-  return boost::optional<double>(std::stod(m_daysSinceLastSnowfall));
+  return boost::optional<double>(m_daysSinceLastSnowfall.value());
 }
 
 void EpwDataPoint::setDaysSinceLastSnowfall(double daysSinceLastSnowfall) {
@@ -2368,18 +2529,18 @@ bool EpwDataPoint::setDaysSinceLastSnowfall(const std::string& daysSinceLastSnow
   bool ok;
   double value = stringToDouble(daysSinceLastSnowfall, &ok);
   if (!ok || value == 99) {
-    m_daysSinceLastSnowfall = "99";
+    m_daysSinceLastSnowfall = missing99;
     return false;
   }
-  m_daysSinceLastSnowfall = daysSinceLastSnowfall;
+  m_daysSinceLastSnowfall = detail::EpwNumber(daysSinceLastSnowfall, value);
   return true;
 }
 
 boost::optional<double> EpwDataPoint::albedo() const {
-  if (m_albedo == "999") {
+  if (m_albedo == missing999) {
     return boost::none;
   }
-  return boost::optional<double>(std::stod(m_albedo));
+  return boost::optional<double>(m_albedo.value());
 }
 
 void EpwDataPoint::setAlbedo(double albedo) {
@@ -2390,18 +2551,18 @@ bool EpwDataPoint::setAlbedo(const std::string& albedo) {
   bool ok;
   double value = stringToDouble(albedo, &ok);
   if (!ok || value == 999) {
-    m_albedo = "999";
+    m_albedo = missing999;
     return false;
   }
-  m_albedo = albedo;
+  m_albedo = detail::EpwNumber(albedo, value);
   return true;
 }
 
 boost::optional<double> EpwDataPoint::liquidPrecipitationDepth() const {
-  if (m_liquidPrecipitationDepth == "999") {
+  if (m_liquidPrecipitationDepth == missing999) {
     return boost::none;
   }
-  return boost::optional<double>(std::stod(m_liquidPrecipitationDepth));
+  return boost::optional<double>(m_liquidPrecipitationDepth.value());
 }
 
 void EpwDataPoint::setLiquidPrecipitationDepth(double liquidPrecipitationDepth) {
@@ -2412,18 +2573,18 @@ bool EpwDataPoint::setLiquidPrecipitationDepth(const std::string& liquidPrecipit
   bool ok;
   double value = stringToDouble(liquidPrecipitationDepth, &ok);
   if (!ok || value == 999) {
-    m_liquidPrecipitationDepth = "999";
+    m_liquidPrecipitationDepth = missing999;
     return false;
   }
-  m_liquidPrecipitationDepth = liquidPrecipitationDepth;
+  m_liquidPrecipitationDepth = detail::EpwNumber(liquidPrecipitationDepth, value);
   return true;
 }
 
 boost::optional<double> EpwDataPoint::liquidPrecipitationQuantity() const {
-  if (m_liquidPrecipitationQuantity == "99") {
+  if (m_liquidPrecipitationQuantity == missing99) {
     return boost::none;
   }
-  return boost::optional<double>(std::stod(m_liquidPrecipitationQuantity));
+  return boost::optional<double>(m_liquidPrecipitationQuantity.value());
 }
 
 void EpwDataPoint::setLiquidPrecipitationQuantity(double liquidPrecipitationQuantity) {
@@ -2434,10 +2595,10 @@ bool EpwDataPoint::setLiquidPrecipitationQuantity(const std::string& liquidPreci
   bool ok;
   double value = stringToDouble(liquidPrecipitationQuantity, &ok);
   if (!ok || value == 99) {
-    m_liquidPrecipitationQuantity = "99";
+    m_liquidPrecipitationQuantity = missing99;
     return false;
   }
-  m_liquidPrecipitationQuantity = liquidPrecipitationQuantity;
+  m_liquidPrecipitationQuantity = detail::EpwNumber(liquidPrecipitationQuantity, value);
   return true;
 }
 
@@ -2653,7 +2814,70 @@ std::vector<EpwDataPoint> EpwFile::data() {
       ifs.close();
     }
   }
-  return m_data;
+  std::vector<EpwDataPoint> result;
+  result.reserve(m_data.size());
+  for (std::size_t i = 0; i < m_data.size(); ++i) {
+    result.push_back(dataPoint(i));
+  }
+  return result;
+}
+
+std::size_t EpwFile::DataColumns::size() const {
+  return flags.size();
+}
+
+bool EpwFile::DataColumns::empty() const {
+  return flags.empty();
+}
+
+DateTime EpwFile::DataColumns::dateTime(std::size_t row) const {
+  // same as EpwDataPoint::dateTime
+  Date date(MonthOfYear(static_cast<int>(values[EpwDataField::Month][row])), static_cast<unsigned>(values[EpwDataField::Day][row]),
+            static_cast<int>(values[EpwDataField::Year][row]));
+  Time time(0, static_cast<int>(values[EpwDataField::Hour][row]), static_cast<int>(values[EpwDataField::Minute][row]));
+  return {date, time};
+}
+
+void EpwFile::appendData(EpwDataPoint point) {
+  const std::size_t row = m_data.size();
+
+  auto [it, inserted] = m_data.flagIndex.emplace(point.m_dataSourceandUncertaintyFlags, static_cast<unsigned>(m_data.flagValues.size()));
+  if (inserted) {
+    m_data.flagValues.push_back(point.m_dataSourceandUncertaintyFlags);
+  }
+  m_data.flags.push_back(it->second);
+
+  for (const auto& [field, member] : EpwDataPoint::integerMembers()) {
+    m_data.values[field].push_back(point.*member);
+  }
+  for (const auto& [field, member] : EpwDataPoint::numberMembers()) {
+    const detail::EpwNumber& number = point.*member;
+    m_data.values[field].push_back(number.value());
+    m_data.formats[field].push_back(number.format());
+    if (number.verbatimText()) {
+      m_data.verbatimTexts.emplace(row * DataColumns::numFields + field, number.verbatimText());
+    }
+  }
+  for (std::size_t field = 0; field < DataColumns::numFields; ++field) {
+    m_data.missing[field].push_back(!point.getField(EpwDataField(static_cast<int>(field))));
+  }
+}
+
+EpwDataPoint EpwFile::dataPoint(std::size_t row) const {
+  EpwDataPoint point;
+  point.m_dataSourceandUncertaintyFlags = m_data.flagValues[m_data.flags[row]];
+  for (const auto& [field, member] : EpwDataPoint::integerMembers()) {
+    point.*member = static_cast<int>(m_data.values[field][row]);
+  }
+  for (const auto& [field, member] : EpwDataPoint::numberMembers()) {
+    const std::uint8_t format = m_data.formats[field][row];
+    std::shared_ptr<const std::string> verbatimText;
+    if (format == detail::EpwNumber::verbatimFormat) {
+      verbatimText = m_data.verbatimTexts.at(row * DataColumns::numFields + field);
+    }
+    point.*member = detail::EpwNumber(m_data.values[field][row], format, std::move(verbatimText));
+  }
+  return point;
 }
 
 std::string EpwDesignCondition::titleOfDesignCondition() const {
@@ -3661,18 +3885,18 @@ boost::optional<TimeSeries> EpwFile::getTimeSeries(const std::string& name) {
     DateTimeVector dates;
     dates.push_back(DateTime());  // Use a placeholder to avoid an insert
     std::vector<double> values;
-    for (unsigned int i = 0; i < m_data.size(); i++) {
-      DateTime dateTime = m_data[i].dateTime();
-      // Time time=m_data[i].time();
-      boost::optional<double> value = m_data[i].getField(id);
-      if (value) {
+    const std::vector<double>& fieldValues = m_data.values[id.value()];
+    const std::vector<bool>& fieldMissing = m_data.missing[id.value()];
+    for (std::size_t i = 0; i < m_data.size(); i++) {
+      if (!fieldMissing[i]) {
+        DateTime dateTime = m_data.dateTime(i);
         if (isActual()) {
           dates.push_back(DateTime(dateTime));
         } else {
           // Strip year
           dates.push_back(DateTime(Date(dateTime.date().monthOfYear(), dateTime.date().dayOfMonth()), dateTime.time()));
         }
-        values.push_back(value.get());
+        values.push_back(fieldValues[i]);
       }
     }
     if (!values.empty()) {
@@ -3738,10 +3962,11 @@ boost::optional<TimeSeries> EpwFile::getComputedTimeSeries(const std::string& na
   DateTimeVector dates;
   dates.push_back(DateTime());  // Use a placeholder to avoid an insert
   std::vector<double> values;
-  for (unsigned int i = 0; i < m_data.size(); i++) {
-    Date date = m_data[i].date();
-    Time time = m_data[i].time();
-    boost::optional<double> value = (m_data[i].*compute)();
+  for (std::size_t i = 0; i < m_data.size(); i++) {
+    EpwDataPoint point = dataPoint(i);
+    Date date = point.date();
+    Time time = point.time();
+    boost::optional<double> value = (point.*compute)();
     if (value) {
       dates.push_back(DateTime(date, time));
       values.push_back(value.get());
@@ -3779,7 +4004,8 @@ bool EpwFile::translateToWth(openstudio::path path, std::string description) {
     description = "Translated from " + openstudio::toString(this->path());
   }
 
-  if (data().empty()) {
+  const std::vector<EpwDataPoint> points = data();
+  if (points.empty()) {
     LOG(Error, "EPW file contains no data to translate");
     return false;
   }
@@ -3806,9 +4032,9 @@ bool EpwFile::translateToWth(openstudio::path path, std::string description) {
   }
 
   // Cheat to get data at the start time - this will need to change
-  openstudio::EpwDataPoint lastPt = data()[data().size() - 1];
+  const openstudio::EpwDataPoint& lastPt = points.back();
   std::vector<std::string> epwstrings = lastPt.toEpwStrings();
-  openstudio::DateTime dateTime = data()[0].dateTime();
+  openstudio::DateTime dateTime = points.front().dateTime();
   openstudio::Time dt = timeStep();
   dateTime -= dt;
   epwstrings[0] = std::to_string(dateTime.date().year());
@@ -3830,8 +4056,8 @@ bool EpwFile::translateToWth(openstudio::path path, std::string description) {
     return false;
   }
   fp << output.get() << '\n';
-  for (unsigned int i = 0; i < data().size(); i++) {
-    output = data()[i].toWthString();
+  for (unsigned int i = 0; i < points.size(); i++) {
+    output = points[i].toWthString();
     if (!output) {
       LOG(Error, "Translation to WTH has failed on data point " << i);
       fp.close();
@@ -3950,7 +4176,7 @@ bool EpwFile::parse(std::istream& ifs, bool storeData) {
           }
           boost::optional<EpwDataPoint> pt = EpwDataPoint::fromEpwStrings(year, month, day, hour, currentMinute, strings);
           if (pt) {
-            m_data.push_back(pt.get());
+            appendData(std::move(pt.get()));
           } else {
             LOG(Error, "Failed to parse line " << lineNumber << " of EPW file '" << m_path << "'");
             return false;
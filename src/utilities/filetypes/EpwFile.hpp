@@ -16,6 +16,12 @@
 #include "../time/DateTime.hpp"
 #include "../data/TimeSeries.hpp"
 
+#include <array>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <unordered_map>
+
 namespace openstudio {
 
 // forward declaration
@@ -200,8 +206,57 @@ OPENSTUDIO_ENUM(EpwDesignField,
 
 // clang-format on
 
-/** EpwDataPoint is one line from the EPW file. All floating point numbers are stored as strings,
- * but are checked as numbers.
+namespace detail {
+
+  /** EpwNumber is a floating point field of an EpwDataPoint. It stores the number along with the format of the text it was
+   *  set from, so that the text can be written back exactly without being kept around. Text the format can not describe
+   *  (exponents, leading zeros, more than 15 digits, ...) is kept as is. */
+  class UTILITIES_API EpwNumber
+  {
+   public:
+    /** Format of text that has to be kept as is. */
+    static constexpr std::uint8_t verbatimFormat = 0xFF;
+
+    EpwNumber() = default;
+    /** Same as EpwNumber(text, std::stod(text)), but NaN if text is not a number. */
+    EpwNumber(const std::string& text);
+    EpwNumber(const char* text);
+    /** Takes value as the result of std::stod(text). */
+    EpwNumber(const std::string& text, double value);
+    /** Reassembles a number from value(), format() and verbatimText() of another. */
+    EpwNumber(double value, std::uint8_t format, std::shared_ptr<const std::string> verbatimText);
+
+    /** Returns std::stod(text()), without parsing. */
+    double value() const {
+      return m_value;
+    }
+
+    /** Returns the text the number was set from. */
+    std::string text() const;
+
+    std::uint8_t format() const {
+      return m_format;
+    }
+
+    /** Returns the text if format() is verbatimFormat, nullptr otherwise. */
+    const std::shared_ptr<const std::string>& verbatimText() const {
+      return m_verbatimText;
+    }
+
+    /** Returns true if the texts are equal. */
+    bool operator==(const EpwNumber& other) const;
+    bool operator!=(const EpwNumber& other) const;
+
+   private:
+    double m_value = 0.0;
+    std::uint8_t m_format = 0;
+    std::shared_ptr<const std::string> m_verbatimText;
+  };
+
+}  // namespace detail
+
+/** EpwDataPoint is one line from the EPW file. All floating point numbers are stored as numbers along with the format
+ * of their text, see detail::EpwNumber, and are written back as read.
  */
 class UTILITIES_API EpwDataPoint
 {
@@ -343,6 +398,12 @@ class UTILITIES_API EpwDataPoint
   boost::optional<double> wetbulb() const;
 
  private:
+  friend class EpwFile;
+
+  // Numeric members by EpwDataField, used by EpwFile to store data by field
+  static const std::vector<std::pair<int, detail::EpwNumber EpwDataPoint::*>>& numberMembers();
+  static const std::vector<std::pair<int, int EpwDataPoint::*>>& integerMembers();
+
   // One billion setters
   void setDate(Date date);
   void setTime(Time time);
@@ -423,35 +484,35 @@ class UTILITIES_API EpwDataPoint
   int m_hour;
   int m_minute;
   std::string m_dataSourceandUncertaintyFlags;
-  std::string m_dryBulbTemperature;                     // units C, minimum> -70, maximum< 70, missing 99.9
-  std::string m_dewPointTemperature;                    // units C, minimum> -70, maximum< 70, missing 99.9
-  std::string m_relativeHumidity;                       // missing 999., minimum 0, maximum 110
-  std::string m_atmosphericStationPressure;             // units Pa, missing 999999.,  minimum> 31000, maximum< 120000
-  std::string m_extraterrestrialHorizontalRadiation;    // units Wh/m2, missing 9999., minimum 0
-  std::string m_extraterrestrialDirectNormalRadiation;  //units Wh/m2, missing 9999., minimum 0
-  std::string m_horizontalInfraredRadiationIntensity;   // units Wh/m2, missing 9999., minimum 0
-  std::string m_globalHorizontalRadiation;              // units Wh/m2, missing 9999., minimum 0
-  std::string m_directNormalRadiation;                  // units Wh/m2, missing 9999., minimum 0
-  std::string m_diffuseHorizontalRadiation;             // units Wh/m2, missing 9999., minimum 0
-  std::string m_globalHorizontalIlluminance;            // units lux, missing 999999., will be missing if >= 999900, minimum 0
-  std::string m_directNormalIlluminance;                // units lux, missing 999999., will be missing if >= 999900, minimum 0
-  std::string m_diffuseHorizontalIlluminance;           // units lux, missing 999999., will be missing if >= 999900, minimum 0
-  std::string m_zenithLuminance;                        // units Cd/m2, missing 9999., will be missing if >= 9999, minimum 0
-  std::string m_windDirection;                          // units degrees, missing 999., minimum 0, maximum 360
-  std::string m_windSpeed;                              // units m/s, missing 999., minimum 0, maximum 40
-  int m_totalSkyCover;                                  // missing 99, minimum 0, maximum 10
-  int m_opaqueSkyCover;                                 // used if Horizontal IR Intensity missing, missing 99, minimum 0, maximum 10
-  std::string m_visibility;                             // units km, missing 9999
-  std::string m_ceilingHeight;                          // units m, missing 99999
+  detail::EpwNumber m_dryBulbTemperature;                     // units C, minimum> -70, maximum< 70, missing 99.9
+  detail::EpwNumber m_dewPointTemperature;                    // units C, minimum> -70, maximum< 70, missing 99.9
+  detail::EpwNumber m_relativeHumidity;                       // missing 999., minimum 0, maximum 110
+  detail::EpwNumber m_atmosphericStationPressure;             // units Pa, missing 999999.,  minimum> 31000, maximum< 120000
+  detail::EpwNumber m_extraterrestrialHorizontalRadiation;    // units Wh/m2, missing 9999., minimum 0
+  detail::EpwNumber m_extraterrestrialDirectNormalRadiation;  //units Wh/m2, missing 9999., minimum 0
+  detail::EpwNumber m_horizontalInfraredRadiationIntensity;   // units Wh/m2, missing 9999., minimum 0
+  detail::EpwNumber m_globalHorizontalRadiation;              // units Wh/m2, missing 9999., minimum 0
+  detail::EpwNumber m_directNormalRadiation;                  // units Wh/m2, missing 9999., minimum 0
+  detail::EpwNumber m_diffuseHorizontalRadiation;             // units Wh/m2, missing 9999., minimum 0
+  detail::EpwNumber m_globalHorizontalIlluminance;            // units lux, missing 999999., will be missing if >= 999900, minimum 0
+  detail::EpwNumber m_directNormalIlluminance;                // units lux, missing 999999., will be missing if >= 999900, minimum 0
+  detail::EpwNumber m_diffuseHorizontalIlluminance;           // units lux, missing 999999., will be missing if >= 999900, minimum 0
+  detail::EpwNumber m_zenithLuminance;                        // units Cd/m2, missing 9999., will be missing if >= 9999, minimum 0
+  detail::EpwNumber m_windDirection;                          // units degrees, missing 999., minimum 0, maximum 360
+  detail::EpwNumber m_windSpeed;                              // units m/s, missing 999., minimum 0, maximum 40
+  int m_totalSkyCover;                                        // missing 99, minimum 0, maximum 10
+  int m_opaqueSkyCover;                                       // used if Horizontal IR Intensity missing, missing 99, minimum 0, maximum 10
+  detail::EpwNumber m_visibility;                             // units km, missing 9999
+  detail::EpwNumber m_ceilingHeight;                          // units m, missing 99999
   int m_presentWeatherObservation;
   int m_presentWeatherCodes;
-  std::string m_precipitableWater;            // units mm, missing 999
-  std::string m_aerosolOpticalDepth;          // units thousandths, missing .999
-  std::string m_snowDepth;                    // units cm, missing 999
-  std::string m_daysSinceLastSnowfall;        // missing 99
-  std::string m_albedo;                       //missing 999
-  std::string m_liquidPrecipitationDepth;     // units mm, missing 999
-  std::string m_liquidPrecipitationQuantity;  // units hr, missing 99
+  detail::EpwNumber m_precipitableWater;            // units mm, missing 999
+  detail::EpwNumber m_aerosolOpticalDepth;          // units thousandths, missing .999
+  detail::EpwNumber m_snowDepth;                    // units cm, missing 999
+  detail::EpwNumber m_daysSinceLastSnowfall;        // missing 99
+  detail::EpwNumber m_albedo;                       //missing 999
+  detail::EpwNumber m_liquidPrecipitationDepth;     // units mm, missing 999
+  detail::EpwNumber m_liquidPrecipitationQuantity;  // units hr, missing 99
 };
 
 class UTILITIES_API EpwHoliday
@@ -946,6 +1007,30 @@ class UTILITIES_API EpwFile
   bool parseDataPeriod(const std::string& line);
   bool parseHolidaysDaylightSavings(const std::string& line);
 
+  // Weather data stored by field, each field is parsed once on load and read from here by data() and the time series
+  struct DataColumns
+  {
+    static constexpr std::size_t numFields = 35;
+
+    std::size_t size() const;
+    bool empty() const;
+    DateTime dateTime(std::size_t row) const;
+
+    // Distinct data source and uncertainty flags, and the index of each row's flags into them
+    std::vector<std::string> flagValues;
+    std::unordered_map<std::string, unsigned> flagIndex;
+    std::vector<unsigned> flags;
+    // By EpwDataField, values of all other fields and where getField is empty
+    std::array<std::vector<double>, numFields> values;
+    std::array<std::vector<bool>, numFields> missing;
+    // By EpwDataField, formats of the floating point fields, and texts of those with the verbatim format by row * numFields + field
+    std::array<std::vector<std::uint8_t>, numFields> formats;
+    std::map<std::size_t, std::shared_ptr<const std::string>> verbatimTexts;
+  };
+
+  void appendData(EpwDataPoint point);
+  EpwDataPoint dataPoint(std::size_t row) const;
+
   // configure logging
   REGISTER_LOGGER("openstudio.EpwFile");
 
@@ -966,7 +1051,7 @@ class UTILITIES_API EpwFile
   Date m_endDate;
   boost::optional<int> m_startDateActualYear;
   boost::optional<int> m_endDateActualYear;
-  std::vector<EpwDataPoint> m_data;
+  DataColumns m_data;
   std::vector<EpwDesignCondition> m_designs;
 
   bool m_leapYearObserved;
@@ -117,6 +117,8 @@
 %template(OptionalStandardsJSON) boost::optional<openstudio::StandardsJSON>;
 
 %include <utilities/filetypes/CSVFile.hpp>
+// storage detail of EpwDataPoint
+%ignore openstudio::detail::EpwNumber;
 %include <utilities/filetypes/EpwFile.hpp>
 %include <utilities/filetypes/RunOptions.hpp>
 %include <utilities/filetypes/ForwardTranslatorOptions.hpp>
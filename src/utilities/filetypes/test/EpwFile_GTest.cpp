@@ -8,9 +8,12 @@
 #include "../../time/Time.hpp"
 #include "../../time/Date.hpp"
 #include "../../core/Checksum.hpp"
+#include "../../core/StringHelpers.hpp"
 
 #include <resources.hxx>
 
+#include <fstream>
+
 using namespace openstudio;
 
 TEST(Filetypes, EpwFile) {
@@ -780,6 +783,60 @@ TEST(Filetypes, EpwFile_DataPoint) {
   }
 }
 
+TEST(Filetypes, EpwFile_Data_RoundTrip) {
+  path p = resourcesPath() / toPath("utilities/Filetypes/USA_CO_Golden-NREL.724666_TMY3.epw");
+  EpwFile epwFile(p);
+  std::vector<EpwDataPoint> data = epwFile.data();
+  ASSERT_EQ(8760, data.size());
+
+  // Points handed out by the file write the same text as points made straight from the lines of the file
+  std::ifstream ifs(openstudio::toSystemFilename(p));
+  std::string line;
+  for (unsigned i = 0; i < 8; ++i) {
+    ASSERT_TRUE(std::getline(ifs, line));
+  }
+  for (const EpwDataPoint& point : data) {
+    ASSERT_TRUE(std::getline(ifs, line));
+    std::vector<std::string> strings = splitString(line, ',');
+    boost::optional<EpwDataPoint> expected = EpwDataPoint::fromEpwStrings(strings);
+    ASSERT_TRUE(expected);
+    std::vector<std::string> epwStrings = point.toEpwStrings();
+    EXPECT_EQ(expected->toEpwStrings(), epwStrings);
+    // Dry bulb, dew point and precipitable water are written as read
+    EXPECT_EQ(strings[EpwDataField::DryBulbTemperature], epwStrings[EpwDataField::DryBulbTemperature]);
+    EXPECT_EQ(strings[EpwDataField::DewPointTemperature], epwStrings[EpwDataField::DewPointTemperature]);
+    EXPECT_EQ(strings[EpwDataField::PrecipitableWater], epwStrings[EpwDataField::PrecipitableWater]);
+  }
+
+  // Time series values and gaps match the data points
+  for (const std::string field : {"Dry Bulb Temperature", "Liquid Precipitation Depth", "Total Sky Cover"}) {
+    boost::optional<TimeSeries> series = epwFile.getTimeSeries(field);
+    ASSERT_TRUE(series);
+    std::vector<double> expected;
+    for (EpwDataPoint& point : data) {
+      if (boost::optional<double> value = point.getFieldByName(field)) {
+        expected.push_back(value.get());
+      }
+    }
+    Vector values = series->values();
+    ASSERT_EQ(expected.size(), values.size());
+    for (unsigned i = 0; i < expected.size(); ++i) {
+      EXPECT_EQ(expected[i], values[i]);
+    }
+  }
+  EXPECT_FALSE(epwFile.getTimeSeries("Year"));
+
+  // Text that does not look like a plain decimal number is kept as is
+  std::vector<std::string> strings = data[0].toEpwStrings();
+  for (const std::string text : {"1.50E1", "-.5", "7."}) {
+    strings[EpwDataField::DryBulbTemperature] = text;
+    boost::optional<EpwDataPoint> point = EpwDataPoint::fromEpwStrings(strings);
+    ASSERT_TRUE(point);
+    EXPECT_EQ(std::stod(text), point->dryBulbTemperature().get());
+    EXPECT_EQ(text, point->toEpwStrings()[EpwDataField::DryBulbTemperature]);
+  }
+}
+
 TEST(Filetypes, EpwFile_parseDataPeriods) {
 
   // I would construct an empty EpwFile to call parseDataPeriods but I can't since it's a private Ctor, and the method itself is private...
@@ -9,29 +9,10 @@
 namespace openstudio {
 
 /// default constructor creates point at 0, 0, 0
-Point3d::Point3d() : m_storage(3, 0.0) {}
+Point3d::Point3d() : m_storage{0.0, 0.0, 0.0} {}
 
 /// constructor with x, y, z
-Point3d::Point3d(double x, double y, double z) : m_storage(3) {
-  m_storage[0] = x;
-  m_storage[1] = y;
-  m_storage[2] = z;
-}
-
-/// get x
-double Point3d::x() const {
-  return m_storage[0];
-}
-
-/// get y
-double Point3d::y() const {
-  return m_storage[1];
-}
-
-/// get z
-double Point3d::z() const {
-  return m_storage[2];
-}
+Point3d::Point3d(double x, double y, double z) : m_storage{x, y, z} {}
 
 /// point plus a vector is a new point
 Point3d Point3d::operator+(const Vector3d& vec) const {
@@ -10,6 +10,7 @@
 #include "../data/Vector.hpp"
 #include "../core/Logger.hpp"
 
+#include <array>
 #include <vector>
 #include <boost/optional.hpp>
 
@@ -35,13 +36,19 @@ class UTILITIES_API Point3d
   // ~Point3d() noexcept = default;
 
   /// get x
-  double x() const;
+  double x() const {
+    return m_storage[0];
+  }
 
   /// get y
-  double y() const;
+  double y() const {
+    return m_storage[1];
+  }
 
   /// get z
-  double z() const;
+  double z() const {
+    return m_storage[2];
+  }
 
   /// point plus a vector is a new point
   Point3d operator+(const Vector3d& vec) const;
@@ -60,7 +67,7 @@ class UTILITIES_API Point3d
 
  private:
   REGISTER_LOGGER("utilities.Point3d");
-  Vector m_storage;
+  std::array<double, 3> m_storage;
 };
 
 /// ostream operator
@@ -558,3 +558,36 @@ TEST_F(GeometryFixture, Transformation_Decompose) {
 
   EXPECT_TRUE(transformation.matrix() == test.matrix()) << transformation.matrix() << '\n' << test.matrix();
 }
+
+TEST_F(GeometryFixture, Transformation_Vector) {
+  Transformation transformation = Transformation::translation(Vector3d(1, 2, 3)) * Transformation::rotation(Vector3d(1, 1, 1), degToRad(30));
+
+  Transformation test(transformation.vector());
+  EXPECT_TRUE(transformation.matrix() == test.matrix()) << transformation.matrix() << '\n' << test.matrix();
+  EXPECT_TRUE(transformation.vector() == test.vector());
+}
+
+TEST_F(GeometryFixture, Transformation_PointVector) {
+  Transformation transformation = Transformation::rotation(Point3d(1, 2, 3), Vector3d(0, 1, 1), degToRad(45));
+
+  std::vector<Point3d> points;
+  std::vector<Vector3d> vectors;
+  for (unsigned i = 0; i < 10; ++i) {
+    points.emplace_back(i, 2.0 * i, -1.0 * i);
+    vectors.emplace_back(-1.0 * i, i, 0.5 * i);
+  }
+
+  std::vector<Point3d> transformedPoints = transformation * points;
+  ASSERT_EQ(points.size(), transformedPoints.size());
+  for (unsigned i = 0; i < points.size(); ++i) {
+    EXPECT_EQ(transformation * points[i], transformedPoints[i]);
+  }
+
+  std::vector<Vector3d> transformedVectors = transformation * vectors;
+  ASSERT_EQ(vectors.size(), transformedVectors.size());
+  for (unsigned i = 0; i < vectors.size(); ++i) {
+    EXPECT_EQ(transformation * vectors[i], transformedVectors[i]);
+  }
+
+  EXPECT_TRUE((transformation * std::vector<Point3d>()).empty());
+}
@@ -18,71 +18,72 @@
 
 #include <cmath>
 
-using boost::numeric::ublas::identity_matrix;
 using std::min;
 
 namespace openstudio {
 
 /// default constructor creates identity transformation
-Transformation::Transformation() : m_storage(identity_matrix<double>(4)) {}
+Transformation::Transformation() : m_storage(identityStorage()) {}
 
 /// constructor from storage, asserts matrix is 4x4
-Transformation::Transformation(const Matrix& matrix) : m_storage(matrix) {
+Transformation::Transformation(const Matrix& matrix) {
   OS_ASSERT(matrix.size1() == 4);
   OS_ASSERT(matrix.size2() == 4);
+
+  for (unsigned i = 0; i < 4; ++i) {
+    for (unsigned j = 0; j < 4; ++j) {
+      m_storage[i][j] = matrix(i, j);
+    }
+  }
 }
 
 /// constructor from storage, asserts vector is size 16
-Transformation::Transformation(const Vector& vector) : m_storage(Matrix(4, 4)) {
+Transformation::Transformation(const Vector& vector) {
   OS_ASSERT(vector.size() == 16);
 
-  m_storage(0, 0) = vector[0];
-  m_storage(1, 0) = vector[1];
-  m_storage(2, 0) = vector[2];
-  m_storage(3, 0) = vector[3];
-  m_storage(0, 1) = vector[4];
-  m_storage(1, 1) = vector[5];
-  m_storage(2, 1) = vector[6];
-  m_storage(2, 1) = vector[7];
-  m_storage(0, 2) = vector[8];
-  m_storage(1, 2) = vector[9];
-  m_storage(2, 2) = vector[10];
-  m_storage(3, 2) = vector[11];
-  m_storage(0, 3) = vector[12];
-  m_storage(1, 3) = vector[13];
-  m_storage(2, 3) = vector[14];
-  m_storage(3, 3) = vector[15];
+  // vector is column major, see vector()
+  for (unsigned i = 0; i < 4; ++i) {
+    for (unsigned j = 0; j < 4; ++j) {
+      m_storage[i][j] = vector[4 * j + i];
+    }
+  }
+}
+
+Transformation::Transformation(const Storage& storage) : m_storage(storage) {}
+
+Transformation::Storage Transformation::identityStorage() {
+  Storage result{};
+  for (unsigned i = 0; i < 4; ++i) {
+    result[i][i] = 1.0;
+  }
+  return result;
 }
 
 /// rotation about origin defined by axis and angle (radians)
 Transformation Transformation::rotation(const Vector3d& axis, double radians) {
-  Matrix storage = identity_matrix<double>(4);
+  Storage storage = identityStorage();
 
   Vector3d temp = axis;
   if (!temp.normalize()) {
     LOG(Error, "Could not normalize axis");
   }
-  Vector normalVector = temp.vector();
+  const std::array<double, 3> normalVector{temp.x(), temp.y(), temp.z()};
 
   // Rodrigues' rotation formula / Rotation matrix from Euler axis/angle
   // I*cos(radians) + I*(1-cos(radians))*axis*axis^T + Q*sin(radians)
   // Q = [0, -axis[2], axis[1]; axis[2], 0, -axis[0]; -axis[1], axis[0], 0]
-  Matrix P = outer_prod(normalVector, normalVector);
-  Matrix I = identity_matrix<double>(3);
-  Matrix Q(3, 3, 0.0);
-  Q(0, 1) = -normalVector(2);
-  Q(0, 2) = normalVector(1);
-  Q(1, 0) = normalVector(2);
-  Q(1, 2) = -normalVector(0);
-  Q(2, 0) = -normalVector(1);
-  Q(2, 1) = normalVector(0);
+  const std::array<std::array<double, 3>, 3> Q{{{0.0, -normalVector[2], normalVector[1]},
+                                                {normalVector[2], 0.0, -normalVector[0]},
+                                                {-normalVector[1], normalVector[0], 0.0}}};
+  const double cosRadians = cos(radians);
+  const double sinRadians = sin(radians);
 
   // rotation matrix
-  Matrix R = I * cos(radians) + (1 - cos(radians)) * P + Q * sin(radians);
-
   for (unsigned i = 0; i < 3; ++i) {
     for (unsigned j = 0; j < 3; ++j) {
-      storage(i, j) = R(i, j);
+      const double I = (i == j) ? 1.0 : 0.0;
+      const double P = normalVector[i] * normalVector[j];
+      storage[i][j] = I * cosRadians + (1 - cosRadians) * P + Q[i][j] * sinRadians;
     }
   }
 
@@ -106,11 +107,11 @@ Transformation Transformation::rotation(const EulerAngles& angles) {
 
 /// translation along vector
 Transformation Transformation::translation(const Vector3d& translation) {
-  Matrix storage = identity_matrix<double>(4);
+  Storage storage = identityStorage();
 
-  storage(0, 3) = translation.x();
-  storage(1, 3) = translation.y();
-  storage(2, 3) = translation.z();
+  storage[0][3] = translation.x();
+  storage[1][3] = translation.y();
+  storage[2][3] = translation.z();
 
   return Transformation(storage);
 }
@@ -147,16 +148,16 @@ Transformation Transformation::alignZPrime(const Vector3d& zPrime) {
     yp = zp.cross(xp);
   }
 
-  Matrix storage = identity_matrix<double>(4);
-  storage(0, 0) = xp.x();
-  storage(1, 0) = xp.y();
-  storage(2, 0) = xp.z();
-  storage(0, 1) = yp.x();
-  storage(1, 1) = yp.y();
-  storage(2, 1) = yp.z();
-  storage(0, 2) = zp.x();
-  storage(1, 2) = zp.y();
-  storage(2, 2) = zp.z();
+  Storage storage = identityStorage();
+  storage[0][0] = xp.x();
+  storage[1][0] = xp.y();
+  storage[2][0] = xp.z();
+  storage[0][1] = yp.x();
+  storage[1][1] = yp.y();
+  storage[2][1] = yp.z();
+  storage[0][2] = zp.x();
+  storage[1][2] = zp.y();
+  storage[2][2] = zp.z();
 
   return Transformation(storage);
 }
@@ -194,7 +195,7 @@ Transformation Transformation::alignFace(const std::vector<Point3d>& vertices) {
 /// returns a transformation which is the inverse of this
 Transformation Transformation::inverse() const {
   Matrix matrix(4, 4);
-  bool test = invert(m_storage, matrix);
+  bool test = invert(this->matrix(), matrix);
   if (!test) {
     // this should never happen
     LOG_AND_THROW("Matrix inversion failed");
@@ -204,28 +205,34 @@ Transformation Transformation::inverse() const {
 
 /// get the matrix representation directly
 Matrix Transformation::matrix() const {
-  return m_storage;
+  Matrix result(4, 4);
+  for (unsigned i = 0; i < 4; ++i) {
+    for (unsigned j = 0; j < 4; ++j) {
+      result(i, j) = m_storage[i][j];
+    }
+  }
+  return result;
 }
 
 /// get the vector representation directly
 Vector Transformation::vector() const {
   openstudio::Vector result(16);
-  result[0] = m_storage(0, 0);
-  result[1] = m_storage(1, 0);
-  result[2] = m_storage(2, 0);
-  result[3] = m_storage(3, 0);
-  result[4] = m_storage(0, 1);
-  result[5] = m_storage(1, 1);
-  result[6] = m_storage(2, 1);
-  result[7] = m_storage(3, 1);
-  result[8] = m_storage(0, 2);
-  result[9] = m_storage(1, 2);
-  result[10] = m_storage(2, 2);
-  result[11] = m_storage(3, 2);
-  result[12] = m_storage(0, 3);
-  result[13] = m_storage(1, 3);
-  result[14] = m_storage(2, 3);
-  result[15] = m_storage(3, 3);
+  result[0] = m_storage[0][0];
+  result[1] = m_storage[1][0];
+  result[2] = m_storage[2][0];
+  result[3] = m_storage[3][0];
+  result[4] = m_storage[0][1];
+  result[5] = m_storage[1][1];
+  result[6] = m_storage[2][1];
+  result[7] = m_storage[3][1];
+  result[8] = m_storage[0][2];
+  result[9] = m_storage[1][2];
+  result[10] = m_storage[2][2];
+  result[11] = m_storage[3][2];
+  result[12] = m_storage[0][3];
+  result[13] = m_storage[1][3];
+  result[14] = m_storage[2][3];
+  result[15] = m_storage[3][3];
   return result;
 }
 
@@ -234,19 +241,19 @@ EulerAngles Transformation::eulerAngles() const {
   double psi;
   double theta;
   double phi;
-  if (m_storage(2, 0) == 1.0) {
+  if (m_storage[2][0] == 1.0) {
     phi = 0;
     theta = -boost::math::constants::pi<double>() / 2.0;
-    psi = atan2(-m_storage(0, 1), -m_storage(0, 2));
-  } else if (m_storage(2, 0) == -1.0) {
+    psi = atan2(-m_storage[0][1], -m_storage[0][2]);
+  } else if (m_storage[2][0] == -1.0) {
     phi = 0;
     theta = boost::math::constants::pi<double>() / 2.0;
-    psi = atan2(m_storage(0, 1), m_storage(0, 2));
+    psi = atan2(m_storage[0][1], m_storage[0][2]);
   } else {
-    theta = -asin(m_storage(2, 0));
+    theta = -asin(m_storage[2][0]);
     // theta = pi + asin(m_storage(2,0)); // alternate solution
-    psi = atan2(m_storage(2, 1) / cos(theta), m_storage(2, 2) / cos(theta));
-    phi = atan2(m_storage(1, 0) / cos(theta), m_storage(0, 0) / cos(theta));
+    psi = atan2(m_storage[2][1] / cos(theta), m_storage[2][2] / cos(theta));
+    phi = atan2(m_storage[1][0] / cos(theta), m_storage[0][0] / cos(theta));
   }
   EulerAngles result(psi, theta, phi);
   return result;
@@ -257,7 +264,7 @@ Matrix Transformation::rotationMatrix() const {
   Matrix result(3, 3);
   for (unsigned i = 0; i < 3; ++i) {
     for (unsigned j = 0; j < 3; ++j) {
-      result(i, j) = m_storage(i, j);
+      result(i, j) = m_storage[i][j];
     }
   }
   return result;
@@ -265,30 +272,28 @@ Matrix Transformation::rotationMatrix() const {
 
 /// get the translation for the transformation, does not include rotation
 Vector3d Transformation::translation() const {
-  Vector3d result(m_storage(0, 3), m_storage(1, 3), m_storage(2, 3));
+  Vector3d result(m_storage[0][3], m_storage[1][3], m_storage[2][3]);
   return result;
 }
 
 /// apply the transformation to the point
 Point3d Transformation::operator*(const Point3d& point) const {
-  Vector temp(4);
-  temp(0) = point.x();
-  temp(1) = point.y();
-  temp(2) = point.z();
-  temp(3) = 1.0;
-  temp = prod(m_storage, temp);
-  return {temp[0], temp[1], temp[2]};
+  const Storage& m = m_storage;
+  const double x = point.x();
+  const double y = point.y();
+  const double z = point.z();
+  return {m[0][0] * x + m[0][1] * y + m[0][2] * z + m[0][3], m[1][0] * x + m[1][1] * y + m[1][2] * z + m[1][3],
+          m[2][0] * x + m[2][1] * y + m[2][2] * z + m[2][3]};
 }
 
 /// apply the transformation to the vector
 Vector3d Transformation::operator*(const Vector3d& vector) const {
-  Vector temp(4);
-  temp(0) = vector.x();
-  temp(1) = vector.y();
-  temp(2) = vector.z();
-  temp(3) = 1.0;
-  temp = prod(m_storage, temp);
-  return {temp[0], temp[1], temp[2]};
+  const Storage& m = m_storage;
+  const double x = vector.x();
+  const double y = vector.y();
+  const double z = vector.z();
+  return {m[0][0] * x + m[0][1] * y + m[0][2] * z + m[0][3], m[1][0] * x + m[1][1] * y + m[1][2] * z + m[1][3],
+          m[2][0] * x + m[2][1] * y + m[2][2] * z + m[2][3]};
 }
 
 /// apply the transformation to the BoundingBox
@@ -318,25 +323,52 @@ Plane Transformation::operator*(const Plane& plane) const {
 
 /// apply the transformation to a vector of points
 std::vector<Point3d> Transformation::operator*(const std::vector<Point3d>& points) const {
-  std::vector<Point3d> result(points.size());
-  for (unsigned i = 0; i < points.size(); ++i) {
-    result[i] = (*this) * points[i];
+  // copy the matrix to locals so the compiler can keep it in registers and vectorize the loop
+  const double m00 = m_storage[0][0], m01 = m_storage[0][1], m02 = m_storage[0][2], m03 = m_storage[0][3];
+  const double m10 = m_storage[1][0], m11 = m_storage[1][1], m12 = m_storage[1][2], m13 = m_storage[1][3];
+  const double m20 = m_storage[2][0], m21 = m_storage[2][1], m22 = m_storage[2][2], m23 = m_storage[2][3];
+
+  std::vector<Point3d> result;
+  result.reserve(points.size());
+  for (const Point3d& point : points) {
+    const double x = point.x();
+    const double y = point.y();
+    const double z = point.z();
+    result.emplace_back(m00 * x + m01 * y + m02 * z + m03, m10 * x + m11 * y + m12 * z + m13, m20 * x + m21 * y + m22 * z + m23);
   }
   return result;
 }
 
 /// apply the transformation to a vector of vector
 std::vector<Vector3d> Transformation::operator*(const std::vector<Vector3d>& vectors) const {
-  std::vector<Vector3d> result(vectors.size());
-  for (unsigned i = 0; i < vectors.size(); ++i) {
-    result[i] = (*this) * vectors[i];
+  const double m00 = m_storage[0][0], m01 = m_storage[0][1], m02 = m_storage[0][2], m03 = m_storage[0][3];
+  const double m10 = m_storage[1][0], m11 = m_storage[1][1], m12 = m_storage[1][2], m13 = m_storage[1][3];
+  const double m20 = m_storage[2][0], m21 = m_storage[2][1], m22 = m_storage[2][2], m23 = m_storage[2][3];
+
+  std::vector<Vector3d> result;
+  result.reserve(vectors.size());
+  for (const Vector3d& vector : vectors) {
+    const double x = vector.x();
+    const double y = vector.y();
+    const double z = vector.z();
+    result.emplace_back(m00 * x + m01 * y + m02 * z + m03, m10 * x + m11 * y + m12 * z + m13, m20 * x + m21 * y + m22 * z + m23);
   }
   return result;
 }
 
 /// apply the transformation to the other transformation
 Transformation Transformation::operator*(const Transformation& other) const {
-  return Transformation(prod(m_storage, other.m_storage));
+  Storage storage;
+  for (unsigned i = 0; i < 4; ++i) {
+    for (unsigned j = 0; j < 4; ++j) {
+      double t = 0.0;
+      for (unsigned k = 0; k < 4; ++k) {
+        t += m_storage[i][k] * other.m_storage[k][j];
+      }
+      storage[i][j] = t;
+    }
+  }
+  return Transformation(storage);
 }
 
 /// ostream operator
@@ -11,6 +11,7 @@
 #include "../data/Vector.hpp"
 #include "../core/Logger.hpp"
 
+#include <array>
 #include <vector>
 #include <boost/optional.hpp>
 
@@ -105,7 +106,15 @@ class UTILITIES_API Transformation
 
  private:
   REGISTER_LOGGER("utilities.Transformation");
-  Matrix m_storage;
+
+  using Storage = std::array<std::array<double, 4>, 4>;
+
+  explicit Transformation(const Storage& storage);
+
+  static Storage identityStorage();
+
+  // row major, kept inline so that applying a transformation does not allocate
+  Storage m_storage;
 };
 
 /// ostream operator
@@ -10,6 +10,7 @@
 #include "../data/Vector.hpp"
 #include "../core/Logger.hpp"
 
+#include <array>
 #include <vector>
 #include <boost/optional.hpp>
 
@@ -32,13 +33,19 @@ class UTILITIES_API Vector3d
   // ~Vector3d() noexcept = default;
 
   /// get x
-  double x() const;
+  double x() const {
+    return m_storage[0];
+  }
 
   /// get y
-  double y() const;
+  double y() const {
+    return m_storage[1];
+  }
 
   /// get z
-  double z() const;
+  double z() const {
+    return m_storage[2];
+  }
 
   /// addition
   Vector3d operator+(const Vector3d& other) const;
@@ -88,7 +95,7 @@ class UTILITIES_API Vector3d
  private:
   REGISTER_LOGGER("utilities.Vector3d");
 
-  Vector m_storage;
+  std::array<double, 3> m_storage;
 };
 
 /// ostream operator
@@ -0,0 +1,60 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#include <benchmark/benchmark.h>
+
+#include "../Transformation.hpp"
+#include "../Point3d.hpp"
+#include "../Vector3d.hpp"
+
+#include <vector>
+
+using namespace openstudio;
+
+static void BM_TransformPoints(benchmark::State& state) {
+  Transformation transformation = Transformation::rotation(Point3d(1, 2, 3), Vector3d(0, 1, 1), 0.3);
+
+  std::vector<Point3d> points;
+  for (int i = 0; i < state.range(0); ++i) {
+    points.emplace_back(i, 0.5 * i, -0.25 * i);
+  }
+
+  for (auto _ : state) {
+    std::vector<Point3d> result = transformation * points;
+    benchmark::DoNotOptimize(result);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_TransformPointsOneByOne(benchmark::State& state) {
+  Transformation transformation = Transformation::rotation(Point3d(1, 2, 3), Vector3d(0, 1, 1), 0.3);
+
+  std::vector<Point3d> points;
+  for (int i = 0; i < state.range(0); ++i) {
+    points.emplace_back(i, 0.5 * i, -0.25 * i);
+  }
+
+  for (auto _ : state) {
+    for (const Point3d& point : points) {
+      Point3d result = transformation * point;
+      benchmark::DoNotOptimize(result);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_ComposeTransformations(benchmark::State& state) {
+  Transformation rotation = Transformation::rotation(Vector3d(0, 0, 1), 0.3);
+  Transformation translation = Transformation::translation(Vector3d(1, 2, 3));
+
+  for (auto _ : state) {
+    Transformation result = translation * rotation * translation.inverse();
+    benchmark::DoNotOptimize(result);
+  }
+}
+
+BENCHMARK(BM_TransformPoints)->RangeMultiplier(8)->Range(4, 4096);
+BENCHMARK(BM_TransformPointsOneByOne)->RangeMultiplier(8)->Range(4, 4096);
+BENCHMARK(BM_ComposeTransformations);
@@ -41,6 +41,7 @@ namespace detail {
     oField = IddField::load("Generic Data Field", "A2; \\field Generic Data Field \n \\type alpha \n \\begin-extensible", m_name);
     OS_ASSERT(oField);
     m_extensibleFields.push_back(*oField);
+    cacheNameField();
   }
 
   // GETTERS
@@ -156,6 +157,7 @@ namespace detail {
         unsigned newMaxFields = m_properties.maxFields.get() + 1;
         m_properties.maxFields = newMaxFields;
       }
+      cacheNameField();
     }
   }
 
@@ -210,22 +212,12 @@ namespace detail {
   }
 
   bool IddObject_Impl::hasNameField() const {
-    if (m_nameFieldCache) {
-      return m_nameFieldCache->first;
-    }
-
-    unsigned index = 0;
-    if (hasHandleField()) {
-      index = 1;
-    }
-    bool result = ((m_fields.size() > index) && (m_fields[index].isNameField()));
-    m_nameFieldCache = std::pair<bool, unsigned>(result, index);
-    return result;
+    return m_nameFieldCache.first;
   }
 
   boost::optional<unsigned> IddObject_Impl::nameFieldIndex() const {
     if (hasNameField()) {
-      return m_nameFieldCache->second;
+      return m_nameFieldCache.second;
     }
     return boost::none;
   }
@@ -389,6 +381,7 @@ namespace detail {
     } catch (...) {
       return {};
     }
+    result->cacheNameField();
 
     return result;
   }
@@ -514,6 +507,14 @@ namespace detail {
     }
   }
 
+  void IddObject_Impl::cacheNameField() {
+    unsigned index = 0;
+    if (hasHandleField()) {
+      index = 1;
+    }
+    m_nameFieldCache = std::pair<bool, unsigned>((m_fields.size() > index) && m_fields[index].isNameField(), index);
+  }
+
   void IddObject_Impl::parseObject(const std::string& text) {
     // find the object name and the property text
     smatch matches;
@@ -166,8 +166,9 @@ namespace detail {
     IddFieldVector m_extensibleFields;  // vector of extensible fields, forms single
                                         // extensible field group
     std::vector<unsigned> m_urlIdx;
-    // .first = hasNameField(); .second = nameFieldIndex
-    mutable boost::optional<std::pair<bool, unsigned>> m_nameFieldCache;
+    // .first = hasNameField(); .second = nameFieldIndex. Set each time m_fields changes rather than on
+    // first use, IddObjects are shared by all objects of their type and read from several threads.
+    std::pair<bool, unsigned> m_nameFieldCache{false, 0u};
 
     // partial constructor used by load
     IddObject_Impl(const std::string& name, const std::string& group, IddObjectType type);
@@ -180,6 +181,9 @@ namespace detail {
     void parseFields(const std::string& text);
     void makeExtensible();
 
+    // updates m_nameFieldCache
+    void cacheNameField();
+
     // configure logging
     REGISTER_LOGGER("utilities.idd.IddObject");
   };
@@ -6,6 +6,7 @@
 #include "IdfFile.hpp"
 #include <utilities/idf/IdfObject_Impl.hpp>  // needed for serialization
 #include "IdfRegex.hpp"
+#include "IdfTokenizer.hpp"
 #include "ValidityReport.hpp"
 
 #include "../idd/IddRegex.hpp"
@@ -17,9 +18,11 @@
 #include "../plot/ProgressBar.hpp"
 #include "../core/PathHelpers.hpp"
 #include "../core/Assert.hpp"
+#include "../core/ParallelFor.hpp"
 
-#include <boost/iostreams/filter/newline.hpp>
-#include <boost/iostreams/filtering_stream.hpp>
+#include <boost/iostreams/device/mapped_file.hpp>
+
+#include <map>
 
 namespace openstudio {
 
@@ -387,6 +390,32 @@ OptionalIdfFile IdfFile::load(const path& p, const IddFile& iddFile, ProgressBar
   return boost::none;
 }
 
+OptionalIdfFile IdfFile::loadParallel(const path& p, const IddFileType& iddFileType, unsigned numThreads) {
+  path wp = completePathToFile(p, path(), "", false);
+  if (wp.empty() || openstudio::filesystem::is_empty(wp)) {
+    return boost::none;
+  }
+
+  IdfFile result(iddFileType);
+  // remove initial version object
+  if (OptionalIdfObject vo = result.versionObject()) {
+    result.removeObject(*vo);
+  }
+
+  try {
+    boost::iostreams::mapped_file_source file(wp.native());
+    if (result.m_loadParallel(file.data(), file.size(), numThreads)) {
+      // check for it again here
+      result.addVersionObject();
+      return result;
+    }
+  } catch (...) {
+    return boost::none;
+  }
+
+  return boost::none;
+}
+
 boost::optional<VersionString> IdfFile::loadVersionOnly(std::istream& is) {
   boost::optional<VersionString> result;
   IddFile catchallIdd = IddFile::catchallIddFile();
@@ -499,170 +528,206 @@ bool IdfFile::save(const openstudio::path& p, bool overwrite) {
 
 bool IdfFile::m_load(std::istream& is, ProgressBar* progressBar, bool versionOnly) {
 
-  [[maybe_unused]] int lineNum = 0;  // Idf line number
-  int objectNum = 0;                 // number of objects, first is #1
-  std::string line;                  // temp string to help with reading
-  boost::smatch matches;             // matches to regular expressions
-  std::string comment;               // keep running comment
-  bool firstBlock = true;            // to capture first comment block as the header
+  int objectNum = 0;       // number of objects, first is #1
+  bool firstBlock = true;  // to capture first comment block as the header
+
+  // read the whole stream into one buffer, the tokenizer makes a single pass over it
+  // (it also takes care of converting any line endings to '\n')
+  detail::IdfTokenizer tokenizer(detail::IdfTokenizer::readAll(is));
 
   if (progressBar) {
-    is.seekg(0, std::ios_base::end);
-    int streamsize = static_cast<int>(is.tellg());
     progressBar->setMinimum(0);
-    progressBar->setMaximum(streamsize);
-    is.seekg(0, std::ios_base::beg);
+    progressBar->setMaximum(static_cast<int>(tokenizer.size()));
   }
 
-  // Use a boost filter to make sure that no matter what line endings come in,
-  // they are converted to what is expected by the current os
-  boost::iostreams::filtering_istream filt;
-
-  //#ifdef _POSIX_VERSION
-  filt.push(boost::iostreams::newline_filter(boost::iostreams::newline::posix));
-  //#else
-  //  filt.push(boost::iostreams::newline_filter(boost::iostreams::newline::dos));
-  //#endif
-  filt.push(is);
-
-  // read the file line by line using regexes
-  while (std::getline(filt, line)) {
+  for (auto tokenType = tokenizer.next(); tokenType != detail::IdfTokenizer::TokenType::End; tokenType = tokenizer.next()) {
 
-    if (line == "\r") {
-      // This is not a real line at all, just the vestiges from the
-      // previous windows formatted line being parsed on unix, skip it,
-      // don't even count it
-      continue;
+    if (progressBar) {
+      progressBar->setValue(static_cast<int>(tokenizer.position()));
     }
 
-    ++lineNum;
+    if (tokenType == detail::IdfTokenizer::TokenType::CommentBlock) {
+      std::string comment(tokenizer.commentBlock());
 
-    if (progressBar) {
-      int current = static_cast<int>(is.tellg());
-      progressBar->setValue(current);
-    }
-
-    if (boost::regex_match(line, idfRegex::commentOnlyLine())) {
-      // continue comment
-      comment += (line + idfRegex::newLinestring());
-    } else if (boost::regex_match(line, commentRegex::whitespaceOnlyLine())) {
-      // end comment
-      boost::trim(comment);
-
-      if (!comment.empty()) {
-        if (firstBlock) {
-          // set this comment as the header
-          setHeader(comment);
-          firstBlock = false;
-        } else {
-          if (!versionOnly) {
-
-            // make a comment only object to hold the comment
-            OptionalIddObject commentOnlyIddObject = m_iddFileAndFactoryWrapper.getObject(IddObjectType::CommentOnly);
-            if (!commentOnlyIddObject) {
-              LOG(Error, "IddFile does not contain a CommentOnly object. Will not be able to save comment objects.");
-              continue;
-            }
-
-            OptionalIdfObject commentOnlyObject;
-            commentOnlyObject = IdfObject::load(commentOnlyIddObject->name() + ";" + comment, *commentOnlyIddObject);
-            OS_ASSERT(commentOnlyObject);
-
-            // put it in the object list
-            addObject(*commentOnlyObject);
-          }
+      if (firstBlock) {
+        // set this comment as the header
+        setHeader(comment);
+        firstBlock = false;
+      } else if (!versionOnly) {
+        if (OptionalIdfObject commentOnlyObject = m_commentOnlyObject(comment)) {
+          // put it in the object list
+          addObject(*commentOnlyObject);
         }
       }
 
-      //clear out comment
-      comment = "";
+      continue;
+    }
+
+    firstBlock = false;
+    const detail::IdfObjectTokens& tokens = tokenizer.objectTokens();
 
+    // peek at the object type
+    std::string objectType;
+    bool isVersion = false;
+    if (tokens.typeFound) {
+      objectType = std::string(tokens.objectType);
+      isVersion = tokens.isVersion();
     } else {
+      // can't figure out the object's type
+      if (!versionOnly) {
+        LOG(Warn, "Unrecognizable object type '" << tokens.firstLine << "'. Defaulting to 'Catchall'.");
+      }
+      objectType = "Catchall";
+    }
 
-      bool foundEndLine(false);
-      firstBlock = false;
-      bool isVersion = false;
+    // get the corresponding idd object entry
+    OptionalIddObject iddObject = m_iddFileAndFactoryWrapper.getObject(objectType);
+    if (!iddObject) {
+      if (!versionOnly) {
+        LOG(Warn, "Cannot find object type '" + objectType + "' in Idd. Placing data in Catchall object.");
+      }
+      iddObject = IddObject();
+      objectType = "Catchall";
+    } else {
+      OS_ASSERT(iddObject->type() != IddObjectType::Catchall);
+    }
 
-      // peek at the object type and name for indexing in map
-      std::string objectType;
+    // construct the object
+    if (!versionOnly || isVersion) {
+      OptionalIdfObject object;
+      if (tokens.simple) {
+        if (std::shared_ptr<detail::IdfObject_Impl> p = detail::IdfObject_Impl::load(tokens, *iddObject)) {
+          object = IdfObject(p);
+        }
+      } else {
+        // unusual text, fall back on the regex based parser
+        object = IdfObject::load(tokens.legacyText(), *iddObject);
+      }
 
-      if (boost::regex_search(line, matches, idfRegex::line())) {
-        objectType = std::string(matches[1].first, matches[1].second);
-        boost::trim(objectType);
+      if (!object) {
+        LOG(Error, "Unable to construct IdfObject from text: " << '\n'
+                                                               << tokens.legacyText() << '\n'
+                                                               << "Throwing this object out and parsing the remainder of the file.");
+        continue;
       } else {
-        // can't figure out the object's type
-        if (!versionOnly) {
-          LOG(Warn, "Unrecognizable object type '" + line + "'. Defaulting to 'Catchall'.");
+        // a valid Idf object to parse
+        if (object->iddObject().type() != IddObjectType::Catchall) {
+          ++objectNum;
         }
-        objectType = "Catchall";
-      }
-      if (boost::regex_match(objectType, iddRegex::versionObjectName())) {
-        isVersion = true;
+
+        // put it in the object list
+        addObject(*object);
       }
+    }
 
-      // get the corresponding idd object entry
+    if (versionOnly && isVersion) {
+      // Increment objectNum to avoid triggering the warning below and return false
+      ++objectNum;
+      break;
+    }
+  }
 
-      OptionalIddObject iddObject = m_iddFileAndFactoryWrapper.getObject(objectType);
-      if (!iddObject) {
-        if (!versionOnly) {
-          LOG(Warn, "Cannot find object type '" + objectType + "' in Idd. Placing data in Catchall object.");
-        }
-        iddObject = IddObject();
-        objectType = "Catchall";
-      } else {
-        OS_ASSERT(iddObject->type() != IddObjectType::Catchall);
-      }
+  // If we sucessfully parsed at least one object, we return true, otherwise false
+  if (objectNum > 0) {
+    return true;
+  } else {
+    LOG(Error, "Could not parse a single valid object in file.");
+    return false;
+  }
+}
 
-      // put the text for this object in a new string with a newline
-      std::string text(comment + idfRegex::newLinestring() + line + idfRegex::newLinestring());
-      comment = "";
+bool IdfFile::m_loadParallel(const char* data, std::size_t size, unsigned numThreads) {
 
-      // check if this line also matches closing line object
-      if (boost::regex_match(line, idfRegex::objectEnd())) {
-        foundEndLine = true;
-      }
+  int objectNum = 0;       // number of objects, first is #1
+  bool firstBlock = true;  // to capture first comment block as the header
 
-      // continue reading until we have seen the entire object
-      // last line will be thrown away, requires empty line between objects in Idf
-      while ((!foundEndLine) && (std::getline(filt, line))) {
-        ++lineNum;
+  struct Entry
+  {
+    detail::IdfObjectTokens tokens;
+    IddObject iddObject;
+    OptionalIdfObject object;
+  };
+  std::vector<Entry> entries;
 
-        // add line to text, include newline separator
-        text += (line + idfRegex::newLinestring());
+  // Serial pass: split the text into objects and look up their IddObjects. Comment only objects
+  // are made right away, they are rare and cheap.
+  detail::IdfTokenizer tokenizer(data, size, true);
+  std::map<std::string, OptionalIddObject> iddObjects;
+  for (auto tokenType = tokenizer.next(); tokenType != detail::IdfTokenizer::TokenType::End; tokenType = tokenizer.next()) {
 
-        // check if we have found the last field
-        if (boost::regex_match(line, idfRegex::objectEnd())) {
-          foundEndLine = true;
-        }
+    if (tokenType == detail::IdfTokenizer::TokenType::CommentBlock) {
+      std::string comment(tokenizer.commentBlock());
+      if (firstBlock) {
+        setHeader(comment);
+        firstBlock = false;
+      } else if (OptionalIdfObject commentOnlyObject = m_commentOnlyObject(comment)) {
+        entries.push_back(Entry{detail::IdfObjectTokens(), commentOnlyObject->iddObject(), commentOnlyObject});
       }
+      continue;
+    }
 
-      // construct the object
-      if (foundEndLine && (!versionOnly || isVersion)) {
-        OptionalIdfObject object = IdfObject::load(text, *iddObject);
-        if (!object) {
-          LOG(Error, "Unable to construct IdfObject from text: " << '\n'
-                                                                 << text << '\n'
-                                                                 << "Throwing this object out and parsing the remainder of the file.");
-          continue;
-        } else {
-          // a valid Idf object to parse
-          if (object->iddObject().type() != IddObjectType::Catchall) {
-            ++objectNum;
-          }
+    firstBlock = false;
+    const detail::IdfObjectTokens& tokens = tokenizer.objectTokens();
 
-          // put it in the object list
-          addObject(*object);
-        }
-      }
+    std::string objectType;
+    if (tokens.typeFound) {
+      objectType = std::string(tokens.objectType);
+    } else {
+      LOG(Warn, "Unrecognizable object type '" << tokens.firstLine << "'. Defaulting to 'Catchall'.");
+      objectType = "Catchall";
+    }
 
-      if (versionOnly && isVersion) {
-        // Increment objectNum to avoid triggering the warning below and return false
-        ++objectNum;
-        break;
+    auto it = iddObjects.find(objectType);
+    if (it == iddObjects.end()) {
+      OptionalIddObject iddObject = m_iddFileAndFactoryWrapper.getObject(objectType);
+      if (iddObject) {
+        OS_ASSERT(iddObject->type() != IddObjectType::Catchall);
+        // IddObject lazily caches its name field index, fill that cache before sharing it across threads
+        iddObject->hasNameField();
       }
+      it = iddObjects.emplace(objectType, iddObject).first;
+    }
+
+    if (it->second) {
+      entries.push_back(Entry{tokens, *it->second, boost::none});
+    } else {
+      LOG(Warn, "Cannot find object type '" + objectType + "' in Idd. Placing data in Catchall object.");
+      entries.push_back(Entry{tokens, IddObject(), boost::none});
     }
   }
 
+  // Parallel pass: tokenize and construct the objects, handing out chunks of entries to the threads
+  parallelForChunks(entries.size(), numThreads, 64, [&entries](unsigned /*threadIndex*/, std::size_t i) {
+    Entry& entry = entries[i];
+    if (entry.object) {
+      return;
+    }
+    detail::IdfTokenizer::tokenizeObject(entry.tokens);
+    std::shared_ptr<detail::IdfObject_Impl> p;
+    if (entry.tokens.simple) {
+      p = detail::IdfObject_Impl::load(entry.tokens, entry.iddObject);
+    } else {
+      p = detail::IdfObject_Impl::load(entry.tokens.legacyText(), entry.iddObject);
+    }
+    if (p) {
+      entry.object = IdfObject(p);
+    }
+  });
+
+  // Serial pass: add the objects in file order
+  for (Entry& entry : entries) {
+    if (!entry.object) {
+      LOG(Error, "Unable to construct IdfObject from text: " << '\n'
+                                                             << entry.tokens.legacyText() << '\n'
+                                                             << "Throwing this object out and parsing the remainder of the file.");
+      continue;
+    }
+    if (!entry.tokens.body.empty() && (entry.object->iddObject().type() != IddObjectType::Catchall)) {
+      ++objectNum;
+    }
+    addObject(*entry.object);
+  }
+
   // If we sucessfully parsed at least one object, we return true, otherwise false
   if (objectNum > 0) {
     return true;
@@ -672,6 +737,20 @@ bool IdfFile::m_load(std::istream& is, ProgressBar* progressBar, bool versionOnl
   }
 }
 
+boost::optional<IdfObject> IdfFile::m_commentOnlyObject(const std::string& comment) const {
+  // make a comment only object to hold the comment
+  OptionalIddObject commentOnlyIddObject = m_iddFileAndFactoryWrapper.getObject(IddObjectType::CommentOnly);
+  if (!commentOnlyIddObject) {
+    LOG(Error, "IddFile does not contain a CommentOnly object. Will not be able to save comment objects.");
+    return boost::none;
+  }
+
+  OptionalIdfObject commentOnlyObject;
+  commentOnlyObject = IdfObject::load(commentOnlyIddObject->name() + ";" + comment, *commentOnlyIddObject);
+  OS_ASSERT(commentOnlyObject);
+  return commentOnlyObject;
+}
+
 IddFileAndFactoryWrapper IdfFile::iddFileAndFactoryWrapper() const {
   return m_iddFileAndFactoryWrapper;
 }
@@ -170,6 +170,12 @@ class UTILITIES_API IdfFile
    *  try "idf". */
   static boost::optional<IdfFile> load(const path& p, const IddFile& iddFile, ProgressBar* progressBar = nullptr);
 
+  /** Load an IdfFile from path using the IddFactory and iddFileType, if possible. The file is
+   *  memory mapped and split into objects serially, then the objects are parsed on numThreads
+   *  threads (0 uses all available cores), and finally added in file order. The result is
+   *  identical to that of load(p, iddFileType). */
+  static boost::optional<IdfFile> loadParallel(const path& p, const IddFileType& iddFileType, unsigned numThreads = 0);
+
   /** Quick load method that uses the IddFile::catchallIddFile and stops parsing once a version
    *  identifier is found. Used to determine the appropriate IddFile to use for a full load. */
   static boost::optional<VersionString> loadVersionOnly(std::istream& is);
@@ -215,6 +221,12 @@ class UTILITIES_API IdfFile
   /// private load function that uses m_iddFile and m_iddFileType initialized elsewhere
   bool m_load(std::istream& is, ProgressBar* progressBar = nullptr, bool versionOnly = false);
 
+  /// private load function for loadParallel, data is the full text of the file
+  bool m_loadParallel(const char* data, std::size_t size, unsigned numThreads);
+
+  /// make a CommentOnly object holding comment, if the IddFile allows it
+  boost::optional<IdfObject> m_commentOnlyObject(const std::string& comment) const;
+
   // configure logging
   REGISTER_LOGGER("utilities.idf.IdfFile");
 };
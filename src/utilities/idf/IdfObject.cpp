@@ -8,6 +8,7 @@
 
 #include "IdfExtensibleGroup.hpp"
 #include "IdfRegex.hpp"
+#include "IdfTokenizer.hpp"
 #include "ValidityReport.hpp"
 
 #include "../idd/IddKey.hpp"
@@ -20,6 +21,7 @@
 #include "../math/FloatCompare.hpp"
 #include "../core/Finder.hpp"
 #include "../core/Assert.hpp"
+#include "../core/ASCIIStrings.hpp"
 
 #include "../units/Quantity.hpp"
 #include "../units/OSOptionalQuantity.hpp"
@@ -36,7 +38,11 @@ namespace detail {
   // CONSTRUCTORS
 
   IdfObject_Impl::IdfObject_Impl(const IdfObject_Impl& other, bool keepHandle)
-    : m_comment(other.comment()), m_iddObject(other.iddObject()), m_fields(other.fields()), m_fieldComments(other.fieldComments()) {
+    : m_comment(other.comment()),
+      m_iddObject(other.iddObject()),
+      m_fields(other.m_fields),
+      m_fieldComments(other.fieldComments()),
+      m_numericFields(other.m_numericFields) {
     if (keepHandle) {
       OS_ASSERT(!other.handle().isNull());
       m_handle = other.handle();
@@ -215,6 +221,15 @@ namespace detail {
 
   boost::optional<double> IdfObject_Impl::getDouble(unsigned index, bool returnDefault) const {
     OptionalDouble result;
+    if (index < m_numericFields.size()) {
+      const NumericField& numericField = m_numericFields[index];
+      if (numericField.state == NumericField::State::Number) {
+        result = numericField.value;
+        return result;
+      } else if (numericField.state == NumericField::State::Automatic) {
+        return result;
+      }
+    }
     OptionalString value = getString(index, returnDefault, false);
     if (value) {
       if (!(istringEqual(*value, "") || istringEqual(*value, "autosize") || istringEqual(*value, "autocalculate"))) {
@@ -235,6 +250,19 @@ namespace detail {
 
   boost::optional<unsigned> IdfObject_Impl::getUnsigned(unsigned index, bool returnDefault) const {
     OptionalUnsigned result;
+    if (index < m_numericFields.size()) {
+      const NumericField& numericField = m_numericFields[index];
+      if (numericField.state == NumericField::State::Number) {
+        try {
+          result = boost::numeric_cast<unsigned>(numericField.value);
+        } catch (const std::exception&) {
+          LOG(Error, "Could not convert '" << decodeString(m_fields[index]) << "' to unsigned");
+        }
+        return result;
+      } else if (numericField.state == NumericField::State::Automatic) {
+        return result;
+      }
+    }
     OptionalString value = getString(index, returnDefault, false);
     if (value) {
       if (!(istringEqual(*value, "") || istringEqual(*value, "autosize") || istringEqual(*value, "autocalculate"))) {
@@ -251,6 +279,19 @@ namespace detail {
 
   boost::optional<int> IdfObject_Impl::getInt(unsigned index, bool returnDefault) const {
     OptionalInt result;
+    if (index < m_numericFields.size()) {
+      const NumericField& numericField = m_numericFields[index];
+      if (numericField.state == NumericField::State::Number) {
+        try {
+          result = boost::numeric_cast<int>(numericField.value);
+        } catch (const std::exception&) {
+          LOG(Error, "Could not convert '" << decodeString(m_fields[index]) << "' to int");
+        }
+        return result;
+      } else if (numericField.state == NumericField::State::Automatic) {
+        return result;
+      }
+    }
     OptionalString value = getString(index, returnDefault, false);
     if (value) {
       if (!(istringEqual(*value, "") || istringEqual(*value, "autosize") || istringEqual(*value, "autocalculate"))) {
@@ -378,12 +419,15 @@ namespace detail {
       n = numFields();
       if (i < n) {
         std::string oldName = m_fields[i];
-        m_fields[i] = newName;
+        m_fields.set(i, newName);
         m_diffs.push_back(IdfObjectDiff(i, oldName, newName));
       } else {
         m_fields.push_back(newName);
         m_diffs.push_back(IdfObjectDiff(i, boost::none, newName));
       }
+      resizeNumericFields();
+      parseNumericField(i);
+      nameChanged();
       //return decoded string since we might have made changes to it if its an EMS object.
       newName = decodeString(newName);
       return newName;  // success!
@@ -454,13 +498,15 @@ namespace detail {
         if (m_fieldComments.size() > n) {
           m_fieldComments.resize(n);
         }
+        resizeNumericFields();
 
         return false;
       }
 
       OS_ASSERT(index < m_fields.size());
 
-      m_fields[index] = value;
+      m_fields.set(index, value);
+      parseNumericField(index);
       m_diffs.emplace_back(index, oldValue, value);
       return result;
     }
@@ -564,6 +610,7 @@ namespace detail {
     if (m_iddObject.isNonextensibleField(index) || (m_iddObject.isExtensibleField(index) && (m_iddObject.properties().numExtensible == 1))) {
       m_fields.push_back(value);
       m_diffs.push_back(IdfObjectDiff(index, boost::none, value));
+      resizeNumericFields();
       return true;
     }
     return false;
@@ -604,6 +651,7 @@ namespace detail {
         if (m_fieldComments.size() > n) {
           m_fieldComments.resize(n);
         }
+        resizeNumericFields();
         return result;
       }
     }
@@ -621,6 +669,7 @@ namespace detail {
       }
 
       m_fields.resize(n + groupSize);
+      resizeNumericFields();
 
       for (unsigned i = 0; i < groupSize; ++i) {
 
@@ -634,6 +683,7 @@ namespace detail {
           if (m_fieldComments.size() > n) {
             m_fieldComments.resize(n);
           }
+          resizeNumericFields();
           return result;
         }
       }
@@ -790,6 +840,7 @@ namespace detail {
       if (m_fieldComments.size() > m_fields.size()) {
         m_fieldComments.resize(numAfterPop);
       }
+      resizeNumericFields();
       OS_ASSERT(egToPop.empty());
     }
 
@@ -1045,6 +1096,10 @@ namespace detail {
     return report;
   }
 
+  bool IdfObject_Impl::sharesFieldsWith(const IdfObject_Impl& other) const {
+    return m_fields.sharesStorageWith(other.m_fields);
+  }
+
   bool IdfObject_Impl::dataFieldsEqual(const IdfObject& other) const {
     if (m_iddObject != other.iddObject()) {
       return false;
@@ -1216,6 +1271,87 @@ namespace detail {
     return result;
   }
 
+  std::shared_ptr<IdfObject_Impl> IdfObject_Impl::load(const IdfObjectTokens& tokens, const IddObject& iddObject) {
+    OS_ASSERT(tokens.simple);
+    std::shared_ptr<IdfObject_Impl> result;
+    IdfObject_Impl idfObjectImpl(iddObject, false, true);
+
+    try {
+      idfObjectImpl.parse(tokens);
+      idfObjectImpl.resizeToMinFields();
+    } catch (...) {
+      return result;
+    }
+
+    bool keepHandle = idfObjectImpl.iddObject().hasHandleField();
+    result = std::shared_ptr<IdfObject_Impl>(new IdfObject_Impl(idfObjectImpl, keepHandle));
+    return result;
+  }
+
+  std::shared_ptr<IdfObject_Impl> IdfObject_Impl::load(const IdfObject_Impl& other, const IddObject& iddObject) {
+    std::shared_ptr<IdfObject_Impl> result;
+
+    // comment only objects print as a bare comment block
+    if (boost::iequals(other.m_iddObject.name(), iddRegex::commentOnlyObjectName())) {
+      return result;
+    }
+
+    // same views as IdfTokenizer would find in other.print(), see printName and printField
+    const std::string objectType = other.m_iddObject.name();
+    IdfObjectTokens tokens;
+    tokens.typeFound = true;
+    tokens.simple = true;
+    tokens.objectType = objectType;
+
+    // every comment line is printed as is, a blank or uncommented line would end the comment block
+    const std::string_view comment = other.m_comment;
+    if ((comment.find_first_of("\r\f\v") != std::string_view::npos) || (!comment.empty() && (comment.back() == '\n'))) {
+      return result;
+    }
+    for (std::size_t pos = 0; pos < comment.size();) {
+      std::size_t end = comment.find('\n', pos);
+      if (end == std::string_view::npos) {
+        end = comment.size();
+      }
+      const std::string_view line = comment.substr(pos, end - pos);
+      const std::size_t bang = line.find_first_not_of(" \t");
+      if ((bang == std::string_view::npos) || (line[bang] != '!')) {
+        return result;
+      }
+      if (line.size() - bang > 1) {
+        tokens.comments.push_back(line.substr(bang));
+      }
+      pos = end + 1;
+    }
+
+    // fields are printed one per line, or one vertex per line with a default comment
+    const bool vertices = (other.m_iddObject.properties().format == "vertices");
+    tokens.fields.reserve(other.m_fields.size());
+    tokens.fieldComments.reserve(other.m_fields.size());
+    for (unsigned i = 0, n = other.m_fields.size(); i < n; ++i) {
+      const std::string& field = other.m_fields[i];
+      if (field.find_first_of(",;!\n\r\f\v") != std::string::npos) {
+        return result;
+      }
+      tokens.fields.push_back(ascii_trim(field));
+
+      std::string_view fieldComment;
+      if ((i < other.m_fieldComments.size()) && !(vertices && other.m_iddObject.isExtensibleField(i))) {
+        fieldComment = ascii_trim(other.m_fieldComments[i]);
+        if ((fieldComment.find_first_of("\n\r\f\v") != std::string_view::npos) || (!fieldComment.empty() && (fieldComment.front() != '!'))) {
+          return result;
+        }
+        // a custom comment that looks like a default one is dropped on load
+        if ((fieldComment.size() >= 2) && (fieldComment[1] == '-')) {
+          fieldComment = {};
+        }
+      }
+      tokens.fieldComments.push_back(fieldComment);
+    }
+
+    return load(tokens, iddObject);
+  }
+
   std::ostream& IdfObject_Impl::print(std::ostream& os) const {
     unsigned n = numFields();
     if (n == 0) {
@@ -1376,6 +1512,7 @@ namespace detail {
         }
       }
     }
+    parseNumericFields();
   }
 
   void IdfObject_Impl::parse(const std::string& text, bool getIddFromFactory) {
@@ -1547,8 +1684,124 @@ namespace detail {
     }
   }
 
+  void IdfObject_Impl::parse(const IdfObjectTokens& tokens) {
+    // same rules as parse(text, false), applied to the views found by IdfTokenizer
+    std::string objectType(tokens.objectType);
+    if (!boost::iequals(objectType, m_iddObject.name())) {
+      if (m_iddObject.type() != IddObjectType::Catchall) {
+        LOG(Error, "IdfObject type '" << objectType << "', does not equal its IddObject name '" << m_iddObject.name()
+                                      << "'. Reverting to default Catchall IddObject.");
+      }
+      m_iddObject = IddObject();
+      m_fields.push_back(objectType);
+    }
+
+    for (const std::string_view& comment : tokens.comments) {
+      m_comment.append(comment);
+      m_comment += idfRegex::newLinestring();
+    }
+    boost::trim_right(m_comment);
+
+    m_fields.reserve(m_fields.size() + tokens.fields.size());
+    for (unsigned iddFieldIndex = 0, n = tokens.fields.size(); iddFieldIndex < n; ++iddFieldIndex) {
+      const std::string_view& fieldText = tokens.fields[iddFieldIndex];
+
+      OptionalIddField iddField = m_iddObject.getField(iddFieldIndex);
+      if (!iddField) {
+        // rest of the text, or of the fields if the tokens did not come from text
+        std::string remainder;
+        if (tokens.body.empty()) {
+          for (unsigned i = iddFieldIndex + 1; i < n; ++i) {
+            remainder += ", ";
+            remainder += tokens.fields[i];
+          }
+        } else {
+          const char* bodyEnd = tokens.body.data() + tokens.body.size();
+          const char* fieldEnd = fieldText.data() + fieldText.size();
+          remainder = std::string(fieldEnd, bodyEnd - fieldEnd);
+        }
+        LOG(Error, "IdfObject of type '" << m_iddObject.name() << "' "
+                                         << "cannot have field index of " << iddFieldIndex << ". "
+                                         << "Cutting off IdfObject field parsing here, with the following text "
+                                         << "remaining: " << '\n'
+                                         << fieldText << '\n'
+                                         << remainder);
+        return;
+      }
+
+      m_fields.emplace_back(fieldText);
+
+      const std::string_view& fieldComment = tokens.fieldComments[iddFieldIndex];
+      if (!fieldComment.empty()) {
+        m_fieldComments.resize(m_fields.size());
+        m_fieldComments.back() = fieldComment;
+      }
+
+      // keep handle if this is a handle field
+      if (iddField->properties().type == IddFieldType::HandleType) {
+        Handle candidate = toUUID(m_fields.back());
+        if (!candidate.isNull()) {
+          m_handle = candidate;
+        }
+      }
+    }
+
+    if (!tokens.unparsedText.empty()) {
+      LOG(Warn, "After parsing IdfObject fields, the following text remains unprocessed: " << '\n' << tokens.unparsedText);
+    }
+  }
+
   // GETTER AND SETTER HELPERS
 
+  void IdfObject_Impl::nameChanged() {}
+
+  void IdfObject_Impl::parseNumericField(unsigned index) {
+    if (index >= m_numericFields.size()) {
+      resizeNumericFields();
+      return;
+    }
+
+    NumericField& numericField = m_numericFields[index];
+    numericField = NumericField();
+    OptionalIddField iddField = m_iddObject.getField(index);
+    if (!iddField) {
+      return;
+    }
+    IddFieldType fieldType = iddField->properties().type;
+    if ((fieldType != IddFieldType::RealType) && (fieldType != IddFieldType::IntegerType)) {
+      return;
+    }
+
+    // same checks as the getString based path of getDouble, empty fields may still fall back on their default
+    std::string value = decodeString(m_fields[index]);
+    if (value.empty()) {
+      return;
+    }
+    if (istringEqual(value, "autosize") || istringEqual(value, "autocalculate")) {
+      numericField.state = NumericField::State::Automatic;
+      return;
+    }
+    try {
+      numericField.value = boost::lexical_cast<double>(value);
+      numericField.state = NumericField::State::Number;
+    } catch (const std::exception&) {
+      // left to getDouble, which logs the error
+    }
+  }
+
+  void IdfObject_Impl::resizeNumericFields() {
+    unsigned n = m_numericFields.size();
+    m_numericFields.resize(m_fields.size());
+    for (unsigned i = n, nn = m_numericFields.size(); i < nn; ++i) {
+      parseNumericField(i);
+    }
+  }
+
+  void IdfObject_Impl::parseNumericFields() {
+    m_numericFields.clear();
+    resizeNumericFields();
+  }
+
   bool IdfObject_Impl::setIddObject(const IddObject& iddObject) {
     m_iddObject = iddObject;
     if (m_fields.size() < minFields()) {
@@ -1565,6 +1818,7 @@ namespace detail {
         }
       }
     }
+    parseNumericFields();
     return true;
   }
 
@@ -2257,6 +2511,14 @@ OptionalIdfObject IdfObject::load(const std::string& text, const IddObject& iddO
   return boost::none;
 }
 
+OptionalIdfObject IdfObject::load(const IdfObject& other, const IddObject& iddObject) {
+  std::shared_ptr<detail::IdfObject_Impl> p = detail::IdfObject_Impl::load(*other.m_impl, iddObject);
+  if (p) {
+    return IdfObject(p);
+  }
+  return boost::none;
+}
+
 int IdfObject::printedFieldSpace() {
   return 38;
 }
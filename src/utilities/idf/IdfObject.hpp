@@ -344,6 +344,12 @@ class UTILITIES_API IdfObject
   /** Constructor from text and an explicit iddObject. */
   static boost::optional<IdfObject> load(const std::string& text, const IddObject& iddObject);
 
+  /** Constructor from another object and an explicit iddObject. Equivalent to loading other's
+   *  printed text with iddObject, but does not go through text. Returns boost::none if other holds
+   *  text that would not print and load back as is (for instance a field or comment that spans
+   *  lines), such objects have to go through text. */
+  static boost::optional<IdfObject> load(const IdfObject& other, const IddObject& iddObject);
+
   /** Returns the width, in characters, of the default amount of space given to field data
    *  during printing. */
   static int printedFieldSpace();
@@ -406,6 +412,7 @@ class UTILITIES_API IdfObject
   friend class detail::Workspace_Impl;        // for finding IdfObjects in a workspace
   friend class WorkspaceObject;               // for WorkspaceObject::idfObject()
   friend class Workspace;                     // for toIdfFile completion (constructs IdfObject from impl)
+  friend class IdfFile;                       // for loading tokenized text (constructs IdfObject from impl)
 
   /** Protected constructor from impl. */
   IdfObject(std::shared_ptr<detail::IdfObject_Impl> impl);
@@ -0,0 +1,112 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#ifndef UTILITIES_IDF_IDFOBJECTFIELDS_HPP
+#define UTILITIES_IDF_IDFOBJECTFIELDS_HPP
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace openstudio {
+namespace detail {
+
+  /** IdfObjectFields holds the field text of an IdfObject_Impl. Copies share the same storage until
+   *  one of them is changed, so that cloning an object, or a whole Workspace, does not copy the text
+   *  of the objects that are never modified afterwards. Only const access to the fields is offered,
+   *  changes go through the members below, which first give this instance storage of its own. */
+  class IdfObjectFields
+  {
+   public:
+    using const_iterator = std::vector<std::string>::const_iterator;
+
+    IdfObjectFields() = default;
+
+    IdfObjectFields(std::vector<std::string> fields) : m_fields(std::make_shared<std::vector<std::string>>(std::move(fields))) {}
+
+    operator const std::vector<std::string>&() const {
+      return fields();
+    }
+
+    std::size_t size() const {
+      return m_fields ? m_fields->size() : 0;
+    }
+
+    bool empty() const {
+      return size() == 0;
+    }
+
+    const std::string& operator[](std::size_t index) const {
+      return (*m_fields)[index];
+    }
+
+    const std::string& back() const {
+      return m_fields->back();
+    }
+
+    const_iterator begin() const {
+      return fields().begin();
+    }
+
+    const_iterator end() const {
+      return fields().end();
+    }
+
+    void set(std::size_t index, std::string value) {
+      mutableFields()[index] = std::move(value);
+    }
+
+    void push_back(std::string value) {
+      mutableFields().push_back(std::move(value));
+    }
+
+    template <typename T>
+    void emplace_back(T&& value) {
+      mutableFields().emplace_back(std::forward<T>(value));
+    }
+
+    void pop_back() {
+      mutableFields().pop_back();
+    }
+
+    void resize(std::size_t n) {
+      if (n != size()) {
+        mutableFields().resize(n);
+      }
+    }
+
+    void reserve(std::size_t n) {
+      mutableFields().reserve(n);
+    }
+
+    /** Returns true if this and other share the same storage. */
+    bool sharesStorageWith(const IdfObjectFields& other) const {
+      return m_fields && (m_fields == other.m_fields);
+    }
+
+   private:
+    const std::vector<std::string>& fields() const {
+      static const std::vector<std::string> noFields;
+      return m_fields ? *m_fields : noFields;
+    }
+
+    std::vector<std::string>& mutableFields() {
+      if (!m_fields) {
+        m_fields = std::make_shared<std::vector<std::string>>();
+      } else if (m_fields.use_count() > 1) {
+        m_fields = std::make_shared<std::vector<std::string>>(*m_fields);
+      }
+      return *m_fields;
+    }
+
+    std::shared_ptr<std::vector<std::string>> m_fields;
+  };
+
+}  // namespace detail
+}  // namespace openstudio
+
+#endif  // UTILITIES_IDF_IDFOBJECTFIELDS_HPP
@@ -9,6 +9,7 @@
 #include <utilities/UtilitiesAPI.hpp>
 #include <utilities/idf/Handle.hpp>
 #include <utilities/idf/IdfObjectDiff.hpp>
+#include <utilities/idf/IdfObjectFields.hpp>
 #include <utilities/idd/IddObject.hpp>
 
 #include <utilities/core/Logger.hpp>
@@ -36,6 +37,8 @@ class OSOptionalQuantity;
 // private namespace
 namespace detail {
 
+  struct IdfObjectTokens;
+
   /** Implementation of IdfObject. */
   class UTILITIES_API IdfObject_Impl
     : public std::enable_shared_from_this<IdfObject_Impl>
@@ -301,6 +304,10 @@ namespace detail {
      *  Prerequisite: iddObject()s must be equal. */
     bool objectListFieldsNonConflicting(const IdfObject& other) const;
 
+    /** Returns true if the field text of this object is still shared with other, as it is after
+     *  one is copied from the other and before either is changed. */
+    bool sharesFieldsWith(const IdfObject_Impl& other) const;
+
     //@}
     /** @name Serialization */
     //@{
@@ -313,6 +320,16 @@ namespace detail {
      *  be invalid at enums::Strictness level None.) */
     static std::shared_ptr<IdfObject_Impl> load(const std::string& text, const IddObject& iddObject);
 
+    /** Constructor from pre-tokenized text and an explicit iddObject. Equivalent to
+     *  load(tokens.legacyText(), iddObject), but does not need to parse the text. tokens.simple
+     *  must be true. */
+    static std::shared_ptr<IdfObject_Impl> load(const IdfObjectTokens& tokens, const IddObject& iddObject);
+
+    /** Constructor from another object and an explicit iddObject. Lays other out as the tokens
+     *  IdfTokenizer would find in its printed text, and loads those. Returns nullptr if other holds
+     *  text that printing would not preserve, see IdfObject::load(const IdfObject&, const IddObject&). */
+    static std::shared_ptr<IdfObject_Impl> load(const IdfObject_Impl& other, const IddObject& iddObject);
+
     /** Serialize this object to os as Idf text. */
     std::ostream& print(std::ostream& os) const;
 
@@ -371,10 +388,27 @@ namespace detail {
     // idd object definition
     IddObject m_iddObject;
 
-    // idf fields
-    std::vector<std::string> m_fields;
+    // idf fields, shared with the object this one was copied from until either is changed
+    IdfObjectFields m_fields;
     std::vector<std::string> m_fieldComments;  // only populated if encounter non-empty, non-default comment
 
+    // parsed value of each real and integer field in m_fields
+    struct NumericField
+    {
+      enum class State : unsigned char
+      {
+        Unparsed,   // not numeric, empty or invalid: getDouble and friends go through getString
+        Number,     // value holds the number
+        Automatic,  // autosize or autocalculate
+      };
+
+      double value = 0.0;
+      State state = State::Unparsed;
+    };
+
+    // parallel to m_fields, and updated each time m_fields changes so that reading it needs no lock
+    std::vector<NumericField> m_numericFields;
+
     // idf differences
     std::vector<IdfObjectDiff> m_diffs;
 
@@ -399,6 +433,21 @@ namespace detail {
 
     virtual bool fieldIsNonnullIfRequired(unsigned index) const;
 
+    // SETTER HELPERS
+
+    /** Called each time the name field is set, before any change signals are emitted. Does nothing
+     *  here, WorkspaceObject_Impl uses it to keep the name lookup of its Workspace current. */
+    virtual void nameChanged();
+
+    /** Reparses m_fields[index] into m_numericFields, after it was set. */
+    void parseNumericField(unsigned index);
+
+    /** Resizes m_numericFields to match m_fields, parsing any field that was added. */
+    void resizeNumericFields();
+
+    /** Reparses all of m_fields into m_numericFields, for instance once m_iddObject changed. */
+    void parseNumericFields();
+
    private:
     IdfObject_Impl() = default;
 
@@ -419,6 +468,9 @@ namespace detail {
     // parse fields
     void parseFields(const std::string& text);
 
+    /* Load already tokenized IdfObject text, see IdfTokenizer. */
+    void parse(const IdfObjectTokens& tokens);
+
     // GETTER AND SETTER HELPERS
 
     /** Set this object's IddObject to iddObject. */
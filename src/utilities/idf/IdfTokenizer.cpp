@@ -0,0 +1,291 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#include "IdfTokenizer.hpp"
+
+#include "../core/ASCIIStrings.hpp"
+
+#include <iterator>
+
+namespace openstudio {
+namespace detail {
+
+  namespace {
+
+    // Same set as std::isspace in the classic locale, which is what boost::trim and the \s regex class used
+    constexpr const char* whitespaceChars = " \f\n\r\t\v";
+
+    // Same set as the \h regex class
+    constexpr const char* blankChars = " \t";
+
+    // A field comment starting with '!-' is a default (editor) comment, and is regenerated on print
+    bool isDefaultFieldComment(std::string_view comment) {
+      return (comment.size() >= 2) && (comment[0] == '!') && (comment[1] == '-');
+    }
+
+  }  // namespace
+
+  std::string IdfObjectTokens::legacyText() const {
+    std::string result;
+    result.reserve(commentBlock.size() + body.size() + 1);
+    result.append(commentBlock);
+    result.push_back('\n');
+    result.append(body);
+    return result;
+  }
+
+  bool IdfObjectTokens::isVersion() const {
+    // equivalent to iddRegex::versionObjectName(), ".*[vV]ersion.*"
+    for (std::size_t i = objectType.find("ersion"); i != std::string_view::npos; i = objectType.find("ersion", i + 1)) {
+      if ((i > 0) && ((objectType[i - 1] == 'v') || (objectType[i - 1] == 'V'))) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  void IdfObjectTokens::clear() {
+    commentBlock = {};
+    body = {};
+    firstLine = {};
+    objectType = {};
+    typeFound = false;
+    simple = false;
+    comments.clear();
+    fields.clear();
+    fieldComments.clear();
+    unparsedText = {};
+  }
+
+  IdfTokenizer::IdfTokenizer(std::string text, bool splitOnly) : m_storage(std::move(text)), m_splitOnly(splitOnly) {
+    // normalize '\r\n' and lone '\r' to '\n' in place, as the boost newline_filter used to do
+    const std::size_t n = m_storage.size();
+    std::size_t out = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+      char c = m_storage[i];
+      if (c == '\r') {
+        if ((i + 1 < n) && (m_storage[i + 1] == '\n')) {
+          ++i;
+        }
+        c = '\n';
+      }
+      m_storage[out++] = c;
+    }
+    m_storage.resize(out);
+
+    // every line is newline terminated, including the last one
+    if (!m_storage.empty() && (m_storage.back() != '\n')) {
+      m_storage.push_back('\n');
+    }
+
+    m_buffer = m_storage;
+  }
+
+  IdfTokenizer::IdfTokenizer(const char* data, std::size_t size, bool splitOnly) : m_splitOnly(splitOnly) {
+    const std::string_view text(data, size);
+    if ((text.find('\r') == std::string_view::npos) && (text.empty() || (text.back() == '\n'))) {
+      m_buffer = text;
+    } else {
+      IdfTokenizer normalized{std::string(text)};
+      m_storage = std::move(normalized.m_storage);
+      m_buffer = m_storage;
+    }
+  }
+
+  std::string IdfTokenizer::readAll(std::istream& is) {
+    return {std::istreambuf_iterator<char>(is), std::istreambuf_iterator<char>()};
+  }
+
+  IdfTokenizer::TokenType IdfTokenizer::next() {
+    const std::string_view buffer = m_buffer;
+    const std::size_t n = buffer.size();
+    std::size_t commentStart = std::string_view::npos;
+
+    while (m_pos < n) {
+      const std::size_t lineBegin = m_pos;
+      const std::size_t lineEnd = buffer.find('\n', lineBegin);
+      const std::string_view line = buffer.substr(lineBegin, lineEnd - lineBegin);
+
+      // comment only line, continue the comment block
+      const std::size_t firstChar = line.find_first_not_of(whitespaceChars);
+      if ((firstChar != std::string_view::npos) && (line[firstChar] == '!')) {
+        if (commentStart == std::string_view::npos) {
+          commentStart = lineBegin;
+        }
+        m_pos = lineEnd + 1;
+        continue;
+      }
+
+      // blank line, ends the comment block
+      if (line.find_first_not_of(blankChars) == std::string_view::npos) {
+        m_pos = lineEnd + 1;
+        if (commentStart != std::string_view::npos) {
+          m_commentBlock = ascii_trim(buffer.substr(commentStart, lineBegin - commentStart));
+          return TokenType::CommentBlock;
+        }
+        continue;
+      }
+
+      // start of an object, which runs through the first line with a ';' before any '!'
+      std::size_t objectEnd = std::string_view::npos;
+      for (std::size_t pos = lineBegin; pos < n;) {
+        const std::size_t end = buffer.find('\n', pos);
+        const std::size_t sep = buffer.substr(pos, end - pos).find_first_of(";!");
+        if ((sep != std::string_view::npos) && (buffer[pos + sep] == ';')) {
+          objectEnd = end + 1;
+          break;
+        }
+        pos = end + 1;
+      }
+
+      if (objectEnd == std::string_view::npos) {
+        // unterminated object at the end of the text is dropped
+        m_pos = n;
+        break;
+      }
+
+      m_objectTokens.clear();
+      if (commentStart != std::string_view::npos) {
+        m_objectTokens.commentBlock = buffer.substr(commentStart, lineBegin - commentStart);
+      }
+      m_objectTokens.body = buffer.substr(lineBegin, objectEnd - lineBegin);
+      m_objectTokens.firstLine = line;
+      m_pos = objectEnd;
+
+      // object type is everything before the first separator on the first line
+      const std::size_t typeSep = line.find_first_of(",;!");
+      if ((typeSep != std::string_view::npos) && (line[typeSep] != '!')) {
+        m_objectTokens.typeFound = true;
+        m_objectTokens.objectType = ascii_trim(line.substr(0, typeSep));
+        if (!m_splitOnly) {
+          tokenizeObject(m_objectTokens);
+        }
+      }
+
+      return TokenType::Object;
+    }
+
+    return TokenType::End;
+  }
+
+  std::string_view IdfTokenizer::commentBlock() const {
+    return m_commentBlock;
+  }
+
+  const IdfObjectTokens& IdfTokenizer::objectTokens() const {
+    return m_objectTokens;
+  }
+
+  std::size_t IdfTokenizer::position() const {
+    return m_pos;
+  }
+
+  std::size_t IdfTokenizer::size() const {
+    return m_buffer.size();
+  }
+
+  void IdfTokenizer::tokenizeObject(IdfObjectTokens& tokens) {
+    if (!tokens.typeFound || tokens.simple) {
+      return;
+    }
+    const std::string_view body = tokens.body;
+    const std::string_view firstLine = tokens.firstLine;
+    const std::size_t typeSep = firstLine.find_first_of(",;");
+
+    // vertical tab and form feed are whitespace in some of the historical rules and not in others,
+    // leave those to the regex parser
+    if ((tokens.commentBlock.find_first_of("\f\v") != std::string_view::npos) || (body.find_first_of("\f\v") != std::string_view::npos)) {
+      return;
+    }
+    tokens.simple = true;
+
+    // preceding comment lines, a bare '!' is dropped
+    const std::string_view commentBlock = tokens.commentBlock;
+    for (std::size_t pos = 0; pos < commentBlock.size();) {
+      const std::size_t end = commentBlock.find('\n', pos);
+      const std::size_t bang = commentBlock.find('!', pos);
+      if (end - bang > 1) {
+        tokens.comments.push_back(commentBlock.substr(bang, end - bang));
+      }
+      pos = end + 1;
+    }
+
+    // a comment after the object type is kept as is, and is followed by more comment lines
+    const std::size_t firstLineEnd = firstLine.size();
+    std::size_t cursor = body.find_first_not_of(whitespaceChars, typeSep + 1);
+    bool trailingComments = true;
+    if ((cursor == std::string_view::npos) || (cursor >= firstLineEnd)) {
+      cursor = firstLineEnd + 1;
+    } else if (body[cursor] == '!') {
+      tokens.comments.push_back(body.substr(cursor, firstLineEnd - cursor));
+      cursor = firstLineEnd + 1;
+    } else {
+      // fields start on the first line
+      trailingComments = false;
+    }
+
+    while (trailingComments) {
+      const std::size_t pos = body.find_first_not_of(whitespaceChars, cursor);
+      if (pos == std::string_view::npos) {
+        cursor = body.size();
+        break;
+      }
+      if (body[pos] != '!') {
+        cursor = pos;
+        break;
+      }
+      const std::size_t end = body.find('\n', pos);
+      if (end - pos > 1) {
+        tokens.comments.push_back(body.substr(pos, end - pos));
+      }
+      cursor = end + 1;
+    }
+
+    tokenizeFields(tokens, std::min(cursor, body.size()), body.size());
+  }
+
+  void IdfTokenizer::tokenizeFields(IdfObjectTokens& tokens, std::size_t begin, std::size_t end) {
+    const std::string_view body = tokens.body.substr(0, end);
+
+    std::size_t start = begin;
+    while (start < end) {
+      // a field runs up to the next separator, a '!' before that skips the rest of its line
+      std::size_t fieldBegin = start;
+      std::size_t sep = body.find_first_of(",;!", fieldBegin);
+      while ((sep != std::string_view::npos) && (body[sep] == '!')) {
+        const std::size_t lineEnd = body.find('\n', sep);
+        if ((lineEnd == std::string_view::npos) || (lineEnd + 1 >= end)) {
+          sep = std::string_view::npos;
+          break;
+        }
+        fieldBegin = lineEnd + 1;
+        sep = body.find_first_of(",;!", fieldBegin);
+      }
+      if (sep == std::string_view::npos) {
+        break;
+      }
+
+      tokens.fields.push_back(ascii_trim(body.substr(fieldBegin, sep - fieldBegin)));
+
+      // the rest of the line is either a comment (or nothing), or more fields
+      const std::size_t lineEnd = body.find('\n', sep + 1);
+      std::string_view comment = ascii_trim(body.substr(sep + 1, lineEnd - sep - 1));
+      if (comment.empty() || (comment.front() == '!')) {
+        start = lineEnd + 1;
+      } else {
+        start = sep + 1;
+        comment = {};
+      }
+      if (isDefaultFieldComment(comment)) {
+        comment = {};
+      }
+      tokens.fieldComments.push_back(comment);
+    }
+
+    tokens.unparsedText = ascii_trim(body.substr(std::min(start, end)));
+  }
+
+}  // namespace detail
+}  // namespace openstudio
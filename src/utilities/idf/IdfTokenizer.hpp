@@ -0,0 +1,128 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#ifndef UTILITIES_IDF_IDFTOKENIZER_HPP
+#define UTILITIES_IDF_IDFTOKENIZER_HPP
+
+#include "../UtilitiesAPI.hpp"
+
+#include <istream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace openstudio {
+namespace detail {
+
+  /** Tokens for a single object in Idf text. All views point into the buffer owned by the
+   *  IdfTokenizer that produced them, and are only valid until its next call to next(). */
+  struct UTILITIES_API IdfObjectTokens
+  {
+    /** Comment lines immediately preceding the object, each terminated by a newline. */
+    std::string_view commentBlock;
+
+    /** The object text, from its first line through the line holding its terminating ';'. */
+    std::string_view body;
+
+    /** First line of body, without the newline. */
+    std::string_view firstLine;
+
+    /** Trimmed object type, only set if typeFound. */
+    std::string_view objectType;
+
+    /** True if the first line has a ',' or ';' before any '!'. */
+    bool typeFound = false;
+
+    /** True if comments, fields and fieldComments below were extracted. If false, the object
+     *  text has to go through the regex based IdfObject::load(legacyText()). */
+    bool simple = false;
+
+    /** Object comment lines, each to be followed by a newline. */
+    std::vector<std::string_view> comments;
+
+    /** Trimmed field values. */
+    std::vector<std::string_view> fields;
+
+    /** Trimmed field comments, parallel to fields. Empty if none, or if the comment is a default
+     *  ('!-') comment. */
+    std::vector<std::string_view> fieldComments;
+
+    /** Trimmed text that could not be assigned to any field. */
+    std::string_view unparsedText;
+
+    /** Returns the text in the form historically handed to IdfObject::load by IdfFile. */
+    std::string legacyText() const;
+
+    /** Returns true if objectType looks like a version object type. */
+    bool isVersion() const;
+
+    void clear();
+  };
+
+  /** IdfTokenizer splits Idf text into comment blocks and objects in a single pass over a
+   *  contiguous buffer, without regular expressions or backtracking. It reproduces the
+   *  line-oriented rules IdfFile has always used: a comment block is a run of lines whose first
+   *  non-whitespace character is '!', terminated by a blank line; an object runs from its first
+   *  line to the first line with a ';' that is not preceded by a '!'. */
+  class UTILITIES_API IdfTokenizer
+  {
+   public:
+    enum class TokenType
+    {
+      End,
+      CommentBlock,
+      Object
+    };
+
+    /** Takes ownership of text. Line endings are normalized to '\n'. If splitOnly, next() stops
+     *  after finding each object's type, see tokenizeObject. */
+    explicit IdfTokenizer(std::string text, bool splitOnly = false);
+
+    /** Tokenizes size chars at data, which must outlive the tokenizer. The text is only copied if
+     *  its line endings need to be normalized. Suited for memory mapped files. */
+    IdfTokenizer(const char* data, std::size_t size, bool splitOnly = false);
+
+    // views point into m_storage
+    IdfTokenizer(const IdfTokenizer& other) = delete;
+    IdfTokenizer& operator=(const IdfTokenizer& other) = delete;
+
+    /** Reads the remainder of is into a string. */
+    static std::string readAll(std::istream& is);
+
+    /** Advances to the next token. */
+    TokenType next();
+
+    /** Trimmed comment block, valid after next() returns TokenType::CommentBlock. */
+    std::string_view commentBlock() const;
+
+    /** Object tokens, valid after next() returns TokenType::Object. */
+    const IdfObjectTokens& objectTokens() const;
+
+    /** Current offset into the buffer. */
+    std::size_t position() const;
+
+    /** Size of the (normalized) buffer. */
+    std::size_t size() const;
+
+    /** Extracts comments, fields and field comments of an object found by next(). Only needed if
+     *  the tokenizer was constructed with splitOnly. Does not touch the tokenizer, so that
+     *  objects can be tokenized concurrently. */
+    static void tokenizeObject(IdfObjectTokens& tokens);
+
+   private:
+    static void tokenizeFields(IdfObjectTokens& tokens, std::size_t begin, std::size_t end);
+
+    std::string m_storage;
+    std::string_view m_buffer;
+    bool m_splitOnly = false;
+    std::size_t m_pos = 0;
+    std::string_view m_commentBlock;
+    IdfObjectTokens m_objectTokens;
+  };
+
+}  // namespace detail
+}  // namespace openstudio
+
+#endif  // UTILITIES_IDF_IDFTOKENIZER_HPP
@@ -14,6 +14,8 @@
 #include <resources.hxx>
 #include <utilities/idd/IddEnums.hxx>
 
+#include <boost/algorithm/string/replace.hpp>
+
 #include <iostream>
 #include <sstream>
 
@@ -74,6 +76,77 @@ TEST_F(IdfFixture, IdfFile_Header) {
   file.setHeader(header);
   EXPECT_EQ("! Multi-line \n! Non-comment.", file.header());
 }
+
+TEST_F(IdfFixture, IdfFile_LoadMatchesIdfObjectLoad) {
+  // Objects exercising the comment and field rules, as {comment block, object text}
+  std::vector<std::pair<std::string, std::string>> texts = {
+    {"! Leading comment\n!\n  ! Indented comment\n",
+     "Zone,  ! Comment on type line\n  ! Comment before first field\n  Zone 1,  !- Name\n"
+     "  0,                       !- Direction of Relative North {deg}\n  0, 0,  ! Two fields on one line\n  ! comment between fields\n"
+     "  0;                       ! Last field, custom comment\n"},
+    {"", "Timestep,6;\n"},
+    {"", "Building,\n  Split\n  Name,\n  ,\n  , ,\n  ;\n"},
+    {"! Dos line endings\n", "Zone,\n  Zone 2;\n"},
+  };
+
+  std::stringstream ss;
+  ss << "! Header" << '\n' << '\n';
+  for (unsigned i = 0, n = texts.size(); i < n; ++i) {
+    std::string text = texts[i].first + texts[i].second + '\n';
+    if (i == n - 1) {
+      replace_all(text, "\n", "\r\n");
+    }
+    ss << text;
+  }
+  ss << "! Stand alone comment" << '\n' << '\n';
+
+  OptionalIdfFile oFile = IdfFile::load(ss, IddFileType::EnergyPlus);
+  ASSERT_TRUE(oFile);
+  EXPECT_EQ("! Header", oFile->header());
+
+  IdfObjectVector objects = oFile->objects();
+  ASSERT_EQ(texts.size() + 1, objects.size());
+  for (unsigned i = 0, n = texts.size(); i < n; ++i) {
+    // IdfFile used to hand IdfObject::load the comment block, a new line, and the object text
+    OptionalIdfObject expected = IdfObject::load(texts[i].first + '\n' + texts[i].second, objects[i].iddObject());
+    ASSERT_TRUE(expected);
+    EXPECT_EQ(expected->iddObject().type(), objects[i].iddObject().type());
+    EXPECT_EQ(expected->comment(), objects[i].comment());
+    ASSERT_EQ(expected->numFields(), objects[i].numFields());
+    for (unsigned j = 0, m = expected->numFields(); j < m; ++j) {
+      EXPECT_EQ(expected->getString(j).get(), objects[i].getString(j).get());
+      EXPECT_TRUE(expected->fieldComment(j) == objects[i].fieldComment(j));
+    }
+  }
+  EXPECT_EQ("! Leading comment\n! Indented comment\n! Comment on type line\n! Comment before first field", objects[0].comment());
+  EXPECT_EQ("Zone 1", objects[0].nameString());
+  EXPECT_EQ("! Last field, custom comment", objects[0].fieldComment(4).get());
+  EXPECT_EQ("Split\n  Name", objects[2].nameString());
+  EXPECT_EQ("! Dos line endings", objects[3].comment());
+  EXPECT_TRUE(objects[texts.size()].iddObject().type() == IddObjectType::CommentOnly);
+}
+
+TEST_F(IdfFixture, IdfFile_LoadParallel) {
+  path p = resourcesPath() / toPath("energyplus/5ZoneAirCooled/in.idf");
+  OptionalIdfFile oSerial = IdfFile::load(p, IddFileType::EnergyPlus);
+  ASSERT_TRUE(oSerial);
+
+  for (unsigned numThreads : {1u, 4u, 0u}) {
+    OptionalIdfFile oParallel = IdfFile::loadParallel(p, IddFileType::EnergyPlus, numThreads);
+    ASSERT_TRUE(oParallel);
+    EXPECT_EQ(oSerial->header(), oParallel->header());
+    EXPECT_EQ(oSerial->numObjects(), oParallel->numObjects());
+
+    std::stringstream serialText;
+    std::stringstream parallelText;
+    oSerial->print(serialText);
+    oParallel->print(parallelText);
+    EXPECT_EQ(serialText.str(), parallelText.str());
+  }
+
+  EXPECT_FALSE(IdfFile::loadParallel(resourcesPath() / toPath("energyplus/DoesNotExist.idf"), IddFileType::EnergyPlus));
+}
+
 /*
 TEST_F(IdfFixture, IdfFile_UnixLineEndings) {
   OptionalIdfFile oFile = IdfFile::load(resourcesPath()/toPath("utilities/Idf/UnixLineEndingTest.idf"));
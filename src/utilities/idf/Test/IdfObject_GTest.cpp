@@ -121,6 +121,58 @@ TEST_F(IdfFixture, IdfObject_ConstructFromText_MultifieldLines) {
   EXPECT_EQ(static_cast<unsigned>(12), groundTemperature.numFields());
 }
 
+TEST_F(IdfFixture, IdfObject_LoadFromObject) {
+  // loading from an object should match loading its printed text
+  auto expectLoadsAsPrinted = [](const IdfObject& object, const IddObject& iddObject) {
+    std::stringstream ss;
+    ss << object;
+    OptionalIdfObject expected = IdfObject::load(ss.str(), iddObject);
+    OptionalIdfObject loaded = IdfObject::load(object, iddObject);
+    ASSERT_TRUE(expected);
+    ASSERT_TRUE(loaded);
+    EXPECT_NE(object.handle(), loaded->handle());
+    EXPECT_EQ(expected->iddObject().name(), loaded->iddObject().name());
+    EXPECT_EQ(expected->comment(), loaded->comment());
+    ASSERT_EQ(expected->numFields(), loaded->numFields());
+    for (unsigned i = 0, n = expected->numFields(); i < n; ++i) {
+      EXPECT_EQ(expected->getString(i).get(), loaded->getString(i).get());
+      EXPECT_EQ(expected->fieldComment(i).get(), loaded->fieldComment(i).get());
+    }
+  };
+
+  std::string text = "! Comment above\n  ! Indented comment\nBuilding, ! Comment on type line\n\
+                      Building,          ! Custom comment \n\
+                      30.0,              !- North Axis (deg) \n\
+                      City;              !- Terrain";
+  OptionalIdfObject oBuilding = IdfObject::load(text);
+  ASSERT_TRUE(oBuilding);
+  EXPECT_TRUE(oBuilding->setFieldComment(2, "Set comment"));
+  expectLoadsAsPrinted(*oBuilding, oBuilding->iddObject());
+
+  // type does not match the IddObject
+  expectLoadsAsPrinted(*oBuilding, IdfObject(IddObjectType::Zone).iddObject());
+  expectLoadsAsPrinted(*oBuilding, IddObject());
+  OptionalIdfObject catchall = IdfObject::load(*oBuilding, IddObject());
+  ASSERT_TRUE(catchall);
+  EXPECT_EQ("Building", catchall->getString(0).get());
+
+  // vertices are printed with default comments only
+  text = "BuildingSurface:Detailed,Wall,Wall,Construction,Zone,,Outdoors,,SunExposed,WindExposed,0.5,4,\n\
+          0,0,3,  ! Vertex comment\n\
+          0,0,0,\n\
+          10,0,0,\n\
+          10,0,3;";
+  OptionalIdfObject oSurface = IdfObject::load(text);
+  ASSERT_TRUE(oSurface);
+  expectLoadsAsPrinted(*oSurface, oSurface->iddObject());
+
+  // text that would not print as is has to go through text
+  OptionalIdfObject oSplit = IdfObject::load("Building,\n  Split\n  Name,\n  ;");
+  ASSERT_TRUE(oSplit);
+  EXPECT_EQ("Split\n  Name", oSplit->nameString());
+  EXPECT_FALSE(IdfObject::load(*oSplit, oSplit->iddObject()));
+}
+
 TEST_F(IdfFixture, IdfObject_CopyConstructor) {
   std::string text = "Building,                !- Building \n\
                       Building,                !- Name \n\
@@ -545,6 +597,69 @@ TEST_F(IdfFixture, IdfObject_IntFieldGetterWithReturnDefaultOption) {
   EXPECT_TRUE(object.getInt(5));
 }
 
+TEST_F(IdfFixture, IdfObject_NumericFieldCache) {
+  std::string text = "Fan:ConstantVolume,\n"
+                     "  Fan,                     !- Name\n"
+                     "  ,                        !- Availability Schedule Name\n"
+                     "  ,                        !- Fan Total Efficiency\n"
+                     "  6.0E+02,                 !- Pressure Rise {Pa}\n"
+                     "  AutoSize;                !- Maximum Flow Rate {m3/s}";
+  OptionalIdfObject oObj = IdfObject::load(text);
+  ASSERT_TRUE(oObj);
+  IdfObject object = *oObj;
+
+  // defaults still come from the Idd
+  EXPECT_FALSE(object.getDouble(2));
+  ASSERT_TRUE(object.getDouble(2, true));
+  EXPECT_DOUBLE_EQ(0.7, object.getDouble(2, true).get());
+  ASSERT_TRUE(object.getDouble(3));
+  EXPECT_DOUBLE_EQ(600.0, object.getDouble(3).get());
+  EXPECT_FALSE(object.getDouble(4));
+  EXPECT_EQ("AutoSize", object.getString(4).get());
+
+  // reads follow writes
+  EXPECT_TRUE(object.setString(3, "250.5"));
+  EXPECT_DOUBLE_EQ(250.5, object.getDouble(3).get());
+  EXPECT_TRUE(object.setDouble(4, 1.25));
+  EXPECT_DOUBLE_EQ(1.25, object.getDouble(4).get());
+  EXPECT_TRUE(object.setString(4, "autocalculate"));
+  EXPECT_FALSE(object.getDouble(4));
+  EXPECT_TRUE(object.setString(3, "not a number"));
+  EXPECT_FALSE(object.getDouble(3));
+  EXPECT_TRUE(object.setString(3, "-12"));
+  ASSERT_TRUE(object.getInt(3));
+  EXPECT_EQ(-12, object.getInt(3).get());
+  EXPECT_FALSE(object.getUnsigned(3));
+  EXPECT_TRUE(object.setString(3, ""));
+  EXPECT_FALSE(object.getDouble(3));
+
+  // text is stored as given
+  EXPECT_TRUE(object.setString(3, "6.0E+02"));
+  std::stringstream ss;
+  object.print(ss);
+  EXPECT_NE(std::string::npos, ss.str().find("6.0E+02,"));
+  EXPECT_DOUBLE_EQ(600.0, object.getDouble(3).get());
+
+  // copies, extensible groups, and pops
+  IdfObject copy = object.clone();
+  EXPECT_DOUBLE_EQ(600.0, copy.getDouble(3).get());
+
+  IdfObject schedule(IddObjectType::OS_Schedule_Day);
+  IdfExtensibleGroup eg = schedule.pushExtensibleGroup(StringVector{"24", "0", "0.5"});
+  ASSERT_FALSE(eg.empty());
+  EXPECT_EQ(24u, eg.getUnsigned(0).get());
+  EXPECT_EQ(0, eg.getInt(1).get());
+  EXPECT_DOUBLE_EQ(0.5, eg.getDouble(2).get());
+  EXPECT_TRUE(eg.setDouble(2, 0.75));
+  EXPECT_DOUBLE_EQ(0.75, eg.getDouble(2).get());
+  unsigned index = eg.groupIndex();
+  EXPECT_FALSE(schedule.popExtensibleGroup().empty());
+  EXPECT_FALSE(schedule.getDouble(schedule.numFields() + 2));
+  eg = schedule.pushExtensibleGroup(StringVector{"12", "30", "1.5"});
+  EXPECT_EQ(index, eg.groupIndex());
+  EXPECT_DOUBLE_EQ(1.5, eg.getDouble(2).get());
+}
+
 TEST_F(IdfFixture, IdfObject_FieldSettingWithHiddenPushes) {
   std::stringstream text;
   OptionalIdfObject oObj;
@@ -513,6 +513,42 @@ TEST_F(IdfFixture, Workspace_Clone) {
   EXPECT_FALSE(cloneHandles == wsHandles);
 }
 
+TEST_F(IdfFixture, Workspace_CloneSharesFields) {
+  Workspace workspace(epIdfFile, StrictnessLevel::Minimal);
+  Workspace clone = workspace.clone(true);
+  ASSERT_EQ(workspace.numObjects(), clone.numObjects());
+
+  // field text is not copied
+  for (const WorkspaceObject& object : workspace.objects()) {
+    OptionalWorkspaceObject cloneObject = clone.getObject(object.handle());
+    ASSERT_TRUE(cloneObject);
+    EXPECT_TRUE(object.getImpl<detail::WorkspaceObject_Impl>()->sharesFieldsWith(*cloneObject->getImpl<detail::WorkspaceObject_Impl>()));
+  }
+
+  // until the object is changed
+  WorkspaceObjectVector zones = workspace.getObjectsByType(IddObjectType::Zone);
+  ASSERT_FALSE(zones.empty());
+  std::string name = zones[0].nameString();
+  OptionalWorkspaceObject cloneZone = clone.getObject(zones[0].handle());
+  ASSERT_TRUE(cloneZone);
+  EXPECT_TRUE(cloneZone->setName("MyNewZoneName"));
+  EXPECT_TRUE(cloneZone->setDouble(ZoneFields::XOrigin, 10.0));
+  EXPECT_FALSE(zones[0].getImpl<detail::WorkspaceObject_Impl>()->sharesFieldsWith(*cloneZone->getImpl<detail::WorkspaceObject_Impl>()));
+  EXPECT_EQ(name, zones[0].nameString());
+  EXPECT_EQ("MyNewZoneName", cloneZone->nameString());
+  EXPECT_DOUBLE_EQ(10.0, cloneZone->getDouble(ZoneFields::XOrigin).get());
+  EXPECT_NE(10.0, zones[0].getDouble(ZoneFields::XOrigin, true).get());
+
+  // the other objects still share theirs
+  unsigned numShared = 0;
+  for (const WorkspaceObject& object : workspace.objects()) {
+    if (object.getImpl<detail::WorkspaceObject_Impl>()->sharesFieldsWith(*clone.getObject(object.handle())->getImpl<detail::WorkspaceObject_Impl>())) {
+      ++numShared;
+    }
+  }
+  EXPECT_EQ(workspace.numObjects() - 1, numShared);
+}
+
 TEST_F(IdfFixture, Workspace_Insert) {
   Workspace workspace(epIdfFile, StrictnessLevel::Minimal);
   unsigned n = workspace.handles().size();
@@ -1006,6 +1042,53 @@ TEST_F(IdfFixture, HospitalBaseline) {
   }
 }
 
+struct ProgressValueRecorder
+{
+  void record(int value) {
+    values.push_back(value);
+  }
+  std::vector<int> values;
+};
+
+TEST_F(IdfFixture, Workspace_ValidityReportParallel) {
+  OptionalIdfFile oIdfFile = IdfFile::load(resourcesPath() / toPath("energyplus/HospitalBaseline/in.idf"));
+  ASSERT_TRUE(oIdfFile);
+  Workspace ws(*oIdfFile);
+
+  // add a few errors: field type and bound, a required object missing, a name conflict
+  std::vector<WorkspaceObject> zones = ws.getObjectsByType(IddObjectType::Zone);
+  ASSERT_LT(2u, zones.size());
+  EXPECT_TRUE(zones[0].setString(ZoneFields::XOrigin, "not a number"));
+  EXPECT_TRUE(zones[1].setString(ZoneFields::Multiplier, "-2"));
+  EXPECT_TRUE(zones[2].setName(zones[1].nameString()));
+  for (WorkspaceObject& object : ws.getObjectsByType(IddObjectType::Building)) {
+    object.remove();
+  }
+
+  for (StrictnessLevel level : {StrictnessLevel::Minimal, StrictnessLevel::Draft, StrictnessLevel::Final}) {
+    ProgressValueRecorder serialProgress;
+    ws.getImpl<detail::Workspace_Impl>()->progressValue.connect<ProgressValueRecorder, &ProgressValueRecorder::record>(&serialProgress);
+    ValidityReport serial = ws.validityReport(level);
+    ws.getImpl<detail::Workspace_Impl>()->progressValue.disconnect<ProgressValueRecorder, &ProgressValueRecorder::record>(&serialProgress);
+    EXPECT_LT(0u, serial.numErrors());
+
+    std::stringstream serialText;
+    serialText << serial;
+    for (unsigned numThreads : {1u, 4u, 0u}) {
+      ProgressValueRecorder parallelProgress;
+      ws.getImpl<detail::Workspace_Impl>()->progressValue.connect<ProgressValueRecorder, &ProgressValueRecorder::record>(&parallelProgress);
+      ValidityReport parallel = ws.validityReport(level, numThreads);
+      ws.getImpl<detail::Workspace_Impl>()->progressValue.disconnect<ProgressValueRecorder, &ProgressValueRecorder::record>(&parallelProgress);
+
+      EXPECT_EQ(serial.numErrors(), parallel.numErrors());
+      std::stringstream parallelText;
+      parallelText << parallel;
+      EXPECT_EQ(serialText.str(), parallelText.str());
+      EXPECT_EQ(serialProgress.values, parallelProgress.values);
+    }
+  }
+}
+
 TEST_F(IdfFixture, Workspace_InsertDifferentObjectSameName) {
   Workspace ws(StrictnessLevel::Draft, IddFileType::EnergyPlus);
 
@@ -1991,6 +2074,47 @@ TEST_F(IdfFixture, Workspace_NextName) {
   EXPECT_EQ("Zone 2", ws.nextName(IddObjectType::Zone, true));
 }
 
+TEST_F(IdfFixture, Workspace_NextName_Gaps) {
+  Workspace ws(StrictnessLevel::Draft, IddFileType::EnergyPlus);
+
+  std::vector<WorkspaceObject> zones;
+  for (unsigned i = 0; i < 5; ++i) {
+    boost::optional<WorkspaceObject> zone = ws.addObject(IdfObject(IddObjectType::Zone));
+    ASSERT_TRUE(zone);
+    EXPECT_EQ("Zone " + std::to_string(i + 1), zone->name().get());
+    zones.push_back(*zone);
+  }
+  EXPECT_EQ("Zone 6", ws.nextName(IddObjectType::Zone, true));
+
+  // removed suffixes are filled in, smallest first
+  EXPECT_TRUE(ws.removeObject(zones[3].handle()));
+  EXPECT_TRUE(ws.removeObject(zones[1].handle()));
+  EXPECT_EQ("Zone 6", ws.nextName(IddObjectType::Zone, false));
+  EXPECT_EQ("Zone 2", ws.nextName(IddObjectType::Zone, true));
+  boost::optional<WorkspaceObject> zone = ws.addObject(IdfObject(IddObjectType::Zone));
+  ASSERT_TRUE(zone);
+  EXPECT_EQ("Zone 2", zone->name().get());
+  EXPECT_EQ("Zone 4", ws.nextName(IddObjectType::Zone, true));
+
+  // removing the largest suffix drops the gap below it
+  EXPECT_TRUE(zones[4].setName("Zone 10"));
+  EXPECT_EQ("Zone 4", ws.nextName(IddObjectType::Zone, true));
+  EXPECT_EQ("Zone 11", ws.nextName(IddObjectType::Zone, false));
+  EXPECT_TRUE(zones[4].setName("Perimeter"));
+  EXPECT_TRUE(zones[2].setName("Core"));
+  EXPECT_EQ("Zone 3", ws.nextName(IddObjectType::Zone, false));
+  EXPECT_EQ("Zone 3", ws.nextName(IddObjectType::Zone, true));
+
+  // nextName by name spans all types, nextName by type only that type
+  boost::optional<WorkspaceObject> building = ws.addObject(IdfObject(IddObjectType::Building));
+  ASSERT_TRUE(building);
+  EXPECT_TRUE(building->setName("zone_7"));
+  EXPECT_EQ("Zone 3", ws.nextName(IddObjectType::Zone, false));
+  EXPECT_EQ("Zone_8", ws.nextName("Zone 1", false));
+  EXPECT_EQ("Zone_3", ws.nextName("Zone", true));
+  EXPECT_EQ("Core 1", ws.nextName("Core", true));
+}
+
 TEST_F(IdfFixture, Workspace_GetObjectsByNameUUID) {
   Workspace ws(StrictnessLevel::Draft, IddFileType::EnergyPlus);
 
@@ -2028,6 +2152,101 @@ TEST_F(IdfFixture, Workspace_GetObjectsByNameUUID) {
   EXPECT_EQ(1u, ws.getObjectsByName("{af63d539-6e16-4fd1-a10e-dafe3793373b}", false).size());
 }
 
+TEST_F(IdfFixture, Workspace_GetObjectsByName_NameIndex) {
+  Workspace ws(StrictnessLevel::Draft, IddFileType::EnergyPlus);
+
+  boost::optional<WorkspaceObject> zone = ws.addObject(IdfObject(IddObjectType::Zone));
+  ASSERT_TRUE(zone);
+  boost::optional<WorkspaceObject> building = ws.addObject(IdfObject(IddObjectType::Building));
+  ASSERT_TRUE(building);
+  EXPECT_TRUE(building->setName("Zone 7"));
+
+  // case insensitive, with and without suffix
+  EXPECT_EQ(1u, ws.getObjectsByName("zONE 1", true).size());
+  EXPECT_EQ(2u, ws.getObjectsByName("ZONE", false).size());
+  EXPECT_EQ(2u, ws.getObjectsByName("zone 3", false).size());
+  ASSERT_TRUE(ws.getObjectByTypeAndName(IddObjectType::Building, "zone 7"));
+  EXPECT_EQ(building->handle(), ws.getObjectByTypeAndName(IddObjectType::Building, "zone 7")->handle());
+  EXPECT_FALSE(ws.getObjectByTypeAndName(IddObjectType::Zone, "zone 7"));
+  EXPECT_EQ(1u, ws.getObjectsByTypeAndName(IddObjectType::Zone, "Zone").size());
+
+  // name set through setString
+  EXPECT_TRUE(zone->setString(ZoneFields::Name, "Core_ZN"));
+  EXPECT_EQ(0u, ws.getObjectsByName("Zone 1", true).size());
+  EXPECT_EQ(1u, ws.getObjectsByName("Zone", false).size());
+  ASSERT_EQ(1u, ws.getObjectsByName("core_zn", true).size());
+  EXPECT_EQ(zone->handle(), ws.getObjectsByName("core_zn", true)[0].handle());
+  EXPECT_EQ(0u, ws.getObjectsByName("core", false).size());
+
+  // removal
+  Handle buildingHandle = building->handle();
+  EXPECT_TRUE(ws.removeObject(buildingHandle));
+  EXPECT_EQ(0u, ws.getObjectsByName("Zone 7", true).size());
+  EXPECT_EQ(0u, ws.getObjectsByName("Zone", false).size());
+  EXPECT_FALSE(ws.getObject(buildingHandle));
+
+  // clone and swap carry the index along
+  Workspace clone = ws.clone();
+  ASSERT_EQ(1u, clone.getObjectsByName("CORE_ZN", true).size());
+  EXPECT_NE(zone->handle(), clone.getObjectsByName("CORE_ZN", true)[0].handle());
+  EXPECT_TRUE(clone.getObjectsByName("CORE_ZN", true)[0].setName("Perimeter_ZN_1"));
+  EXPECT_EQ(1u, clone.getObjectsByName("perimeter_zn", false).size());
+  EXPECT_EQ(0u, ws.getObjectsByName("perimeter_zn", false).size());
+
+  ws.swap(clone);
+  EXPECT_EQ(1u, ws.getObjectsByName("Perimeter_ZN_1", true).size());
+  EXPECT_EQ(0u, ws.getObjectsByName("Core_ZN", true).size());
+  EXPECT_EQ(1u, clone.getObjectsByName("Core_ZN", true).size());
+  EXPECT_TRUE(ws.getObjectsByName("Perimeter_ZN_1", true)[0].setName("Perimeter_ZN_2"));
+  EXPECT_EQ(1u, ws.getObjectsByName("Perimeter_ZN_2", true).size());
+  EXPECT_EQ(0u, clone.getObjectsByName("Perimeter_ZN", false).size());
+}
+
+TEST_F(IdfFixture, Workspace_GetObjectByNameAndReference) {
+  Workspace ws(StrictnessLevel::Draft, IddFileType::EnergyPlus);
+
+  boost::optional<WorkspaceObject> material = ws.addObject(IdfObject(IddObjectType::Material));
+  ASSERT_TRUE(material);
+  EXPECT_TRUE(material->setName("Brick"));
+  StringVector materialNames(1u, "MaterialName");
+  StringVector constructionNames(1u, "ConstructionNames");
+
+  ASSERT_TRUE(ws.getObjectByNameAndReference("BRICK", materialNames));
+  EXPECT_EQ(material->handle(), ws.getObjectByNameAndReference("BRICK", materialNames)->handle());
+  EXPECT_FALSE(ws.getObjectByNameAndReference("Brick", constructionNames));
+
+  // same name in another reference list is not a conflict, and pointers resolve within their list
+  IdfObject construction(IddObjectType::Construction);
+  EXPECT_TRUE(construction.setName("brick"));
+  EXPECT_FALSE(construction.pushExtensibleGroup(StringVector(1u, "Brick")).empty());
+  boost::optional<WorkspaceObject> wsConstruction = ws.addObject(construction);
+  ASSERT_TRUE(wsConstruction);
+  EXPECT_EQ("brick", wsConstruction->nameString());
+  ASSERT_TRUE(wsConstruction->getTarget(1u));
+  EXPECT_EQ(material->handle(), wsConstruction->getTarget(1u)->handle());
+  ASSERT_TRUE(ws.getObjectByNameAndReference("Brick", constructionNames));
+  EXPECT_EQ(wsConstruction->handle(), ws.getObjectByNameAndReference("Brick", constructionNames)->handle());
+  EXPECT_EQ(2u, ws.getObjectsByName("Brick").size());
+
+  // rename keeps the reference list index current
+  EXPECT_TRUE(material->setName("Block"));
+  EXPECT_FALSE(ws.getObjectByNameAndReference("Brick", materialNames));
+  ASSERT_TRUE(ws.getObjectByNameAndReference("block", materialNames));
+  EXPECT_EQ(material->handle(), ws.getObjectByNameAndReference("block", materialNames)->handle());
+
+  // same name in the same reference list is a conflict
+  boost::optional<WorkspaceObject> material2 = ws.addObject(IdfObject(IddObjectType::Material));
+  ASSERT_TRUE(material2);
+  EXPECT_TRUE(material2->setName("Block"));
+  EXPECT_EQ("Block 1", material2->nameString());
+  EXPECT_EQ(1u, ws.getObjectsByNameAndReference("Block", materialNames).size());
+  EXPECT_EQ(1u, ws.getObjectsByNameAndReference("Block 1", materialNames).size());
+
+  // removal
+  EXPECT_TRUE(ws.removeObject(material2->handle()));
+  EXPECT_FALSE(ws.getObjectByNameAndReference("Block 1", materialNames));
+}
+
 TEST_F(IdfFixture, Workspace_DuplicateObjectName) {
   Workspace ws(StrictnessLevel::Draft, IddFileType::EnergyPlus);
 
@@ -15,10 +15,14 @@
 #include "../plot/ProgressBar.hpp"
 
 #include "../core/Assert.hpp"
+#include "../core/ParallelFor.hpp"
 #include "../core/StringHelpers.hpp"
 
 #include <boost/lexical_cast.hpp>
+#include <algorithm>
+#include <cctype>
 #include <memory>
+#include <vector>
 
 using namespace std;
 using openstudio::istringEqual;  // used for all name comparisons
@@ -27,6 +31,19 @@ namespace openstudio {
 
 namespace detail {
 
+  namespace {
+
+    // key under which name is filed in the name indices, consistent with istringEqual
+    std::string nameIndexKey(const std::string& name) {
+      std::string result(name);
+      for (char& c : result) {
+        c = static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+      }
+      return result;
+    }
+
+  }  // namespace
+
   // CONSTRUCTORS
 
   Workspace_Impl::Workspace_Impl(StrictnessLevel level, IddFileType iddFileType)
@@ -151,6 +168,20 @@ namespace detail {
     IdfReferencesMap tirm = m_idfReferencesMap;
     m_idfReferencesMap = otherImpl->m_idfReferencesMap;
     otherImpl->m_idfReferencesMap = tirm;
+
+    m_nameIndex.swap(otherImpl->m_nameIndex);
+    m_baseNameIndex.swap(otherImpl->m_baseNameIndex);
+    m_idfReferencesNameIndex.swap(otherImpl->m_idfReferencesNameIndex);
+    m_indexedNames.swap(otherImpl->m_indexedNames);
+    m_nameSeries.swap(otherImpl->m_nameSeries);
+
+    // objects report name changes to the workspace that holds them
+    for (const WorkspaceObjectMap::value_type& p : m_workspaceObjectMap) {
+      p.second->m_workspace = this;
+    }
+    for (const WorkspaceObjectMap::value_type& p : otherImpl->m_workspaceObjectMap) {
+      p.second->m_workspace = otherImpl.get();
+    }
   }
 
   // GETTERS
@@ -314,7 +345,13 @@ namespace detail {
   std::vector<WorkspaceObject> Workspace_Impl::getObjectsByName(const std::string& name, bool exactMatch) const {
     WorkspaceObjectVector result;
     if (exactMatch) {
-      for (const WorkspaceObjectMap::value_type& p : m_workspaceObjectMap) {
+      auto loc = m_nameIndex.find(nameIndexKey(name));
+      if (loc == m_nameIndex.end()) {
+        return result;
+      }
+      result.reserve(loc->second.size());
+      for (const WorkspaceObjectMap::value_type& p : loc->second) {
+        // the name field may have been popped since the object was filed
         if (OptionalString candidate = p.second->name()) {
           if (istringEqual(*candidate, name)) {
             result.push_back(WorkspaceObject(p.second));
@@ -323,7 +360,12 @@ namespace detail {
       }
     } else {
       std::string baseName = getBaseName(name);
-      for (const WorkspaceObjectMap::value_type& p : m_workspaceObjectMap) {
+      auto loc = m_baseNameIndex.find(nameIndexKey(baseName));
+      if (loc == m_baseNameIndex.end()) {
+        return result;
+      }
+      result.reserve(loc->second.size());
+      for (const WorkspaceObjectMap::value_type& p : loc->second) {
         if (OptionalString candidate = p.second->name()) {
           if (baseNamesMatch(baseName, *candidate)) {
             result.push_back(WorkspaceObject(p.second));
@@ -358,9 +400,8 @@ namespace detail {
   }
 
   boost::optional<WorkspaceObject> Workspace_Impl::getObjectByTypeAndName(IddObjectType objectType, const std::string& name) const {
-    for (const WorkspaceObject& object : getObjectsByType(objectType)) {
-      OptionalString candidate = object.name();
-      if (candidate && istringEqual(*candidate, name)) {
+    for (const WorkspaceObject& object : getObjectsByName(name, true)) {
+      if (object.iddObject().type() == objectType) {
         return object;
       }
     }
@@ -369,12 +410,9 @@ namespace detail {
 
   std::vector<WorkspaceObject> Workspace_Impl::getObjectsByTypeAndName(IddObjectType objectType, const std::string& name) const {
     WorkspaceObjectVector result;
-    std::string baseName = getBaseName(name);
-    for (const WorkspaceObject& object : getObjectsByType(objectType)) {
-      if (OptionalString candidate = object.name()) {
-        if (baseNamesMatch(baseName, *candidate)) {
-          result.push_back(object);
-        }
+    for (const WorkspaceObject& object : getObjectsByName(name, false)) {
+      if (object.iddObject().type() == objectType) {
+        result.push_back(object);
       }
     }
     return result;
@@ -411,15 +449,54 @@ namespace detail {
 
   boost::optional<WorkspaceObject> Workspace_Impl::getObjectByNameAndReference(const std::string& name,
                                                                                const std::vector<std::string>& referenceNames) const {
-    for (const WorkspaceObject& object : getObjectsByReference(referenceNames)) {
-      OptionalString candidate = object.name();
-      if (candidate && istringEqual(*candidate, name)) {
-        return object;
+    std::string key = nameIndexKey(name);
+    for (const std::string& referenceName : referenceNames) {
+      auto rloc = m_idfReferencesNameIndex.find(referenceName);
+      if (rloc == m_idfReferencesNameIndex.end()) {
+        continue;
+      }
+      auto loc = rloc->second.find(key);
+      if (loc == rloc->second.end()) {
+        continue;
+      }
+      for (const WorkspaceObjectMap::value_type& p : loc->second) {
+        OptionalString candidate = p.second->name();
+        if (candidate && istringEqual(*candidate, name)) {
+          return WorkspaceObject(p.second);
+        }
       }
     }
     return boost::none;
   }
 
+  std::vector<WorkspaceObject> Workspace_Impl::getObjectsByNameAndReference(const std::string& name,
+                                                                            const std::vector<std::string>& referenceNames) const {
+    WorkspaceObjectMap objectMap;
+    std::string key = nameIndexKey(name);
+    for (const std::string& referenceName : referenceNames) {
+      auto rloc = m_idfReferencesNameIndex.find(referenceName);
+      if (rloc == m_idfReferencesNameIndex.end()) {
+        continue;
+      }
+      auto loc = rloc->second.find(key);
+      if (loc == rloc->second.end()) {
+        continue;
+      }
+      for (const WorkspaceObjectMap::value_type& p : loc->second) {
+        OptionalString candidate = p.second->name();
+        if (candidate && istringEqual(*candidate, name)) {
+          objectMap.insert(p);
+        }
+      }
+    }
+    std::vector<WorkspaceObject> result;
+    result.reserve(objectMap.size());
+    for (auto it = objectMap.begin(); it != objectMap.end(); ++it) {
+      result.push_back(it->second);
+    }
+    return result;
+  }
+
   bool Workspace_Impl::fastNaming() const {
     return m_fastNaming;
   }
@@ -556,6 +633,7 @@ namespace detail {
       m_workspaceObjectMap.insert(WorkspaceObjectMap::value_type(newHandles.back(), ptr));
       insertIntoIddObjectTypeMap(ptr);
       insertIntoIdfReferencesMap(ptr);
+      insertIntoNameIndex(ptr);
       this->progressValue.nano_emit(++i);
     }
 
@@ -1564,8 +1642,8 @@ namespace detail {
       return toString(createUUID());
     }
 
-    WorkspaceObjectVector objectsInSeries = getObjectsByName(name, false);
-    return constructNextName(name, objectsInSeries, fillIn);
+    auto loc = m_nameSeries.find(nameIndexKey(getBaseName(name)));
+    return constructNextName(name, (loc == m_nameSeries.end()) ? nullptr : &loc->second.all, fillIn);
   }
 
   std::string Workspace_Impl::nextName(const IddObjectType& iddObjectType, bool fillIn) const {
@@ -1578,8 +1656,15 @@ namespace detail {
       return {};
     }
     std::string name = iddObjectNameToIdfObjectName(iddObject->name());
-    WorkspaceObjectVector objectsInSeries = getObjectsByTypeAndName(iddObjectType, name);
-    return constructNextName(name, objectsInSeries, fillIn);
+    const NameSuffixes* series = nullptr;
+    auto loc = m_nameSeries.find(nameIndexKey(getBaseName(name)));
+    if (loc != m_nameSeries.end()) {
+      auto typeLoc = loc->second.byType.find(iddObjectType);
+      if (typeLoc != loc->second.byType.end()) {
+        series = &typeLoc->second;
+      }
+    }
+    return constructNextName(name, series, fillIn);
   }
 
   bool Workspace_Impl::isValid() const {
@@ -1596,6 +1681,10 @@ namespace detail {
   }
 
   ValidityReport Workspace_Impl::validityReport(StrictnessLevel level) const {
+    return validityReport(level, 1u);
+  }
+
+  ValidityReport Workspace_Impl::validityReport(StrictnessLevel level, unsigned numThreads) const {
     ValidityReport report(level);
 
     int i = 0;
@@ -1613,9 +1702,13 @@ namespace detail {
       // \todo Only way there can be no IddFile is if IddFileType is set to UserCustom
 
       // by-object items
+      std::vector<std::shared_ptr<WorkspaceObject_Impl>> objects;
+      objects.reserve(m_workspaceObjectMap.size());
       for (const WorkspaceObjectMap::value_type& p : m_workspaceObjectMap) {
+        objects.push_back(p.second);
 
-        //find all objects with the same name
+        //find all objects with the same name (also fills the name field cache of each IddObject before
+        //the objects are checked concurrently)
 
         OptionalString oName = p.second->name();
         if (oName) {
@@ -1638,12 +1731,20 @@ namespace detail {
             mapOfNames[*oName] = pair<bool, std::shared_ptr<WorkspaceObject_Impl>>(false, p.second);
           }
         }
+      }
+
+      // object-level errors, in the order they go into report. Only reads the objects and this
+      // workspace, so that objects can be checked concurrently.
+      std::vector<std::vector<DataError>> objectErrors(objects.size());
+      auto checkObject = [this, level, &objects, &objectErrors](std::size_t k) {
+        const std::shared_ptr<WorkspaceObject_Impl>& object = objects[k];
+        std::vector<DataError>& errors = objectErrors[k];
 
         // object-level report
-        ValidityReport objectReport = p.second->validityReport(level, false);
+        ValidityReport objectReport = object->validityReport(level, false);
         OptionalDataError oError = objectReport.nextError();
         while (oError) {
-          report.insertError(*oError);
+          errors.push_back(*oError);
           oError = objectReport.nextError();
         }
 
@@ -1652,17 +1753,36 @@ namespace detail {
           // DataErrorType::NoIdd
           // object-level
           if (iddFileType() == IddFileType::UserCustom) {
-            if (!m_iddFileAndFactoryWrapper.isInFile(p.second->iddObject().name())) {
-              report.insertError(DataError(WorkspaceObject(p.second), DataErrorType(DataErrorType::NoIdd)));
+            if (!m_iddFileAndFactoryWrapper.isInFile(object->iddObject().name())) {
+              errors.push_back(DataError(WorkspaceObject(object), DataErrorType(DataErrorType::NoIdd)));
             }
           } else {
-            if (!m_iddFileAndFactoryWrapper.isInFile(p.second->iddObject().type())) {
-              report.insertError(DataError(WorkspaceObject(p.second), DataErrorType(DataErrorType::NoIdd)));
+            if (!m_iddFileAndFactoryWrapper.isInFile(object->iddObject().type())) {
+              errors.push_back(DataError(WorkspaceObject(object), DataErrorType(DataErrorType::NoIdd)));
             }
           }
         }  // StrictnessLevel::Draft
-
+      };
+      auto mergeObject = [this, &report, &objectErrors, &i](std::size_t k) {
+        for (const DataError& error : objectErrors[k]) {
+          report.insertError(error);
+        }
+        objectErrors[k].clear();
         this->progressValue.nano_emit(++i);
+      };
+
+      if (parallelThreadCount(objects.size(), numThreads, 64) == 1) {
+        for (std::size_t k = 0; k < objects.size(); ++k) {
+          checkObject(k);
+          mergeObject(k);
+        }
+      } else {
+        // hand out chunks of objects to the threads, then merge on this thread in the serial order
+        parallelForChunks(objects.size(), numThreads, 64, [&checkObject](unsigned /*threadIndex*/, std::size_t k) { checkObject(k); });
+
+        for (std::size_t k = 0; k < objects.size(); ++k) {
+          mergeObject(k);
+        }
       }
     }
 
@@ -1927,6 +2047,9 @@ namespace detail {
     // IdfReferencesMap
     insertIntoIdfReferencesMap(ptr);
 
+    // NameIndex
+    insertIntoNameIndex(ptr);
+
     return true;
   }
 
@@ -1944,6 +2067,175 @@ namespace detail {
       m_idfReferencesMap[referenceName].insert(std::make_pair(objectImplPtr->handle(), objectImplPtr));
     }
   }
+
+  void Workspace_Impl::insertIntoNameIndex(const std::shared_ptr<WorkspaceObject_Impl>& objectImplPtr) {
+    OptionalString name = objectImplPtr->name();
+    if (!name) {
+      return;
+    }
+    Handle handle = objectImplPtr->handle();
+    std::string key = nameIndexKey(*name);
+    m_nameIndex[key].insert(std::make_pair(handle, objectImplPtr));
+    m_baseNameIndex[nameIndexKey(getBaseName(*name))].insert(std::make_pair(handle, objectImplPtr));
+    for (const std::string& referenceName : objectImplPtr->iddObject().references()) {
+      m_idfReferencesNameIndex[referenceName][key].insert(std::make_pair(handle, objectImplPtr));
+    }
+    m_indexedNames[handle] = *name;
+
+    std::tuple<boost::optional<int>, std::string> suffix = getNameSuffix(*name);
+    if (std::get<0>(suffix)) {
+      bool underscore = (std::get<1>(suffix) == "_");
+      NameSeries& series = m_nameSeries[nameIndexKey(getBaseName(*name))];
+      series.all.insert(*std::get<0>(suffix), underscore);
+      series.byType[objectImplPtr->iddObject().type()].insert(*std::get<0>(suffix), underscore);
+    }
+  }
+
+  void Workspace_Impl::removeFromNameIndex(const std::shared_ptr<WorkspaceObject_Impl>& objectImplPtr) {
+    Handle handle = objectImplPtr->handle();
+    auto inLoc = m_indexedNames.find(handle);
+    if (inLoc == m_indexedNames.end()) {
+      return;
+    }
+    auto eraseFrom = [&handle](NameIndex& index, const std::string& key) {
+      auto loc = index.find(key);
+      OS_ASSERT(loc != index.end());
+      loc->second.erase(handle);
+      // erase entry if set is empty
+      if (loc->second.empty()) {
+        index.erase(loc);
+      }
+    };
+    std::string key = nameIndexKey(inLoc->second);
+    eraseFrom(m_nameIndex, key);
+    eraseFrom(m_baseNameIndex, nameIndexKey(getBaseName(inLoc->second)));
+    for (const std::string& referenceName : objectImplPtr->iddObject().references()) {
+      auto rloc = m_idfReferencesNameIndex.find(referenceName);
+      OS_ASSERT(rloc != m_idfReferencesNameIndex.end());
+      eraseFrom(rloc->second, key);
+      // erase entry if index is empty
+      if (rloc->second.empty()) {
+        m_idfReferencesNameIndex.erase(rloc);
+      }
+    }
+
+    std::tuple<boost::optional<int>, std::string> suffix = getNameSuffix(inLoc->second);
+    if (std::get<0>(suffix)) {
+      bool underscore = (std::get<1>(suffix) == "_");
+      auto sloc = m_nameSeries.find(nameIndexKey(getBaseName(inLoc->second)));
+      OS_ASSERT(sloc != m_nameSeries.end());
+      sloc->second.all.erase(*std::get<0>(suffix), underscore);
+      auto tloc = sloc->second.byType.find(objectImplPtr->iddObject().type());
+      OS_ASSERT(tloc != sloc->second.byType.end());
+      tloc->second.erase(*std::get<0>(suffix), underscore);
+      // erase entries if series is empty
+      if (tloc->second.empty()) {
+        sloc->second.byType.erase(tloc);
+      }
+      if (sloc->second.all.empty()) {
+        m_nameSeries.erase(sloc);
+      }
+    }
+    m_indexedNames.erase(inLoc);
+  }
+
+  void Workspace_Impl::NameSuffixes::insert(int suffix, bool underscore) {
+    auto [loc, inserted] = taken.try_emplace(suffix, 0u, 0u);
+    if (underscore) {
+      ++loc->second.second;
+    } else {
+      ++loc->second.first;
+    }
+    if (!inserted) {
+      return;
+    }
+
+    if (std::next(loc) == taken.end()) {
+      // new largest suffix, the suffixes between the previous largest one and this one are free
+      int previous = (loc == taken.begin()) ? 0 : std::prev(loc)->first;
+      if (suffix - previous > 1) {
+        gaps.emplace(previous + 1, suffix - 1);
+      }
+    } else {
+      // split the run of free suffixes holding suffix
+      auto gap = std::prev(gaps.upper_bound(suffix));
+      OS_ASSERT((gap->first <= suffix) && (suffix <= gap->second));
+      int first = gap->first;
+      int last = gap->second;
+      gaps.erase(gap);
+      if (first < suffix) {
+        gaps.emplace(first, suffix - 1);
+      }
+      if (suffix < last) {
+        gaps.emplace(suffix + 1, last);
+      }
+    }
+  }
+
+  void Workspace_Impl::NameSuffixes::erase(int suffix, bool underscore) {
+    auto loc = taken.find(suffix);
+    OS_ASSERT(loc != taken.end());
+    unsigned& count = underscore ? loc->second.second : loc->second.first;
+    OS_ASSERT(count > 0);
+    --count;
+    if ((loc->second.first > 0) || (loc->second.second > 0)) {
+      return;
+    }
+
+    if (std::next(loc) == taken.end()) {
+      // largest suffix, the run of free suffixes below it goes too
+      int previous = (loc == taken.begin()) ? 0 : std::prev(loc)->first;
+      gaps.erase(previous + 1);
+    } else {
+      // free suffix, merged with the runs of free suffixes on either side
+      int first = suffix;
+      int last = suffix;
+      auto after = gaps.find(suffix + 1);
+      if (after != gaps.end()) {
+        last = after->second;
+        gaps.erase(after);
+      }
+      auto before = gaps.lower_bound(suffix);
+      if ((before != gaps.begin()) && (std::prev(before)->second == suffix - 1)) {
+        --before;
+        first = before->first;
+        gaps.erase(before);
+      }
+      gaps.emplace(first, last);
+    }
+    taken.erase(loc);
+  }
+
+  bool Workspace_Impl::NameSuffixes::empty() const {
+    return taken.empty();
+  }
+
+  int Workspace_Impl::NameSuffixes::nextSuffix(bool fillIn) const {
+    if (taken.empty()) {
+      return 1;
+    }
+    if (fillIn && !gaps.empty()) {
+      return gaps.begin()->first;
+    }
+    return taken.rbegin()->first + 1;
+  }
+
+  std::string Workspace_Impl::NameSuffixes::spacer() const {
+    if (!taken.empty() && (taken.rbegin()->second.second > taken.rbegin()->second.first)) {
+      return "_";
+    }
+    return " ";
+  }
+
+  void Workspace_Impl::updateNameIndex(const Handle& handle) {
+    auto womIt = m_workspaceObjectMap.find(handle);
+    if (womIt == m_workspaceObjectMap.end()) {
+      // not added yet, will be filed on addition
+      return;
+    }
+    removeFromNameIndex(womIt->second);
+    insertIntoNameIndex(womIt->second);
+  }
   bool Workspace_Impl::resolvePotentialNameConflicts(Workspace& other) {
     return resolvePotentialNameConflicts(other, std::vector<unsigned>());
   }
@@ -2135,6 +2427,9 @@ namespace detail {
       }
     }
 
+    // NameIndex
+    removeFromNameIndex(objectImplPtr);
+
     // IddObjectTypeMap
     auto iotmLoc = m_iddObjectTypeMap.find(objectImplPtr->iddObject().type());
     OS_ASSERT(iotmLoc != m_iddObjectTypeMap.end());
@@ -2210,6 +2505,9 @@ namespace detail {
     // IdfReferencesMap
     insertIntoIdfReferencesMap(savedObject.objectImplPtr);
 
+    // NameIndex
+    insertIntoNameIndex(savedObject.objectImplPtr);
+
     // Fix Pointers
     savedObject.objectImplPtr->restorePointers();
 
@@ -2228,37 +2526,9 @@ namespace detail {
 
   // QUERIES
 
-  std::string Workspace_Impl::constructNextName(const std::string& objectName, const std::vector<WorkspaceObject>& objectsInTheSeries,
-                                                bool fillIn) const {
-    vector<int> takenValues;
-    std::tuple<boost::optional<int>, std::string> takenSuffix;
-    for (const WorkspaceObject& object : objectsInTheSeries) {
-      takenSuffix = getNameSuffix(*(object.name()));
-      if (std::get<0>(takenSuffix)) {
-        takenValues.push_back(*std::get<0>(takenSuffix));
-      }
-    }
-    std::sort(takenValues.begin(), takenValues.end());
-    takenValues.erase(std::unique(takenValues.begin(), takenValues.end()), takenValues.end());
-
-    int suffix(1);
-    if (fillIn) {
-      for (int usedSuffix : takenValues) {
-        if (usedSuffix == suffix) {
-          ++suffix;
-        } else {
-          break;
-        }
-      }
-    } else {
-      if (!takenValues.empty()) {
-        suffix = *(takenValues.rbegin()) + 1;
-      }
-    }
-    std::string spacer = std::get<1>(takenSuffix);
-    if (spacer.empty()) {
-      spacer = " ";
-    }
+  std::string Workspace_Impl::constructNextName(const std::string& objectName, const NameSuffixes* series, bool fillIn) const {
+    int suffix = series ? series->nextSuffix(fillIn) : 1;
+    std::string spacer = series ? series->spacer() : std::string(" ");
     return getBaseName(objectName) + spacer + boost::lexical_cast<std::string>(suffix);
   }
 
@@ -2523,6 +2793,10 @@ boost::optional<WorkspaceObject> Workspace::getObjectByNameAndReference(const st
   return m_impl->getObjectByNameAndReference(name, referenceNames);
 }
 
+std::vector<WorkspaceObject> Workspace::getObjectsByNameAndReference(const std::string& name, const StringVector& referenceNames) const {
+  return m_impl->getObjectsByNameAndReference(name, referenceNames);
+}
+
 bool Workspace::fastNaming() const {
   return m_impl->fastNaming();
 }
@@ -2657,6 +2931,10 @@ ValidityReport Workspace::validityReport(StrictnessLevel level) const {
   return m_impl->validityReport(level);
 }
 
+ValidityReport Workspace::validityReport(StrictnessLevel level, unsigned numThreads) const {
+  return m_impl->validityReport(level, numThreads);
+}
+
 bool Workspace::operator==(const Workspace& other) const {
   return (m_impl == other.m_impl);
 }
@@ -199,6 +199,10 @@ class UTILITIES_API Workspace
    *  conflicts. */
   boost::optional<WorkspaceObject> getObjectByNameAndReference(const std::string& name, const std::vector<std::string>& referenceNames) const;
 
+  /** Returns all objects that are in at least one of the reference lists in referenceNames and
+   *  named name (case insensitive, but exact match). */
+  std::vector<WorkspaceObject> getObjectsByNameAndReference(const std::string& name, const std::vector<std::string>& referenceNames) const;
+
   /** Overloaded functions that take in a std::string instead of an IddObjectType.
    *  They will internally create an IddObjectType (which may throw!) then forward to the overload method that takes IddObjectType
    *  eg: `getObjectsByType(IddObjectType objectType)` */
@@ -377,6 +381,11 @@ class UTILITIES_API Workspace
   /** Returns a ValidityReport for this Workspace containing all errors at or below level. */
   ValidityReport validityReport(StrictnessLevel level) const;
 
+  /** Returns the same ValidityReport as validityReport(level), including the progress signals, but
+   *  checks individual objects on numThreads threads. Name conflicts and collection-level errors
+   *  are still checked serially. If numThreads is 0, std::thread::hardware_concurrency() is used. */
+  ValidityReport validityReport(StrictnessLevel level, unsigned numThreads) const;
+
   bool operator==(const Workspace& other) const;
 
   bool operator!=(const Workspace& other) const;
@@ -1072,6 +1072,12 @@ namespace detail {
     }
   }
 
+  void WorkspaceObject_Impl::nameChanged() {
+    if (m_workspace && !m_handle.isNull()) {
+      m_workspace->updateNameIndex(m_handle);
+    }
+  }
+
   // PRIVATE
 
   // SETTERS
@@ -1181,6 +1187,7 @@ namespace detail {
       if (m_fieldComments.size() > m_fields.size()) {
         m_fieldComments.resize(m_fields.size());
       }
+      resizeNumericFields();
     } else {
       return false;
     }
@@ -1231,15 +1238,13 @@ namespace detail {
     if (!oName) {
       return true;
     }
-    WorkspaceObjectVector candidates = m_workspace->getObjectsByReference(iddObject().references());
+    WorkspaceObjectVector candidates = m_workspace->getObjectsByNameAndReference(*oName, iddObject().references());
     for (const WorkspaceObject& candidate : candidates) {
       if ((candidate.iddObject().type() == openstudio::IddObjectType::OS_Connection)
           || (candidate.iddObject().type() == openstudio::IddObjectType::OS_PortList)) {
         continue;
       }
-      OptionalString candidateName = candidate.name();
-      OS_ASSERT(candidateName);
-      if ((istringEqual(*oName, *candidateName) && (!initialized() || (getObject<WorkspaceObject>() != candidate)))) {
+      if (!initialized() || (candidate.getImpl<WorkspaceObject_Impl>().get() != this)) {
         return false;
       }
     }
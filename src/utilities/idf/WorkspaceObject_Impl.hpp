@@ -297,6 +297,9 @@ namespace detail {
      *  objects. */
     void restorePointers();
 
+    /** Files this object under its new name in m_workspace. */
+    virtual void nameChanged() override;
+
     // QUERY HELPERS
 
     virtual void populateValidityReport(ValidityReport& report, bool checkNames) const override;
@@ -172,6 +172,10 @@ namespace detail {
      *  conflicts. */
     boost::optional<WorkspaceObject> getObjectByNameAndReference(const std::string& name, const std::vector<std::string>& referenceNames) const;
 
+    /** Returns all objects that are in at least one of the reference lists in referenceNames and
+     *  named name (case insensitive, but exact match). */
+    std::vector<WorkspaceObject> getObjectsByNameAndReference(const std::string& name, const std::vector<std::string>& referenceNames) const;
+
     /** Returns true if fast naming is enabled. */
     bool fastNaming() const;
 
@@ -373,6 +377,10 @@ namespace detail {
     /** Returns a ValidityReport for this Workspace containing all errors at or below level. */
     virtual ValidityReport validityReport(StrictnessLevel level) const;
 
+    /** Returns the same ValidityReport as validityReport(level), checking individual objects on
+     *  numThreads threads. If numThreads is 0, std::thread::hardware_concurrency() is used. */
+    ValidityReport validityReport(StrictnessLevel level, unsigned numThreads) const;
+
     /** Returns an IdfObject based on the Version IddObject appropriate for this Workspace. No
      *  public interface. Used in constructing Workspaces. */
     IdfObject versionObjectToAdd() const;
@@ -440,6 +448,10 @@ namespace detail {
 
     void change();
 
+    /** Refiles the object with handle under its current name in the name indices. Called by
+     *  WorkspaceObject_Impl each time its name field is set. */
+    void updateNameIndex(const Handle& handle);
+
    protected:
     // helper for non-virtual part of clone implementation
     void createAndAddClonedObjects(const std::shared_ptr<Workspace_Impl>& thisImpl, std::shared_ptr<Workspace_Impl> cloneImpl,
@@ -471,6 +483,48 @@ namespace detail {
     using IdfReferencesMap = std::unordered_map<std::string, WorkspaceObjectMap>;  // , IstringCompare
     IdfReferencesMap m_idfReferencesMap;
 
+    // maps of upper case name, and of upper case name less any integer suffix, to set of objects
+    // identified by UUID. supports case insensitive getObjectsByName without a scan.
+    using NameIndex = std::unordered_map<std::string, WorkspaceObjectMap>;
+    NameIndex m_nameIndex;
+    NameIndex m_baseNameIndex;
+
+    // map of reference to name index of the objects in that reference list
+    using IdfReferencesNameIndex = std::unordered_map<std::string, NameIndex>;
+    IdfReferencesNameIndex m_idfReferencesNameIndex;
+
+    // map of UUID to the name each object is filed under in the name indices
+    using IndexedNameMap = std::unordered_map<Handle, std::string, boost::hash<boost::uuids::uuid>>;
+    IndexedNameMap m_indexedNames;
+
+    // integer suffixes taken by the names of a series (the names sharing a base name), along with the runs of free suffixes
+    // below the largest one, so that the next name is found without walking the series
+    struct NameSuffixes
+    {
+      // number of names with each suffix, separated from the base name by a space and by an underscore
+      std::map<int, std::pair<unsigned, unsigned>> taken;
+      // first to last suffix of each run of free suffixes below the largest taken one
+      std::map<int, int> gaps;
+
+      void insert(int suffix, bool underscore);
+      void erase(int suffix, bool underscore);
+      bool empty() const;
+      // smallest free suffix if fillIn, otherwise one more than the largest taken suffix
+      int nextSuffix(bool fillIn) const;
+      // separator used by the largest taken suffix
+      std::string spacer() const;
+    };
+
+    struct NameSeries
+    {
+      NameSuffixes all;
+      std::map<IddObjectType, NameSuffixes> byType;
+    };
+
+    // map of upper case base name to the suffixes taken in that series, supports nextName without a scan
+    using NameSeriesIndex = std::unordered_map<std::string, NameSeries>;
+    NameSeriesIndex m_nameSeries;
+
     // data object for undos
     struct SavedWorkspaceObject
     {
@@ -512,6 +566,10 @@ namespace detail {
 
     void insertIntoIdfReferencesMap(const std::shared_ptr<WorkspaceObject_Impl>& object);
 
+    void insertIntoNameIndex(const std::shared_ptr<WorkspaceObject_Impl>& object);
+
+    void removeFromNameIndex(const std::shared_ptr<WorkspaceObject_Impl>& object);
+
     // note default parameter for toIgnore is empty vector
     bool resolvePotentialNameConflicts(Workspace& other, const std::vector<unsigned>& toIgnore);
 
@@ -548,8 +606,8 @@ namespace detail {
 
     // QUERIES
 
-    /** Returns name with the next available integer suffix. */
-    std::string constructNextName(const std::string& objectName, const std::vector<WorkspaceObject>& objectsInTheSeries, bool fillIn) const;
+    /** Returns the base name of objectName with the next available integer suffix in series, if any. */
+    std::string constructNextName(const std::string& objectName, const NameSuffixes* series, bool fillIn) const;
 
     std::vector<std::vector<WorkspaceObject>> nameConflicts(const std::vector<WorkspaceObject>& candidates) const;
 
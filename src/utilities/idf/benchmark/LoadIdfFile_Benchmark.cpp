@@ -6,13 +6,22 @@
 #include <benchmark/benchmark.h>
 
 #include "../IdfFile.hpp"
+#include "../IdfRegex.hpp"
+#include "../../idd/CommentRegex.hpp"
+#include "../../idd/IddFileAndFactoryWrapper.hpp"
 #include "../../core/Filesystem.hpp"
+#include "../../core/PathHelpers.hpp"
 #include "../../core/Assert.hpp"
 
+#include <utilities/idd/IddEnums.hxx>
+
 #include <resources.hxx>
 
 #include <OpenStudio.hxx>
 
+#include <boost/iostreams/filter/newline.hpp>
+#include <boost/iostreams/filtering_stream.hpp>
+
 using namespace openstudio;
 
 static void BM_LoadIdfFile(benchmark::State& state, const std::string& testCase) {
@@ -24,6 +33,75 @@ static void BM_LoadIdfFile(benchmark::State& state, const std::string& testCase)
   }
 }
 
+static void BM_LoadIdfFile_Parallel(benchmark::State& state, const std::string& testCase) {
+
+  path idfPath = resourcesPath() / toPath(testCase);
+  IddFileType iddFileType = (getFileExtension(idfPath) == "osm") ? IddFileType::OpenStudio : IddFileType::EnergyPlus;
+
+  for (auto _ : state) {
+    OptionalIdfFile oIdfFile = IdfFile::loadParallel(idfPath, iddFileType, static_cast<unsigned>(state.range(0)));
+  }
+}
+
+// The line by line, regex driven parse that IdfFile::load used before IdfTokenizer, kept here for comparison.
+// Comment only objects and the version object bookkeeping are left out, they do not weigh on the timing.
+static std::vector<IdfObject> loadWithRegexes(std::istream& is, const IddFileAndFactoryWrapper& iddWrapper) {
+  std::vector<IdfObject> result;
+  std::string line;
+  std::string comment;
+  boost::smatch matches;
+
+  boost::iostreams::filtering_istream filt;
+  filt.push(boost::iostreams::newline_filter(boost::iostreams::newline::posix));
+  filt.push(is);
+
+  while (std::getline(filt, line)) {
+    if (boost::regex_match(line, idfRegex::commentOnlyLine())) {
+      comment += (line + idfRegex::newLinestring());
+    } else if (boost::regex_match(line, commentRegex::whitespaceOnlyLine())) {
+      comment = "";
+    } else {
+      std::string objectType("Catchall");
+      if (boost::regex_search(line, matches, idfRegex::line())) {
+        objectType = std::string(matches[1].first, matches[1].second);
+        boost::trim(objectType);
+      }
+      OptionalIddObject iddObject = iddWrapper.getObject(objectType);
+      if (!iddObject) {
+        iddObject = IddObject();
+      }
+
+      std::string text(comment + idfRegex::newLinestring() + line + idfRegex::newLinestring());
+      comment = "";
+      bool foundEndLine = boost::regex_match(line, idfRegex::objectEnd());
+      while ((!foundEndLine) && (std::getline(filt, line))) {
+        text += (line + idfRegex::newLinestring());
+        foundEndLine = boost::regex_match(line, idfRegex::objectEnd());
+      }
+
+      if (foundEndLine) {
+        if (OptionalIdfObject object = IdfObject::load(text, *iddObject)) {
+          result.push_back(*object);
+        }
+      }
+    }
+  }
+  return result;
+}
+
+static void BM_LoadIdfFile_Regex(benchmark::State& state, const std::string& testCase) {
+
+  path idfPath = resourcesPath() / toPath(testCase);
+  IddFileType iddFileType = (getFileExtension(idfPath) == "osm") ? IddFileType::OpenStudio : IddFileType::EnergyPlus;
+  IddFileAndFactoryWrapper iddWrapper(iddFileType);
+
+  for (auto _ : state) {
+    openstudio::filesystem::ifstream inFile(idfPath);
+    std::vector<IdfObject> objects = loadWithRegexes(inFile, iddWrapper);
+    benchmark::DoNotOptimize(objects);
+  }
+}
+
 BENCHMARK_CAPTURE(BM_LoadIdfFile, 5ZoneAirCooled, std::string("energyplus/5ZoneAirCooled/in.idf"))->Unit(benchmark::kMillisecond);
 BENCHMARK_CAPTURE(BM_LoadIdfFile, Daylighting_School, std::string("energyplus/Daylighting_School/in.idf"))->Unit(benchmark::kMillisecond);
 BENCHMARK_CAPTURE(BM_LoadIdfFile, SmallOffice, std::string("energyplus/SmallOffice/SmallOffice.idf"))->Unit(benchmark::kMillisecond);
@@ -34,3 +112,24 @@ BENCHMARK_CAPTURE(BM_LoadIdfFile, RefBldgLargeOffice, std::string("energyplus/Re
 BENCHMARK_CAPTURE(BM_LoadIdfFile, HospitalBaseline, std::string("energyplus/HospitalBaseline/in.idf"))->Unit(benchmark::kMillisecond);
 
 BENCHMARK_CAPTURE(BM_LoadIdfFile, exampleModel_osm, std::string("model/exampleModel.osm"))->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(BM_LoadIdfFile_Regex, Office_With_Many_HVAC_Types, std::string("energyplus/Office_With_Many_HVAC_Types/in.idf"))
+  ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_LoadIdfFile_Regex, RefBldgLargeOffice, std::string("energyplus/RefLargeOffice/RefBldgLargeOfficeNew2004_Chicago.idf"))
+  ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_LoadIdfFile_Regex, HospitalBaseline, std::string("energyplus/HospitalBaseline/in.idf"))->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(BM_LoadIdfFile_Regex, exampleModel_osm, std::string("model/exampleModel.osm"))->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(BM_LoadIdfFile_Parallel, RefBldgLargeOffice, std::string("energyplus/RefLargeOffice/RefBldgLargeOfficeNew2004_Chicago.idf"))
+  ->RangeMultiplier(2)
+  ->Range(1, 16)
+  ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_LoadIdfFile_Parallel, HospitalBaseline, std::string("energyplus/HospitalBaseline/in.idf"))
+  ->RangeMultiplier(2)
+  ->Range(1, 16)
+  ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_LoadIdfFile_Parallel, exampleModel_osm, std::string("model/exampleModel.osm"))
+  ->RangeMultiplier(2)
+  ->Range(1, 16)
+  ->Unit(benchmark::kMillisecond);
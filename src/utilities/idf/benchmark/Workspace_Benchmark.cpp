@@ -89,6 +89,35 @@ static void BM_WorkspaceSetNameWithoutAnyChecks(benchmark::State& state) {
   state.SetComplexityN(state.range(0));
 }
 
+static void BM_WorkspaceGetObjectsByName(benchmark::State& state) {
+  Workspace w = setUpMinimalWorkspace(state.range(0));
+
+  std::vector<std::string> names;
+  for (const auto& obj : w.getObjectsByType(IddObjectType::OS_Space)) {
+    names.push_back(obj.nameString());
+  }
+
+  // Code inside this loop is measured repeatedly
+  for (auto _ : state) {
+    for (const auto& name : names) {
+      benchmark::DoNotOptimize(w.getObjectsByName(name, true));
+    }
+  }
+
+  state.SetComplexityN(state.range(0));
+}
+
+static void BM_WorkspaceGetObjectsByBaseName(benchmark::State& state) {
+  Workspace w = setUpWorkspaceWithNObjectsOfEveryType(state.range(0));
+
+  // Code inside this loop is measured repeatedly
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(w.getObjectsByName("Space", false));
+  }
+
+  state.SetComplexityN(state.range(0));
+}
+
 // Regular run, with n=512
 /*
 BENCHMARK(BM_WorkspaceSetNameWithChecks)->Unit(benchmark::kMillisecond)->Arg(512);
@@ -99,3 +128,7 @@ BENCHMARK(BM_WorkspaceSetNameWithoutAnyChecks)->Unit(benchmark::kMillisecond)->A
 BENCHMARK(BM_WorkspaceSetNameWithChecks)->Unit(benchmark::kMillisecond)->RangeMultiplier(8)->Range(2, 2048)->Complexity();
 
 BENCHMARK(BM_WorkspaceSetNameWithoutAnyChecks)->Unit(benchmark::kMillisecond)->RangeMultiplier(8)->Range(2, 2048)->Complexity();
+
+BENCHMARK(BM_WorkspaceGetObjectsByName)->Unit(benchmark::kMillisecond)->RangeMultiplier(8)->Range(2, 2048)->Complexity();
+
+BENCHMARK(BM_WorkspaceGetObjectsByBaseName)->Unit(benchmark::kMicrosecond)->RangeMultiplier(8)->Range(2, 2048)->Complexity();
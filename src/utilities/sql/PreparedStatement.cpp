@@ -52,6 +52,23 @@ int PreparedStatement::execute() {
   return code;
 }
 
+bool PreparedStatement::step() {
+  return sqlite3_step(m_statement) == SQLITE_ROW;
+}
+
+void PreparedStatement::reset() {
+  sqlite3_reset(m_statement);
+  sqlite3_clear_bindings(m_statement);
+}
+
+int PreparedStatement::columnInt(int column) const {
+  return sqlite3_column_int(m_statement, column);
+}
+
+double PreparedStatement::columnDouble(int column) const {
+  return sqlite3_column_double(m_statement, column);
+}
+
 boost::optional<double> PreparedStatement::execAndReturnFirstDouble() const {
   boost::optional<double> value;
   if (m_db) {
@@ -114,6 +114,16 @@ class UTILITIES_API PreparedStatement
   // Executes a **SINGLE** statement
   int execute();
 
+  /// step to the next row of a query, returns true if there is a row to read with the column accessors
+  [[nodiscard]] bool step();
+
+  /// reset the statement and clear its bindings, so that it can be bound and executed again
+  void reset();
+
+  [[nodiscard]] int columnInt(int column) const;
+
+  [[nodiscard]] double columnDouble(int column) const;
+
   [[nodiscard]] boost::optional<double> execAndReturnFirstDouble() const;
 
   [[nodiscard]] boost::optional<int> execAndReturnFirstInt() const;
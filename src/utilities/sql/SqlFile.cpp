@@ -2147,6 +2147,28 @@ TimeSeriesVector SqlFile::timeSeries(const SqlFileTimeSeriesQuery& query) {
   return result;
 }
 
+bool SqlFile::enableTimeSeriesCache() {
+  bool result = false;
+  if (m_impl) {
+    result = m_impl->enableTimeSeriesCache();
+  }
+  return result;
+}
+
+void SqlFile::disableTimeSeriesCache() {
+  if (m_impl) {
+    m_impl->disableTimeSeriesCache();
+  }
+}
+
+openstudio::path SqlFile::timeSeriesCachePath() const {
+  openstudio::path result;
+  if (m_impl) {
+    result = m_impl->timeSeriesCachePath();
+  }
+  return result;
+}
+
 boost::optional<std::pair<DateTime, DateTime>> SqlFile::daylightSavingsPeriod() const {
   boost::optional<std::pair<DateTime, DateTime>> result;
   if (m_impl) {
@@ -1135,6 +1135,18 @@ class UTILITIES_API SqlFile
    *  down by ReportingFrequency and determine how many TimeSeries will be returned. */
   std::vector<TimeSeries> timeSeries(const SqlFileTimeSeriesQuery& query);
 
+  /** Maps a binary cache of all the time series of this file, stored at timeSeriesCachePath(). The cache is built from the
+   *  database the first time, and whenever the file changed since. Time series are then read from the cache instead of the
+   *  database, which makes repeated passes over the results of a long simulation much faster. Returns false if the cache could
+   *  not be built. */
+  bool enableTimeSeriesCache();
+
+  /// stops reading time series from the cache, the cache file is kept
+  void disableTimeSeriesCache();
+
+  /// path of the time series cache, next to this file
+  openstudio::path timeSeriesCachePath() const;
+
   //@}
   /** @name Illuminance Map Interface */
   //@{
@@ -0,0 +1,352 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#include "SqlFileTimeSeriesCache.hpp"
+
+#include "../core/Path.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <tuple>
+#include <type_traits>
+
+namespace openstudio {
+namespace detail {
+
+  namespace {
+
+    // All records are written in the native byte order, a cache written on a machine with another byte order is rebuilt
+    constexpr char cacheMagic[8] = {'O', 'S', 'T', 'S', 'C', 'A', 'C', 'H'};
+    constexpr std::uint32_t cacheByteOrder = 0x01020304;
+    constexpr std::uint32_t cacheVersion = 1;
+
+    // The file is a Header, followed by the values of all series, the seconds from first report of all axes, then the AxisRecords
+    // and the EntryRecords sorted by key. All offsets are in bytes from the start of the file, and multiples of 8.
+    struct Header
+    {
+      char magic[8];
+      std::uint32_t byteOrder;
+      std::uint32_t version;
+      std::uint64_t fileSize;
+      std::int64_t lastWriteTime;
+      std::uint64_t numDataDictionaryItems;
+      std::uint64_t axesOffset;
+      std::uint64_t numAxes;
+      std::uint64_t entriesOffset;
+      std::uint64_t numEntries;
+    };
+
+    // DateTime is rebuilt as DateTime(Date(Jan, 1[, baseYear]) + days, seconds of day, utcOffset), which restores its base year
+    struct AxisRecord
+    {
+      std::int32_t hasFirstReport;
+      std::int32_t hasBaseYear;
+      std::int32_t baseYear;
+      std::int32_t daysFromBaseYear;
+      std::int64_t secondsOfDay;
+      double utcOffset;
+      std::uint32_t hasInterval;
+      std::uint32_t intervalMinutes;
+      std::uint64_t secondsOffset;
+      std::uint64_t numSeconds;
+    };
+
+    struct EntryRecord
+    {
+      std::int32_t table;
+      std::int32_t recordIndex;
+      std::int32_t envPeriodIndex;
+      std::uint32_t timeAxis;
+      std::uint64_t valuesOffset;
+      std::uint64_t numValues;
+    };
+
+    static_assert(std::is_trivially_copyable_v<Header> && (sizeof(Header) % 8 == 0));
+    static_assert(std::is_trivially_copyable_v<AxisRecord> && (sizeof(AxisRecord) % 8 == 0));
+    static_assert(std::is_trivially_copyable_v<EntryRecord> && (sizeof(EntryRecord) % 8 == 0));
+
+    // -1 if the series of the table are not cached
+    std::int32_t tableId(const std::string& table) {
+      if (table == "ReportVariableData") {
+        return 0;
+      } else if (table == "ReportMeterData") {
+        return 1;
+      }
+      return -1;
+    }
+
+    auto entryKey(const EntryRecord& entry) {
+      return std::make_tuple(entry.table, entry.recordIndex, entry.envPeriodIndex);
+    }
+
+    template <typename T>
+    T readRecord(const char* data, std::size_t offset) {
+      T result;
+      std::memcpy(&result, data + offset, sizeof(T));
+      return result;
+    }
+
+    template <typename T>
+    void writeRecord(openstudio::filesystem::ofstream& os, const T& record) {
+      os.write(reinterpret_cast<const char*>(&record), sizeof(T));
+    }
+
+  }  // namespace
+
+  boost::optional<TimeSeries> SqlFileTimeAxis::timeSeries(const Vector& values, const std::string& units) const {
+    boost::optional<TimeSeries> ts;
+    if (firstReportDateTime && !secondsFromFirstReport.empty()) {
+      if (intervalMinutes) {
+        openstudio::Time intervalTime(0, 0, *intervalMinutes, 0);
+        ts = openstudio::TimeSeries(*firstReportDateTime, intervalTime, values, units);
+      } else {
+        ts = openstudio::TimeSeries(*firstReportDateTime, secondsFromFirstReport, values, units);
+      }
+    }
+    return ts;
+  }
+
+  boost::optional<SqlFileTimeSeriesCache::Fingerprint> SqlFileTimeSeriesCache::fingerprint(const openstudio::path& sqlPath,
+                                                                                           std::size_t numDataDictionaryItems) {
+    boost::system::error_code ec;
+    Fingerprint result;
+    result.fileSize = openstudio::filesystem::file_size(sqlPath, ec);
+    if (ec) {
+      return boost::none;
+    }
+    result.lastWriteTime = openstudio::filesystem::last_write_time(sqlPath, ec);
+    if (ec) {
+      return boost::none;
+    }
+    result.numDataDictionaryItems = numDataDictionaryItems;
+    return result;
+  }
+
+  struct SqlFileTimeSeriesCache::Writer::Impl
+  {
+    openstudio::path cachePath;
+    openstudio::path tempPath;
+    openstudio::filesystem::ofstream os;
+    std::uint64_t offset = sizeof(Header);
+    std::vector<EntryRecord> entries;
+    bool finished = false;
+  };
+
+  SqlFileTimeSeriesCache::Writer::Writer(const openstudio::path& cachePath) : m_impl(std::make_unique<Impl>()) {
+    m_impl->cachePath = cachePath;
+    m_impl->tempPath = cachePath;
+    m_impl->tempPath += toPath(".tmp");
+    m_impl->os.open(m_impl->tempPath, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+
+    // placeholder, rewritten by finish
+    Header header{};
+    writeRecord(m_impl->os, header);
+  }
+
+  SqlFileTimeSeriesCache::Writer::~Writer() {
+    if (!m_impl->finished) {
+      m_impl->os.close();
+      boost::system::error_code ec;
+      openstudio::filesystem::remove(m_impl->tempPath, ec);
+    }
+  }
+
+  void SqlFileTimeSeriesCache::Writer::addTimeSeries(const DataDictionaryItem& dataDictionaryItem, std::size_t timeAxisIndex,
+                                                     const std::vector<double>& values) {
+    EntryRecord entry{};
+    entry.table = tableId(dataDictionaryItem.table);
+    if (entry.table < 0) {
+      return;
+    }
+    entry.recordIndex = dataDictionaryItem.recordIndex;
+    entry.envPeriodIndex = dataDictionaryItem.envPeriodIndex;
+    entry.timeAxis = static_cast<std::uint32_t>(timeAxisIndex);
+    entry.valuesOffset = m_impl->offset;
+    entry.numValues = values.size();
+    m_impl->entries.push_back(entry);
+
+    m_impl->os.write(reinterpret_cast<const char*>(values.data()), static_cast<std::streamsize>(values.size() * sizeof(double)));
+    m_impl->offset += values.size() * sizeof(double);
+  }
+
+  bool SqlFileTimeSeriesCache::Writer::finish(const std::vector<SqlFileTimeAxis>& timeAxes, const Fingerprint& fingerprint) {
+    openstudio::filesystem::ofstream& os = m_impl->os;
+
+    // seconds from first report of each axis
+    std::vector<AxisRecord> axisRecords;
+    axisRecords.reserve(timeAxes.size());
+    for (const SqlFileTimeAxis& timeAxis : timeAxes) {
+      AxisRecord record{};
+      if (timeAxis.firstReportDateTime) {
+        const Date date = timeAxis.firstReportDateTime->date();
+        record.hasFirstReport = 1;
+        record.hasBaseYear = date.baseYear() ? 1 : 0;
+        record.baseYear = date.baseYear() ? *date.baseYear() : date.assumedBaseYear();
+        const Date baseDate = date.baseYear() ? Date(MonthOfYear::Jan, 1, record.baseYear) : Date(MonthOfYear::Jan, 1);
+        record.daysFromBaseYear = static_cast<std::int32_t>(std::lround((date - baseDate).totalDays()));
+        record.secondsOfDay = timeAxis.firstReportDateTime->time().totalSeconds();
+        record.utcOffset = timeAxis.firstReportDateTime->utcOffset();
+      }
+      if (timeAxis.intervalMinutes) {
+        record.hasInterval = 1;
+        record.intervalMinutes = *timeAxis.intervalMinutes;
+      }
+      record.secondsOffset = m_impl->offset;
+      record.numSeconds = timeAxis.secondsFromFirstReport.size();
+      axisRecords.push_back(record);
+
+      std::vector<std::int64_t> seconds(timeAxis.secondsFromFirstReport.begin(), timeAxis.secondsFromFirstReport.end());
+      os.write(reinterpret_cast<const char*>(seconds.data()), static_cast<std::streamsize>(seconds.size() * sizeof(std::int64_t)));
+      m_impl->offset += seconds.size() * sizeof(std::int64_t);
+    }
+
+    Header header{};
+    std::memcpy(header.magic, cacheMagic, sizeof(cacheMagic));
+    header.byteOrder = cacheByteOrder;
+    header.version = cacheVersion;
+    header.fileSize = fingerprint.fileSize;
+    header.lastWriteTime = fingerprint.lastWriteTime;
+    header.numDataDictionaryItems = fingerprint.numDataDictionaryItems;
+
+    header.axesOffset = m_impl->offset;
+    header.numAxes = axisRecords.size();
+    for (const AxisRecord& record : axisRecords) {
+      writeRecord(os, record);
+    }
+    m_impl->offset += axisRecords.size() * sizeof(AxisRecord);
+
+    std::vector<EntryRecord>& entries = m_impl->entries;
+    std::sort(entries.begin(), entries.end(), [](const EntryRecord& lhs, const EntryRecord& rhs) { return entryKey(lhs) < entryKey(rhs); });
+    header.entriesOffset = m_impl->offset;
+    header.numEntries = entries.size();
+    for (const EntryRecord& entry : entries) {
+      writeRecord(os, entry);
+    }
+
+    os.seekp(0);
+    writeRecord(os, header);
+    os.close();
+    if (os.fail()) {
+      return false;
+    }
+
+    boost::system::error_code ec;
+    openstudio::filesystem::remove(m_impl->cachePath, ec);
+    openstudio::filesystem::rename(m_impl->tempPath, m_impl->cachePath, ec);
+    if (ec) {
+      return false;
+    }
+    m_impl->finished = true;
+    return true;
+  }
+
+  std::unique_ptr<SqlFileTimeSeriesCache> SqlFileTimeSeriesCache::open(const openstudio::path& cachePath, const Fingerprint& fingerprint) {
+    boost::system::error_code ec;
+    if (!openstudio::filesystem::exists(cachePath, ec) || (openstudio::filesystem::file_size(cachePath, ec) < sizeof(Header))) {
+      return nullptr;
+    }
+
+    std::unique_ptr<SqlFileTimeSeriesCache> result(new SqlFileTimeSeriesCache());
+    try {
+      result->m_file.open(cachePath.native());
+    } catch (const std::exception& e) {
+      LOG(Warn, "Cannot map time series cache '" << toString(cachePath) << "': " << e.what());
+      return nullptr;
+    }
+    const char* data = result->m_file.data();
+    const std::size_t size = result->m_file.size();
+
+    const auto header = readRecord<Header>(data, 0);
+    if ((std::memcmp(header.magic, cacheMagic, sizeof(cacheMagic)) != 0) || (header.byteOrder != cacheByteOrder) || (header.version != cacheVersion)) {
+      return nullptr;
+    }
+    if ((header.fileSize != fingerprint.fileSize) || (header.lastWriteTime != fingerprint.lastWriteTime)
+        || (header.numDataDictionaryItems != fingerprint.numDataDictionaryItems)) {
+      LOG(Debug, "Time series cache '" << toString(cachePath) << "' is out of date");
+      return nullptr;
+    }
+    if ((header.axesOffset > size) || (header.numAxes > (size - header.axesOffset) / sizeof(AxisRecord)) || (header.entriesOffset > size)
+        || (header.numEntries > (size - header.entriesOffset) / sizeof(EntryRecord))) {
+      return nullptr;
+    }
+
+    // axes are few, decode them all once
+    result->m_timeAxes.reserve(header.numAxes);
+    for (std::uint64_t i = 0; i < header.numAxes; ++i) {
+      const auto record = readRecord<AxisRecord>(data, header.axesOffset + i * sizeof(AxisRecord));
+      if ((record.secondsOffset > size) || (record.numSeconds > (size - record.secondsOffset) / sizeof(std::int64_t))) {
+        return nullptr;
+      }
+
+      SqlFileTimeAxis timeAxis;
+      if (record.hasFirstReport != 0) {
+        Date date = record.hasBaseYear ? Date(MonthOfYear::Jan, 1, record.baseYear) : Date(MonthOfYear::Jan, 1);
+        if (date.assumedBaseYear() != record.baseYear) {
+          return nullptr;
+        }
+        date += Time(record.daysFromBaseYear, 0, 0, 0);
+        timeAxis.firstReportDateTime = DateTime(date, Time(0, 0, 0, static_cast<int>(record.secondsOfDay)), record.utcOffset);
+      }
+      if (record.hasInterval != 0) {
+        timeAxis.intervalMinutes = record.intervalMinutes;
+      }
+      std::vector<std::int64_t> seconds(record.numSeconds);
+      std::memcpy(seconds.data(), data + record.secondsOffset, seconds.size() * sizeof(std::int64_t));
+      timeAxis.secondsFromFirstReport.assign(seconds.begin(), seconds.end());
+      result->m_timeAxes.push_back(std::move(timeAxis));
+    }
+
+    result->m_entriesOffset = header.entriesOffset;
+    result->m_numEntries = header.numEntries;
+    return result;
+  }
+
+  bool SqlFileTimeSeriesCache::timeSeries(const DataDictionaryItem& dataDictionaryItem, boost::optional<TimeSeries>& timeSeries) const {
+    EntryRecord key{};
+    key.table = tableId(dataDictionaryItem.table);
+    key.recordIndex = dataDictionaryItem.recordIndex;
+    key.envPeriodIndex = dataDictionaryItem.envPeriodIndex;
+    if (key.table < 0) {
+      return false;
+    }
+
+    // binary search of the sorted entries
+    const char* data = m_file.data();
+    std::size_t first = 0;
+    std::size_t count = m_numEntries;
+    while (count > 0) {
+      const std::size_t step = count / 2;
+      const auto entry = readRecord<EntryRecord>(data, m_entriesOffset + (first + step) * sizeof(EntryRecord));
+      if (entryKey(entry) < entryKey(key)) {
+        first += step + 1;
+        count -= step + 1;
+      } else {
+        count = step;
+      }
+    }
+    if (first == m_numEntries) {
+      return false;
+    }
+    const auto entry = readRecord<EntryRecord>(data, m_entriesOffset + first * sizeof(EntryRecord));
+    if ((entryKey(entry) != entryKey(key)) || (entry.timeAxis >= m_timeAxes.size()) || (entry.valuesOffset > m_file.size())
+        || (entry.numValues > (m_file.size() - entry.valuesOffset) / sizeof(double))) {
+      return false;
+    }
+
+    Vector values(entry.numValues);
+    if (entry.numValues > 0) {
+      std::memcpy(&values[0], data + entry.valuesOffset, entry.numValues * sizeof(double));
+    }
+    timeSeries = m_timeAxes[entry.timeAxis].timeSeries(values, dataDictionaryItem.units);
+    return true;
+  }
+
+  std::size_t SqlFileTimeSeriesCache::numTimeSeries() const {
+    return m_numEntries;
+  }
+
+}  // namespace detail
+}  // namespace openstudio
@@ -0,0 +1,110 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#ifndef UTILITIES_SQL_SQLFILETIMESERIESCACHE_HPP
+#define UTILITIES_SQL_SQLFILETIMESERIESCACHE_HPP
+
+#include "../UtilitiesAPI.hpp"
+
+#include "SqlFileDataDictionary.hpp"
+#include "../core/Filesystem.hpp"
+#include "../core/Logger.hpp"
+#include "../data/TimeSeries.hpp"
+#include "../data/Vector.hpp"
+#include "../time/DateTime.hpp"
+
+#include <boost/iostreams/device/mapped_file.hpp>
+#include <boost/optional.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace openstudio {
+namespace detail {
+
+  /** Report times of a time series of an SqlFile, as TimeSeries takes them. */
+  struct UTILITIES_API SqlFileTimeAxis
+  {
+    boost::optional<DateTime> firstReportDateTime;
+    std::vector<long> secondsFromFirstReport;
+    // set if all reports are this far apart
+    boost::optional<unsigned> intervalMinutes;
+
+    /** Returns a time series of values at these report times, if there is any report. */
+    boost::optional<TimeSeries> timeSeries(const Vector& values, const std::string& units) const;
+  };
+
+  /** SqlFileTimeSeriesCache is a binary file holding all the time series of an SqlFile. Values are stored as one contiguous array of
+   *  doubles per data dictionary entry, and report times are stored once for all the series reported at the same times, so that
+   *  the file can be memory mapped and series read back without querying SQLite. The cache records the size and last write time
+   *  of the SqlFile it was built from, and is not opened once those no longer match. */
+  class UTILITIES_API SqlFileTimeSeriesCache
+  {
+   public:
+    /// Identifies the state of the SqlFile a cache is built from.
+    struct Fingerprint
+    {
+      std::uint64_t fileSize = 0;
+      std::int64_t lastWriteTime = 0;
+      std::uint64_t numDataDictionaryItems = 0;
+    };
+
+    /** Returns the fingerprint of the SqlFile at sqlPath, holding numDataDictionaryItems entries. */
+    static boost::optional<Fingerprint> fingerprint(const openstudio::path& sqlPath, std::size_t numDataDictionaryItems);
+
+    /** Writes a cache, series by series. Nothing is written at cachePath until finish() succeeds. */
+    class UTILITIES_API Writer
+    {
+     public:
+      explicit Writer(const openstudio::path& cachePath);
+
+      // removes the partial file if finish() was not called or failed
+      ~Writer();
+
+      Writer(const Writer& other) = delete;
+      Writer& operator=(const Writer& other) = delete;
+
+      /** Appends the values of dataDictionaryItem, reported at the times of the timeAxisIndex-th axis passed to finish().
+       *  Entries of tables other than ReportVariableData and ReportMeterData are ignored. */
+      void addTimeSeries(const DataDictionaryItem& dataDictionaryItem, std::size_t timeAxisIndex, const std::vector<double>& values);
+
+      /** Writes the time axes and the index of the series, and moves the file to cachePath. */
+      bool finish(const std::vector<SqlFileTimeAxis>& timeAxes, const Fingerprint& fingerprint);
+
+     private:
+      struct Impl;
+      std::unique_ptr<Impl> m_impl;
+    };
+
+    /** Maps the cache at cachePath. Returns nullptr if it does not exist, cannot be read, or was not built from fingerprint. */
+    static std::unique_ptr<SqlFileTimeSeriesCache> open(const openstudio::path& cachePath, const Fingerprint& fingerprint);
+
+    SqlFileTimeSeriesCache(const SqlFileTimeSeriesCache& other) = delete;
+    SqlFileTimeSeriesCache& operator=(const SqlFileTimeSeriesCache& other) = delete;
+
+    /** Returns true if the cache holds the series of dataDictionaryItem. timeSeries is then set to it, or to none if it has no
+     *  report. */
+    bool timeSeries(const DataDictionaryItem& dataDictionaryItem, boost::optional<TimeSeries>& timeSeries) const;
+
+    /** Number of series in the cache. */
+    std::size_t numTimeSeries() const;
+
+   private:
+    SqlFileTimeSeriesCache() = default;
+
+    boost::iostreams::mapped_file_source m_file;
+    std::vector<SqlFileTimeAxis> m_timeAxes;
+    std::size_t m_entriesOffset = 0;
+    std::size_t m_numEntries = 0;
+
+    REGISTER_LOGGER("openstudio.energyplus.SqlFileTimeSeriesCache");
+  };
+
+}  // namespace detail
+}  // namespace openstudio
+
+#endif  // UTILITIES_SQL_SQLFILETIMESERIESCACHE_HPP
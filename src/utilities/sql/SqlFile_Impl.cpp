@@ -17,6 +17,10 @@
 
 #include <sqlite3.h>
 
+#include <algorithm>
+#include <iterator>
+#include <unordered_map>
+
 using boost::multi_index_container;
 using boost::multi_index::indexed_by;
 using boost::multi_index::ordered_unique;
@@ -422,6 +426,8 @@ namespace detail {
   }
 
   bool SqlFile_Impl::close() {
+    m_timeSeriesCache.reset();
+    m_cachedStatements.clear();
     if (m_connectionOpen) {
       sqlite3_close(m_db);
       m_connectionOpen = false;
@@ -462,6 +468,10 @@ namespace detail {
 
       // retrieve DataDictionaryTable
       retrieveDataDictionary();
+
+      if (m_useTimeSeriesCache) {
+        openTimeSeriesCache();
+      }
     } else {
       throw openstudio::Exception("File not successfully opened.");
     }
@@ -2661,6 +2671,32 @@ namespace detail {
     return vec;
   }
 
+  void SqlFile_Impl::cacheTimeSeries(const std::string& envPeriod, const std::string& reportingFrequency, const std::string& timeSeriesName,
+                                     const std::vector<std::string>& keyValues) {
+    std::string queryEnvPeriod = boost::to_upper_copy(envPeriod);
+    auto& index = m_dataDictionary.get<envPeriodReportingFrequencyNameKeyValue>();
+    std::vector<DataDictionaryTable::index<envPeriodReportingFrequencyNameKeyValue>::type::iterator> iterators;
+    std::vector<DataDictionaryItem> items;
+    for (const std::string& keyValue : keyValues) {
+      auto it = index.find(boost::make_tuple(queryEnvPeriod, reportingFrequency, timeSeriesName, keyValue));
+      if ((it != index.end()) && it->timeSeries.values().empty()) {
+        iterators.push_back(it);
+        items.push_back(*it);
+      }
+    }
+    if (items.size() < 2) {
+      return;
+    }
+
+    std::vector<boost::optional<TimeSeries>> loaded = timeSeries(items);
+    for (std::size_t i = 0; i < loaded.size(); ++i) {
+      if (loaded[i]) {
+        items[i].timeSeries = *loaded[i];
+        index.replace(iterators[i], items[i]);
+      }
+    }
+  }
+
   openstudio::TimeSeriesVector SqlFile_Impl::timeSeries(const std::string& envPeriod, const std::string& reportingFrequency,
                                                         const std::string& timeSeriesName) {
 
@@ -2668,6 +2704,9 @@ namespace detail {
     openstudio::OptionalTimeSeries ts;
 
     std::vector<std::string> vecKeyValues = availableKeyValues(envPeriod, reportingFrequency, timeSeriesName);
+
+    cacheTimeSeries(envPeriod, reportingFrequency, timeSeriesName, vecKeyValues);
+
     std::vector<std::string>::iterator iter;
     for (iter = vecKeyValues.begin(); iter != vecKeyValues.end(); ++iter) {
       ts = timeSeries(envPeriod, reportingFrequency, timeSeriesName, *iter);
@@ -2719,35 +2758,27 @@ namespace detail {
       s << " rvd INNER JOIN Time ti ON ti.TimeIndex = rvd.TimeIndex";
       //    s << " INNER JOIN EnvironmentPeriods ep ON ti.EnvironmentPeriodIndex = ep.EnvironmentPeriodIndex";
       if (dataDictionary.table == "ReportMeterData") {
-        s << " WHERE rvd.ReportMeterDataDictionaryIndex=";
+        s << " WHERE rvd.ReportMeterDataDictionaryIndex=?";
       } else if (dataDictionary.table == "ReportVariableData") {
-        s << " WHERE rvd.ReportVariableDataDictionaryIndex=";
+        s << " WHERE rvd.ReportVariableDataDictionaryIndex=?";
+      } else {
+        return stdValues;
       }
-      s << boost::lexical_cast<std::string>(dataDictionary.recordIndex);
-      //      s << " AND ep.EnvironmentName = ";
-      //      s << "'" << dataDictionary.envPeriod << "'";
-      s << " AND ti.EnvironmentPeriodIndex = ";
-      s << boost::lexical_cast<std::string>(dataDictionary.envPeriodIndex);
+      s << " AND ti.EnvironmentPeriodIndex = ?";
       // assume that timeindices.timeIndex are ordered from start to end
       //      s << " ORDER BY ti.TimeIndex";
 
-      sqlite3_stmt* sqlStmtPtr;
-
-      int code = sqlite3_prepare_v2(m_db, s.str().c_str(), -1, &sqlStmtPtr, nullptr);
-
-      code = sqlite3_step(sqlStmtPtr);
-      std::stringstream s2;
-      s2 << "SQL Query:" << '\n';
-      s2 << s.str();
-      s2 << "Return Code:" << '\n';
-      s2 << code;
-      LOG(Debug, s2.str());
-      while (code == SQLITE_ROW) {
-        stdValues.push_back(sqlite3_column_double(sqlStmtPtr, 0));  // values
-
-        code = sqlite3_step(sqlStmtPtr);
+      PreparedStatement* stmtPtr = cachedStatement(s.str());
+      if (!stmtPtr) {
+        return stdValues;
       }
-      sqlite3_finalize(sqlStmtPtr);
+      PreparedStatement& stmt = *stmtPtr;
+      stmt.bindAll(dataDictionary.recordIndex, dataDictionary.envPeriodIndex);
+      LOG(Debug, "SQL Query:" << '\n' << s.str() << " with " << dataDictionary.recordIndex << ", " << dataDictionary.envPeriodIndex);
+      while (stmt.step()) {
+        stdValues.push_back(stmt.columnDouble(0));  // values
+      }
+      stmt.reset();
     }
 
     LOG(Debug, "Created Timeseries with " << stdValues.size() << " values");
@@ -2987,24 +3018,9 @@ namespace detail {
 
   openstudio::OptionalTimeSeries SqlFile_Impl::timeSeries(const DataDictionaryItem& dataDictionary) {
     openstudio::OptionalTimeSeries ts;
-    std::string units = dataDictionary.units;
-
-    boost::optional<openstudio::DateTime> firstReportDateTime;
-    std::vector<long> stdSecondsFromFirstReport;
-    stdSecondsFromFirstReport.reserve(8760);
-
-    std::vector<double> stdValues;
-    stdValues.reserve(8760);
-    boost::optional<unsigned> reportingIntervalMinutes;
-
-    ReportingFrequency reportingFrequency(ReportingFrequency::RunPeriod);
-    bool isIntervalTimeSeries = false;
-    try {
-      reportingFrequency = ReportingFrequency(dataDictionary.reportingFrequency);
-      isIntervalTimeSeries = (reportingFrequency == ReportingFrequency::Timestep) || (reportingFrequency == ReportingFrequency::Hourly)
-                             || (reportingFrequency == ReportingFrequency::Daily);
 
-    } catch (const std::exception&) {
+    if (m_timeSeriesCache && m_timeSeriesCache->timeSeries(dataDictionary, ts)) {
+      return ts;
     }
 
     if (m_db) {
@@ -3024,135 +3040,321 @@ namespace detail {
       s << " dt INNER JOIN Time ON Time.timeIndex = dt.TimeIndex";
       s << " WHERE ";
       if (dataDictionary.table == "ReportMeterData") {
-        s << " dt.ReportMeterDataDictionaryIndex=";
+        s << " dt.ReportMeterDataDictionaryIndex=?";
       } else if (dataDictionary.table == "ReportVariableData") {
-        s << " dt.ReportVariableDataDictionaryIndex=";
+        s << " dt.ReportVariableDataDictionaryIndex=?";
+      } else {
+        return ts;
       }
-      s << boost::lexical_cast<std::string>(dataDictionary.recordIndex);
-      s << " AND Time.EnvironmentPeriodIndex = ";
-      s << boost::lexical_cast<std::string>(dataDictionary.envPeriodIndex);
+      s << " AND Time.EnvironmentPeriodIndex = ?";
 
-      sqlite3_stmt* sqlStmtPtr;
+      PreparedStatement* stmtPtr = cachedStatement(s.str());
+      if (!stmtPtr) {
+        return ts;
+      }
+      PreparedStatement& stmt = *stmtPtr;
+      stmt.bindAll(dataDictionary.recordIndex, dataDictionary.envPeriodIndex);
+      LOG(Debug, "SQL Query:" << '\n' << s.str() << " with " << dataDictionary.recordIndex << ", " << dataDictionary.envPeriodIndex);
+
+      std::vector<double> stdValues;
+      stdValues.reserve(8760);
+      std::vector<TimeRow> timeRows;
+      timeRows.reserve(8760);
+      while (stmt.step()) {
+        int b = 0;
+        stdValues.push_back(stmt.columnDouble(b++));
+        TimeRow row;
+        if (hasYear()) {
+          row.year = stmt.columnInt(b++);
+        }
+        row.month = stmt.columnInt(b++);
+        row.day = stmt.columnInt(b++);
+        row.interval = stmt.columnInt(b++);
+        timeRows.push_back(row);
+      }
+      stmt.reset();
 
-      int code = sqlite3_prepare_v2(m_db, s.str().c_str(), -1, &sqlStmtPtr, nullptr);
+      TimeAxis axis = timeAxis(dataDictionary, timeRows, (version.major() == 8) && (version.minor() == 3));
+      ts = axis.timeSeries(createVector(stdValues), dataDictionary.units);
+    }
 
-      code = sqlite3_step(sqlStmtPtr);
-      std::stringstream s2;
-      s2 << "SQL Query:" << '\n';
-      s2 << s.str();
-      s2 << "Return Code:" << '\n';
-      s2 << code;
-      LOG(Debug, s2.str());
+    return ts;
+  }
 
-      long cumulativeSeconds = 0;
+  std::vector<boost::optional<TimeSeries>> SqlFile_Impl::timeSeries(const std::vector<DataDictionaryItem>& dataDictionaryItems) {
+    std::vector<boost::optional<TimeSeries>> result(dataDictionaryItems.size());
 
-      while (code == SQLITE_ROW) {
-        int b = 0;
-        double value = sqlite3_column_double(sqlStmtPtr, b++);
-        stdValues.push_back(value);
+    std::vector<DataDictionaryItem> toLoad;
+    std::vector<std::size_t> toLoadIndices;
+    for (std::size_t i = 0; i < dataDictionaryItems.size(); ++i) {
+      if (!m_timeSeriesCache || !m_timeSeriesCache->timeSeries(dataDictionaryItems[i], result[i])) {
+        toLoad.push_back(dataDictionaryItems[i]);
+        toLoadIndices.push_back(i);
+      }
+    }
 
-        boost::optional<unsigned> year;
+    std::vector<TimeAxis> timeAxes;
+    loadTimeSeries(toLoad, timeAxes, [&](std::size_t i, std::size_t timeAxisIndex, const std::vector<double>& values) {
+      result[toLoadIndices[i]] = timeAxes[timeAxisIndex].timeSeries(createVector(values), toLoad[i].units);
+    });
+
+    return result;
+  }
+
+  void SqlFile_Impl::loadTimeSeries(const std::vector<DataDictionaryItem>& dataDictionaryItems, std::vector<TimeAxis>& timeAxes,
+                                    const std::function<void(std::size_t, std::size_t, const std::vector<double>&)>& onTimeSeries) {
+    if (!m_db || dataDictionaryItems.empty()) {
+      return;
+    }
+
+    VersionString version(energyPlusVersion());
+    const bool energyPlus83 = (version.major() == 8) && (version.minor() == 3);
+
+    // Time rows by TimeIndex, read once for each environment period
+    std::map<int, std::unordered_map<int, TimeRow>> timeRowsByEnvPeriod;
+    for (const DataDictionaryItem& item : dataDictionaryItems) {
+      auto [it, inserted] = timeRowsByEnvPeriod.try_emplace(item.envPeriodIndex);
+      if (!inserted) {
+        continue;
+      }
+      std::string statement =
+        hasYear() ? "SELECT TimeIndex, Year, Month, Day, Interval FROM Time WHERE EnvironmentPeriodIndex = ?"
+                  : "SELECT TimeIndex, Month, Day, Interval FROM Time WHERE EnvironmentPeriodIndex = ?";
+      PreparedStatement* stmtPtr = cachedStatement(statement);
+      if (!stmtPtr) {
+        return;
+      }
+      PreparedStatement& stmt = *stmtPtr;
+      stmt.bindAll(item.envPeriodIndex);
+      while (stmt.step()) {
+        int b = 0;
+        int timeIndex = stmt.columnInt(b++);
+        TimeRow row;
         if (hasYear()) {
-          year = sqlite3_column_int(sqlStmtPtr, b++);
-          // As of EnergyPlus 9.4 and perhaps earlier, the anual run periods will have a valid year,
-          // however the sizing periods will have year = 0
-          if (year.get() == 0) {
-            year.reset();
-          }
+          row.year = stmt.columnInt(b++);
         }
+        row.month = stmt.columnInt(b++);
+        row.day = stmt.columnInt(b++);
+        row.interval = stmt.columnInt(b++);
+        it->second.emplace(timeIndex, row);
+      }
+      stmt.reset();
+    }
 
-        unsigned month = sqlite3_column_int(sqlStmtPtr, b++);
-        unsigned day = sqlite3_column_int(sqlStmtPtr, b++);
-
-        // In cases where you report the same meter key for eg at Daily and at Timestep frequency
-        // the intervalMinutes will be reported by E+ for the Timestep one, so you get the wrong one for Daily...
-        // And since we can compute this easily, might as well do it
-        unsigned intervalMinutes;
-        if (reportingFrequency == ReportingFrequency::Hourly) {
-          intervalMinutes = 60;
-        } else if (reportingFrequency == ReportingFrequency::Daily) {
-          intervalMinutes = 24 * 60;
-        } else if (reportingFrequency == ReportingFrequency::Monthly) {
-          intervalMinutes = day * 24 * 60;
-        } else {
-          // If Detailed, Timestep, RunPeriod, or Annual: it varies
-          intervalMinutes = sqlite3_column_int(sqlStmtPtr, b);  // Notice I'm not incrementing the counter here on purpose
-
-          if (reportingFrequency == ReportingFrequency::Annual) {
-            // Annual actually reports blank for Month, Day, Minute **and Interval** up to 9.3.0 at least
-            // We cannot let it be zero (when blank), since it will make the firstReportDateTime creation fail below
-            // cf https://github.com/NREL/EnergyPlus/issues/7939
-            if (intervalMinutes == 0) {
-              intervalMinutes = 365 * 24 * 60;
-            } else if ((intervalMinutes != 365 * 24 * 60) && (intervalMinutes != 366 * 24 * 60)) {
-              // Issue a Debug log, but retain value. Technically Annual reports on 12/31, regardless of when the start date was
-              LOG(Debug, "For an 'Annual' frequency, intervalMinutes (= " << intervalMinutes << ") doesn't correspond to 365 or 366 days");
-            }
-          }
+    // Index in timeAxes of the axes already built, by environment period and reporting frequency, along with the TimeIndex values
+    // they were built from
+    std::map<std::pair<int, std::string>, std::vector<std::pair<std::vector<int>, std::size_t>>> builtTimeAxes;
+
+    std::vector<int> timeIndices;
+    std::vector<double> values;
+    std::vector<TimeRow> timeRows;
+    for (std::size_t i = 0; i < dataDictionaryItems.size(); ++i) {
+      const DataDictionaryItem& item = dataDictionaryItems[i];
+      if ((item.table != "ReportMeterData") && (item.table != "ReportVariableData")) {
+        continue;
+      }
+
+      // no join, values at times of other environment periods are dropped below
+      PreparedStatement* stmtPtr =
+        cachedStatement("SELECT TimeIndex, VariableValue FROM " + item.table + " WHERE " + item.table + "DictionaryIndex = ?");
+      if (!stmtPtr) {
+        continue;
+      }
+      PreparedStatement& stmt = *stmtPtr;
+      stmt.bindAll(item.recordIndex);
+      const std::unordered_map<int, TimeRow>& envTimeRows = timeRowsByEnvPeriod[item.envPeriodIndex];
+      timeIndices.clear();
+      values.clear();
+      while (stmt.step()) {
+        int timeIndex = stmt.columnInt(0);
+        if (envTimeRows.count(timeIndex) != 0) {
+          timeIndices.push_back(timeIndex);
+          values.push_back(stmt.columnDouble(1));
         }
-        // Don't forget to increment the counter anyway, no matter whether we did call sqlite3_column_int or not
-        ++b;
-
-        if ((version.major() == 8) && (version.minor() == 3)) {
-          // workaround for bug in E+ 8.3, issue #1692
-          if (reportingFrequency == ReportingFrequency::RunPeriod) {
-            DateTime firstDateTime = this->firstDateTime(false, dataDictionary.envPeriodIndex);
-            DateTime lastDateTime = this->lastDateTime(false, dataDictionary.envPeriodIndex);
-            Time deltaT = lastDateTime - firstDateTime;
-            intervalMinutes = (unsigned)deltaT.totalMinutes() + 60;
-          }
+      }
+      stmt.reset();
+
+      std::vector<std::pair<std::vector<int>, std::size_t>>& axes = builtTimeAxes[std::make_pair(item.envPeriodIndex, item.reportingFrequency)];
+      auto axisIt = std::find_if(axes.begin(), axes.end(), [&timeIndices](const auto& axis) { return axis.first == timeIndices; });
+      if (axisIt == axes.end()) {
+        timeRows.clear();
+        for (int timeIndex : timeIndices) {
+          timeRows.push_back(envTimeRows.at(timeIndex));
         }
+        timeAxes.push_back(timeAxis(item, timeRows, energyPlus83));
+        axes.emplace_back(timeIndices, timeAxes.size() - 1);
+        axisIt = std::prev(axes.end());
+      }
 
-        if (!firstReportDateTime) {
-          if ((month == 0) || (day == 0)) {
-            // gets called for RunPeriod reports
-            firstReportDateTime = lastDateTime(false, dataDictionary.envPeriodIndex);
-          } else {
-            // DLM: get standard time zone?
-            if (intervalMinutes >= 24 * 60) {
-              // Daily or Monthly
-              OS_ASSERT(intervalMinutes % (24 * 60) == 0);
-              firstReportDateTime = year ? openstudio::DateTime(openstudio::Date(month, day, *year), openstudio::Time(1, 0, 0, 0))
-                                         : openstudio::DateTime(openstudio::Date(month, day), openstudio::Time(1, 0, 0, 0));
-            } else {
-              firstReportDateTime = year ? openstudio::DateTime(openstudio::Date(month, day, *year), openstudio::Time(0, 0, intervalMinutes, 0))
-                                         : openstudio::DateTime(openstudio::Date(month, day), openstudio::Time(0, 0, intervalMinutes, 0));
-            }
-          }
-        }
+      onTimeSeries(i, axisIt->second, values);
+    }
+  }
 
-        // Use the new way to create the time series with nonzero first entry
-        cumulativeSeconds += 60 * intervalMinutes;
-        stdSecondsFromFirstReport.push_back(cumulativeSeconds);
+  SqlFile_Impl::TimeAxis SqlFile_Impl::timeAxis(const DataDictionaryItem& dataDictionary, const std::vector<TimeRow>& timeRows, bool energyPlus83) {
+    TimeAxis result;
+    result.secondsFromFirstReport.reserve(timeRows.size());
 
-        // check if this interval is same as the others
-        if (isIntervalTimeSeries && !reportingIntervalMinutes) {
-          reportingIntervalMinutes = intervalMinutes;
-        } else if (reportingIntervalMinutes && (reportingIntervalMinutes.get() != intervalMinutes)) {
-          isIntervalTimeSeries = false;
-          reportingIntervalMinutes.reset();
-        }
+    ReportingFrequency reportingFrequency(ReportingFrequency::RunPeriod);
+    bool isIntervalTimeSeries = false;
+    try {
+      reportingFrequency = ReportingFrequency(dataDictionary.reportingFrequency);
+      isIntervalTimeSeries = (reportingFrequency == ReportingFrequency::Timestep) || (reportingFrequency == ReportingFrequency::Hourly)
+                             || (reportingFrequency == ReportingFrequency::Daily);
 
-        // step to next row
-        code = sqlite3_step(sqlStmtPtr);
+    } catch (const std::exception&) {
+    }
+
+    long cumulativeSeconds = 0;
+
+    for (const TimeRow& row : timeRows) {
+      boost::optional<unsigned> year;
+      // As of EnergyPlus 9.4 and perhaps earlier, the anual run periods will have a valid year,
+      // however the sizing periods will have year = 0
+      if (row.year != 0) {
+        year = row.year;
       }
 
-      // must finalize to prevent memory leaks
-      sqlite3_finalize(sqlStmtPtr);
+      unsigned month = row.month;
+      unsigned day = row.day;
+
+      // In cases where you report the same meter key for eg at Daily and at Timestep frequency
+      // the intervalMinutes will be reported by E+ for the Timestep one, so you get the wrong one for Daily...
+      // And since we can compute this easily, might as well do it
+      unsigned intervalMinutes;
+      if (reportingFrequency == ReportingFrequency::Hourly) {
+        intervalMinutes = 60;
+      } else if (reportingFrequency == ReportingFrequency::Daily) {
+        intervalMinutes = 24 * 60;
+      } else if (reportingFrequency == ReportingFrequency::Monthly) {
+        intervalMinutes = day * 24 * 60;
+      } else {
+        // If Detailed, Timestep, RunPeriod, or Annual: it varies
+        intervalMinutes = row.interval;
+
+        if (reportingFrequency == ReportingFrequency::Annual) {
+          // Annual actually reports blank for Month, Day, Minute **and Interval** up to 9.3.0 at least
+          // We cannot let it be zero (when blank), since it will make the firstReportDateTime creation fail below
+          // cf https://github.com/NREL/EnergyPlus/issues/7939
+          if (intervalMinutes == 0) {
+            intervalMinutes = 365 * 24 * 60;
+          } else if ((intervalMinutes != 365 * 24 * 60) && (intervalMinutes != 366 * 24 * 60)) {
+            // Issue a Debug log, but retain value. Technically Annual reports on 12/31, regardless of when the start date was
+            LOG(Debug, "For an 'Annual' frequency, intervalMinutes (= " << intervalMinutes << ") doesn't correspond to 365 or 366 days");
+          }
+        }
+      }
 
-      if (firstReportDateTime && !stdSecondsFromFirstReport.empty()) {
-        if (isIntervalTimeSeries) {
-          openstudio::Time intervalTime(0, 0, *reportingIntervalMinutes, 0);
-          openstudio::Vector values = createVector(stdValues);
-          ts = openstudio::TimeSeries(*firstReportDateTime, intervalTime, values, units);
+      if (energyPlus83) {
+        // workaround for bug in E+ 8.3, issue #1692
+        if (reportingFrequency == ReportingFrequency::RunPeriod) {
+          DateTime firstDateTime = this->firstDateTime(false, dataDictionary.envPeriodIndex);
+          DateTime lastDateTime = this->lastDateTime(false, dataDictionary.envPeriodIndex);
+          Time deltaT = lastDateTime - firstDateTime;
+          intervalMinutes = (unsigned)deltaT.totalMinutes() + 60;
+        }
+      }
+
+      if (!result.firstReportDateTime) {
+        if ((month == 0) || (day == 0)) {
+          // gets called for RunPeriod reports
+          result.firstReportDateTime = lastDateTime(false, dataDictionary.envPeriodIndex);
         } else {
-          openstudio::Vector values = createVector(stdValues);
-          ts = openstudio::TimeSeries(*firstReportDateTime, stdSecondsFromFirstReport, values, units);
+          // DLM: get standard time zone?
+          if (intervalMinutes >= 24 * 60) {
+            // Daily or Monthly
+            OS_ASSERT(intervalMinutes % (24 * 60) == 0);
+            result.firstReportDateTime = year ? openstudio::DateTime(openstudio::Date(month, day, *year), openstudio::Time(1, 0, 0, 0))
+                                              : openstudio::DateTime(openstudio::Date(month, day), openstudio::Time(1, 0, 0, 0));
+          } else {
+            result.firstReportDateTime = year
+                                           ? openstudio::DateTime(openstudio::Date(month, day, *year), openstudio::Time(0, 0, intervalMinutes, 0))
+                                           : openstudio::DateTime(openstudio::Date(month, day), openstudio::Time(0, 0, intervalMinutes, 0));
+          }
         }
       }
+
+      // Use the new way to create the time series with nonzero first entry
+      cumulativeSeconds += 60 * intervalMinutes;
+      result.secondsFromFirstReport.push_back(cumulativeSeconds);
+
+      // check if this interval is same as the others
+      if (isIntervalTimeSeries && !result.intervalMinutes) {
+        result.intervalMinutes = intervalMinutes;
+      } else if (result.intervalMinutes && (result.intervalMinutes.get() != intervalMinutes)) {
+        isIntervalTimeSeries = false;
+        result.intervalMinutes.reset();
+      }
     }
 
-    return ts;
+    return result;
+  }
+
+  bool SqlFile_Impl::enableTimeSeriesCache() {
+    m_useTimeSeriesCache = true;
+    return openTimeSeriesCache();
+  }
+
+  void SqlFile_Impl::disableTimeSeriesCache() {
+    m_useTimeSeriesCache = false;
+    m_timeSeriesCache.reset();
+  }
+
+  openstudio::path SqlFile_Impl::timeSeriesCachePath() const {
+    openstudio::path result = m_path;
+    result += toPath(".tscache");
+    return result;
+  }
+
+  bool SqlFile_Impl::openTimeSeriesCache() {
+    m_timeSeriesCache.reset();
+    if (!m_connectionOpen) {
+      return false;
+    }
+
+    boost::optional<SqlFileTimeSeriesCache::Fingerprint> fingerprint = SqlFileTimeSeriesCache::fingerprint(m_path, m_dataDictionary.size());
+    if (!fingerprint) {
+      return false;
+    }
+
+    openstudio::path cachePath = timeSeriesCachePath();
+    m_timeSeriesCache = SqlFileTimeSeriesCache::open(cachePath, *fingerprint);
+    if (m_timeSeriesCache) {
+      return true;
+    }
+
+    LOG(Info, "Building time series cache '" << toString(cachePath) << "'");
+    std::vector<DataDictionaryItem> items(m_dataDictionary.begin(), m_dataDictionary.end());
+    std::vector<TimeAxis> timeAxes;
+    SqlFileTimeSeriesCache::Writer writer(cachePath);
+    try {
+      loadTimeSeries(items, timeAxes, [&items, &writer](std::size_t i, std::size_t timeAxisIndex, const std::vector<double>& values) {
+        writer.addTimeSeries(items[i], timeAxisIndex, values);
+      });
+    } catch (const std::exception& e) {
+      LOG(Error, "Error building time series cache '" << toString(cachePath) << "': " << e.what());
+      return false;
+    }
+    if (!writer.finish(timeAxes, *fingerprint)) {
+      LOG(Error, "Cannot write time series cache '" << toString(cachePath) << "'");
+      return false;
+    }
+
+    m_timeSeriesCache = SqlFileTimeSeriesCache::open(cachePath, *fingerprint);
+    return (m_timeSeriesCache != nullptr);
+  }
+
+  PreparedStatement* SqlFile_Impl::cachedStatement(const std::string& statement) {
+    auto it = m_cachedStatements.find(statement);
+    if (it == m_cachedStatements.end()) {
+      try {
+        it = m_cachedStatements.emplace(statement, std::make_unique<PreparedStatement>(statement, m_db)).first;
+      } catch (const std::exception& e) {
+        // failures are not cached, the statement is prepared again on the next call as each query used to be
+        LOG(Error, "Cannot prepare SQL statement '" << statement << "': " << e.what());
+        return nullptr;
+      }
+    }
+    return it->second.get();
   }
 
   openstudio::DateTimeVector SqlFile_Impl::dateTimeVec(const DataDictionaryItem& dataDictionary) {
@@ -3539,6 +3741,7 @@ namespace detail {
     ReportingFrequency rf = *(wquery.reportingFrequency());
     std::string tsName = *(wquery.timeSeries().get().name());
     if (wquery.keyValues()) {
+      cacheTimeSeries(envPeriod, rf.valueDescription(), tsName, wquery.keyValues().get().names());
       for (const std::string& kvName : wquery.keyValues().get().names()) {
         OptionalTimeSeries ots = timeSeries(envPeriod, rf.valueDescription(), tsName, kvName);
         if (ots) {
@@ -11,6 +11,7 @@
 #include "SummaryData.hpp"
 #include "SqlFileEnums.hpp"
 #include "SqlFileDataDictionary.hpp"
+#include "SqlFileTimeSeriesCache.hpp"
 #include "PreparedStatement.hpp"
 #include "../data/DataEnums.hpp"
 #include "../data/EndUses.hpp"
@@ -21,6 +22,9 @@
 
 #include <boost/optional.hpp>
 
+#include <functional>
+#include <map>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -1091,6 +1095,21 @@ namespace detail {
        *  down by ReportingFrequency and determine how many TimeSeries will be returned. */
     std::vector<TimeSeries> timeSeries(const SqlFileTimeSeriesQuery& query);
 
+    /** Returns the time series of each of dataDictionaryItems, in the same order. The Time table is read once per environment
+     *  period, values are read with cached prepared statements, and series reported at the same times share one time axis. */
+    std::vector<boost::optional<TimeSeries>> timeSeries(const std::vector<DataDictionaryItem>& dataDictionaryItems);
+
+    /** Maps the binary time series cache at timeSeriesCachePath(), building it first if it is missing or out of date. Time series
+     *  are then read from the cache instead of the database, until disableTimeSeriesCache() is called. The cache is rebuilt on
+     *  reopen() if the file changed. Returns false if the cache could not be built. */
+    bool enableTimeSeriesCache();
+
+    /// stops reading time series from the cache, the cache file is kept
+    void disableTimeSeriesCache();
+
+    /// path of the time series cache, next to the file
+    openstudio::path timeSeriesCachePath() const;
+
     // returns an optional pair of date times for begin and end of daylight savings time
     boost::optional<std::pair<openstudio::DateTime, openstudio::DateTime>> daylightSavingsPeriod() const;
 
@@ -1318,6 +1337,36 @@ namespace detail {
 
     // return a single timeseries matching recordIndex - internally used to retrieve timeseries
     boost::optional<TimeSeries> timeSeries(const DataDictionaryItem& dataDictionary);
+
+    // Year (0 if not reported), Month, Day and Interval of a row of the Time table
+    struct TimeRow
+    {
+      unsigned year = 0;
+      unsigned month = 0;
+      unsigned day = 0;
+      unsigned interval = 0;
+    };
+
+    using TimeAxis = SqlFileTimeAxis;
+
+    // builds the report times of dataDictionary from the Time rows of its values
+    TimeAxis timeAxis(const DataDictionaryItem& dataDictionary, const std::vector<TimeRow>& timeRows, bool energyPlus83);
+
+    // loads the values of each of dataDictionaryItems and hands them to onTimeSeries, along with the index of their report times in
+    // timeAxes. Series reported at the same times share one axis.
+    void loadTimeSeries(const std::vector<DataDictionaryItem>& dataDictionaryItems, std::vector<TimeAxis>& timeAxes,
+                        const std::function<void(std::size_t, std::size_t, const std::vector<double>&)>& onTimeSeries);
+
+    // maps the time series cache, building it first if it is missing or out of date
+    bool openTimeSeriesCache();
+
+    // loads the time series of the keyValues not cached in the data dictionary yet in one batch, and caches them
+    void cacheTimeSeries(const std::string& envPeriod, const std::string& reportingFrequency, const std::string& timeSeriesName,
+                         const std::vector<std::string>& keyValues);
+
+    // returns the statement prepared for this text on the current connection, reset and ready to be bound, or nullptr if it cannot be
+    // prepared
+    PreparedStatement* cachedStatement(const std::string& statement);
     std::vector<double> timeSeriesValues(const DataDictionaryItem& dataDictionary);
     boost::optional<Date> timeSeriesStartDate(const DataDictionaryItem& dataDictionary);
 
@@ -1340,6 +1389,10 @@ namespace detail {
     bool m_connectionOpen;
     DataDictionaryTable m_dataDictionary;
     sqlite3* m_db;
+    // finalized before m_db is closed
+    std::map<std::string, std::unique_ptr<PreparedStatement>> m_cachedStatements;
+    bool m_useTimeSeriesCache = false;
+    std::unique_ptr<SqlFileTimeSeriesCache> m_timeSeriesCache;
     std::string m_sqliteFilename;
 
     bool m_supportedVersion;
@@ -6,6 +6,7 @@
 #include <gtest/gtest.h>
 
 #include "SqlFileFixture.hpp"
+#include "../SqlFile_Impl.hpp"
 
 #include "../../time/Date.hpp"
 #include "../../time/Calendar.hpp"
@@ -197,6 +198,123 @@ TEST_F(SqlFileFixture, TimeSeries) {
   EXPECT_DOUBLE_EQ(365 - 1.0 / 24.0, duration.totalDays());
 }
 
+TEST_F(SqlFileFixture, TimeSeries_Batch) {
+  openstudio::detail::SqlFile_Impl sqlFileImpl(sqlFile.path());
+  openstudio::detail::DataDictionaryTable dataDictionary = sqlFileImpl.dataDictionary();
+  std::vector<openstudio::detail::DataDictionaryItem> items(dataDictionary.begin(), dataDictionary.end());
+  ASSERT_FALSE(items.empty());
+
+  std::vector<OptionalTimeSeries> batch = sqlFileImpl.timeSeries(items);
+  ASSERT_EQ(items.size(), batch.size());
+
+  unsigned numTimeSeries = 0;
+  for (unsigned i = 0; i < items.size(); ++i) {
+    const openstudio::detail::DataDictionaryItem& item = items[i];
+    OptionalTimeSeries ts = sqlFileImpl.timeSeries(item.envPeriod, item.reportingFrequency, item.name, item.keyValue);
+    ASSERT_EQ(ts.has_value(), batch[i].has_value()) << item.name << ", " << item.keyValue << ", " << item.reportingFrequency;
+    if (!ts) {
+      continue;
+    }
+    ++numTimeSeries;
+    EXPECT_EQ(ts->units(), batch[i]->units());
+    EXPECT_EQ(ts->firstReportDateTime(), batch[i]->firstReportDateTime());
+    EXPECT_EQ(ts->intervalLength().has_value(), batch[i]->intervalLength().has_value());
+    EXPECT_EQ(ts->secondsFromFirstReport(), batch[i]->secondsFromFirstReport());
+    Vector values = ts->values();
+    Vector batchValues = batch[i]->values();
+    ASSERT_EQ(values.size(), batchValues.size());
+    for (unsigned j = 0; j < values.size(); ++j) {
+      EXPECT_EQ(values[j], batchValues[j]);
+    }
+  }
+  EXPECT_LT(0u, numTimeSeries);
+
+  // all keys of a variable are loaded in one batch
+  std::vector<std::string> availableEnvPeriods = sqlFile.availableEnvPeriods();
+  ASSERT_FALSE(availableEnvPeriods.empty());
+  std::vector<std::string> keyValues = sqlFile.availableKeyValues(availableEnvPeriods[0], "Hourly", "Zone Air Temperature");
+  EXPECT_LT(1u, keyValues.size());
+  std::vector<TimeSeries> allKeys = sqlFile.timeSeries(availableEnvPeriods[0], "Hourly", "Zone Air Temperature");
+  ASSERT_EQ(keyValues.size(), allKeys.size());
+  for (unsigned i = 0; i < keyValues.size(); ++i) {
+    OptionalTimeSeries ts = sqlFileImpl.timeSeries(availableEnvPeriods[0], "Hourly", "Zone Air Temperature", keyValues[i]);
+    ASSERT_TRUE(ts);
+    EXPECT_EQ(ts->secondsFromFirstReport(), allKeys[i].secondsFromFirstReport());
+  }
+}
+
+TEST_F(SqlFileFixture, TimeSeriesCache) {
+  openstudio::path cachedSqlPath = openstudio::tempDir() / openstudio::toPath("OpenStudioSqlFileTest_TimeSeriesCache.sql");
+  openstudio::filesystem::copy_file(sqlFile.path(), cachedSqlPath, openstudio::filesystem::copy_options::overwrite_existing);
+  openstudio::path cachePath;
+
+  {
+    openstudio::detail::SqlFile_Impl sqlFileImpl(sqlFile.path());
+    openstudio::detail::SqlFile_Impl cachedSqlFileImpl(cachedSqlPath);
+    cachePath = cachedSqlFileImpl.timeSeriesCachePath();
+    if (openstudio::filesystem::exists(cachePath)) {
+      openstudio::filesystem::remove(cachePath);
+    }
+    ASSERT_TRUE(cachedSqlFileImpl.enableTimeSeriesCache());
+    EXPECT_TRUE(openstudio::filesystem::exists(cachePath));
+
+    openstudio::detail::DataDictionaryTable dataDictionary = sqlFileImpl.dataDictionary();
+    std::vector<openstudio::detail::DataDictionaryItem> items(dataDictionary.begin(), dataDictionary.end());
+    ASSERT_FALSE(items.empty());
+    std::vector<OptionalTimeSeries> batch = cachedSqlFileImpl.timeSeries(items);
+    ASSERT_EQ(items.size(), batch.size());
+
+    for (unsigned i = 0; i < items.size(); ++i) {
+      const openstudio::detail::DataDictionaryItem& item = items[i];
+      OptionalTimeSeries ts = sqlFileImpl.timeSeries(item.envPeriod, item.reportingFrequency, item.name, item.keyValue);
+      OptionalTimeSeries cached = cachedSqlFileImpl.timeSeries(item.envPeriod, item.reportingFrequency, item.name, item.keyValue);
+      ASSERT_EQ(ts.has_value(), cached.has_value()) << item.name << ", " << item.keyValue << ", " << item.reportingFrequency;
+      ASSERT_EQ(ts.has_value(), batch[i].has_value()) << item.name << ", " << item.keyValue << ", " << item.reportingFrequency;
+      if (!ts) {
+        continue;
+      }
+      for (const TimeSeries& other : {*cached, *batch[i]}) {
+        EXPECT_EQ(ts->units(), other.units());
+        EXPECT_EQ(ts->firstReportDateTime(), other.firstReportDateTime());
+        EXPECT_EQ(ts->intervalLength().has_value(), other.intervalLength().has_value());
+        EXPECT_EQ(ts->secondsFromFirstReport(), other.secondsFromFirstReport());
+        Vector values = ts->values();
+        Vector otherValues = other.values();
+        ASSERT_EQ(values.size(), otherValues.size());
+        for (unsigned j = 0; j < values.size(); ++j) {
+          EXPECT_EQ(values[j], otherValues[j]);
+        }
+      }
+    }
+  }
+
+  {
+    // a cache that does not match the file is rebuilt
+    {
+      openstudio::filesystem::ofstream os(cachePath, std::ios_base::out | std::ios_base::trunc);
+      os << "not a cache";
+    }
+    openstudio::SqlFile cachedSqlFile(cachedSqlPath);
+    EXPECT_EQ(cachePath, cachedSqlFile.timeSeriesCachePath());
+    ASSERT_TRUE(cachedSqlFile.enableTimeSeriesCache());
+    EXPECT_LT(100u, openstudio::filesystem::file_size(cachePath));
+
+    std::vector<std::string> availableEnvPeriods = sqlFile.availableEnvPeriods();
+    ASSERT_FALSE(availableEnvPeriods.empty());
+    std::vector<TimeSeries> expected = sqlFile.timeSeries(availableEnvPeriods[0], "Hourly", "Zone Air Temperature");
+    std::vector<TimeSeries> cached = cachedSqlFile.timeSeries(availableEnvPeriods[0], "Hourly", "Zone Air Temperature");
+    ASSERT_EQ(expected.size(), cached.size());
+    for (unsigned i = 0; i < expected.size(); ++i) {
+      EXPECT_EQ(expected[i].firstReportDateTime(), cached[i].firstReportDateTime());
+      EXPECT_EQ(expected[i].secondsFromFirstReport(), cached[i].secondsFromFirstReport());
+      EXPECT_DOUBLE_EQ(openstudio::sum(expected[i].values()), openstudio::sum(cached[i].values()));
+    }
+
+    cachedSqlFile.disableTimeSeriesCache();
+    EXPECT_TRUE(openstudio::filesystem::exists(cachePath));
+  }
+}
+
 TEST_F(SqlFileFixture, BadStatement) {
   const std::string query = "SELECT * FROM NonExistantTable;";
   try {